@@ -443,6 +443,46 @@ PYBIND11_MODULE( pyULIS4, m ) {
         .value( "EventStatus_Idle",     eEventStatus::EventStatus_Idle      )
         .value( "EventStatus_Queued",   eEventStatus::EventStatus_Queued    )
         .value( "EventStatus_Finished", eEventStatus::EventStatus_Finished  )
+        .value( "EventStatus_Cancelled", eEventStatus::EventStatus_Cancelled )
+        .export_values();
+
+
+
+    /////////
+    // eDispatchPath
+    py::enum_< eDispatchPath >( m, "eDispatchPath" )
+        .value( "DispatchPath_MEM", eDispatchPath::DispatchPath_MEM )
+        .value( "DispatchPath_SSE", eDispatchPath::DispatchPath_SSE )
+        .value( "DispatchPath_AVX", eDispatchPath::DispatchPath_AVX )
+        .export_values();
+
+
+
+    /////////
+    // eThreadPoolBackend
+    py::enum_< eThreadPoolBackend >( m, "eThreadPoolBackend" )
+        .value( "ThreadPoolBackend_SharedQueue",    eThreadPoolBackend::ThreadPoolBackend_SharedQueue   )
+        .value( "ThreadPoolBackend_WorkStealing",   eThreadPoolBackend::ThreadPoolBackend_WorkStealing  )
+        .export_values();
+
+
+
+    /////////
+    // eThreadPoolAffinity
+    py::enum_< eThreadPoolAffinity >( m, "eThreadPoolAffinity" )
+        .value( "ThreadPoolAffinity_None",          eThreadPoolAffinity::ThreadPoolAffinity_None            )
+        .value( "ThreadPoolAffinity_Pinned",        eThreadPoolAffinity::ThreadPoolAffinity_Pinned          )
+        .value( "ThreadPoolAffinity_PhysicalCores", eThreadPoolAffinity::ThreadPoolAffinity_PhysicalCores   )
+        .export_values();
+
+
+
+    /////////
+    // eCommandQueuePriority
+    py::enum_< eCommandQueuePriority >( m, "eCommandQueuePriority" )
+        .value( "CommandQueuePriority_High",        eCommandQueuePriority::CommandQueuePriority_High        )
+        .value( "CommandQueuePriority_Normal",      eCommandQueuePriority::CommandQueuePriority_Normal      )
+        .value( "CommandQueuePriority_Low",         eCommandQueuePriority::CommandQueuePriority_Low         )
         .export_values();
 
 
@@ -461,6 +501,7 @@ PYBIND11_MODULE( pyULIS4, m ) {
     py::enum_< eScheduleRunPolicy >( m, "eScheduleRunPolicy" )
         .value( "ScheduleRun_Mono",     eScheduleRunPolicy::ScheduleRun_Mono    )
         .value( "ScheduleRun_Multi",    eScheduleRunPolicy::ScheduleRun_Multi   )
+        .value( "ScheduleRun_Inline",   eScheduleRunPolicy::ScheduleRun_Inline  )
         .export_values();
 
 
@@ -470,6 +511,8 @@ PYBIND11_MODULE( pyULIS4, m ) {
     py::enum_< eScheduleModePolicy >( m, "eScheduleModePolicy" )
         .value( "ScheduleMode_Scanlines",   eScheduleModePolicy::ScheduleMode_Scanlines )
         .value( "ScheduleMode_Chunks",      eScheduleModePolicy::ScheduleMode_Chunks    )
+        .value( "ScheduleMode_Auto",        eScheduleModePolicy::ScheduleMode_Auto      )
+        .value( "ScheduleMode_Tiles",       eScheduleModePolicy::ScheduleMode_Tiles     )
         .export_values();
 
 
@@ -590,7 +633,42 @@ PYBIND11_MODULE( pyULIS4, m ) {
         .def( py::init<>() )
         .def( py::init< const FOnEventComplete& >(), "onComplete"_a = FOnEventComplete() )
         .def( "Status", &FEvent::Status )
-        .def( "Wait", &FEvent::Wait );
+        .def( "Wait", &FEvent::Wait )
+        .def( "Cancel", &FEvent::Cancel )
+        .def( "Metrics", []( const FEvent* event ) -> py::object {
+            FCommandMetrics metrics;
+            if( !event->Metrics( &metrics ) )
+                return  py::none();
+            return  py::cast( metrics );
+        } );
+
+
+
+    /////////
+    // FCommandMetrics
+    py::class_< FCommandMetrics >( m, "FCommandMetrics" )
+        .def_readonly( "wallTime", &FCommandMetrics::wallTime )
+        .def_readonly( "cpuTime", &FCommandMetrics::cpuTime )
+        .def_readonly( "numJobs", &FCommandMetrics::numJobs )
+        .def_readonly( "bytesRead", &FCommandMetrics::bytesRead )
+        .def_readonly( "bytesWritten", &FCommandMetrics::bytesWritten )
+        .def_readonly( "pixels", &FCommandMetrics::pixels )
+        .def_readonly( "dispatchPath", &FCommandMetrics::dispatchPath );
+
+
+
+    /////////
+    // FOperationMetrics
+    py::class_< FOperationMetrics >( m, "FOperationMetrics" )
+        .def_readonly( "operation", &FOperationMetrics::operation )
+        .def_readonly( "numCommands", &FOperationMetrics::numCommands )
+        .def_readonly( "wallTime", &FOperationMetrics::wallTime )
+        .def_readonly( "cpuTime", &FOperationMetrics::cpuTime )
+        .def_readonly( "numJobs", &FOperationMetrics::numJobs )
+        .def_readonly( "bytesRead", &FOperationMetrics::bytesRead )
+        .def_readonly( "bytesWritten", &FOperationMetrics::bytesWritten )
+        .def_readonly( "pixels", &FOperationMetrics::pixels )
+        .def_readonly( "dispatchPath", &FOperationMetrics::dispatchPath );
 
 
 
@@ -611,13 +689,40 @@ PYBIND11_MODULE( pyULIS4, m ) {
 
 
 
+    /////////
+    // FThreadPoolStats
+    py::class_< FThreadPoolStats >( m, "FThreadPoolStats" )
+        .def_readonly( "numWorkers", &FThreadPoolStats::numWorkers )
+        .def_readonly( "numBusyWorkers", &FThreadPoolStats::numBusyWorkers )
+        .def_readonly( "numIdleWorkers", &FThreadPoolStats::numIdleWorkers )
+        .def_readonly( "numQueuedCommands", &FThreadPoolStats::numQueuedCommands )
+        .def_readonly( "numPendingCommands", &FThreadPoolStats::numPendingCommands )
+        .def_readonly( "numQueuedJobs", &FThreadPoolStats::numQueuedJobs )
+        .def_readonly( "numCommandsFinished", &FThreadPoolStats::numCommandsFinished )
+        .def_readonly( "numJobsFinished", &FThreadPoolStats::numJobsFinished )
+        .def_readonly( "utilisation", &FThreadPoolStats::utilisation )
+        .def_readonly( "commandsPerSecond", &FThreadPoolStats::commandsPerSecond )
+        .def_property_readonly( "jobTimeHistogram", []( const FThreadPoolStats& iStats ) {
+            return  std::vector< uint64 >( iStats.jobTimeHistogram, iStats.jobTimeHistogram + FThreadPoolStats::NumHistogramBuckets );
+        } )
+        .def_property_readonly( "schedulingLatencyHistogram", []( const FThreadPoolStats& iStats ) {
+            return  std::vector< uint64 >( iStats.schedulingLatencyHistogram, iStats.schedulingLatencyHistogram + FThreadPoolStats::NumHistogramBuckets );
+        } );
+
+
+
     /////////
     // FThreadPool
     py::class_< FThreadPool >( m, "FThreadPool" )
-        .def( py::init< uint32 >(), "workers"_a = FThreadPool::MaxWorkers() )
+        .def( py::init< uint32, eThreadPoolBackend, eThreadPoolAffinity >(), "workers"_a = FThreadPool::MaxWorkers(), "backend"_a = eThreadPoolBackend::ThreadPoolBackend_SharedQueue, "affinity"_a = eThreadPoolAffinity::ThreadPoolAffinity_None )
         .def( "WaitForCompletion", &FThreadPool::WaitForCompletion )
         .def( "SetNumWorkers", &FThreadPool::SetNumWorkers )
         .def( "GetNumWorkers", &FThreadPool::GetNumWorkers )
+        .def( "Backend", &FThreadPool::Backend )
+        .def( "Affinity", &FThreadPool::Affinity )
+        .def( "SetWaitSpinCount", &FThreadPool::SetWaitSpinCount )
+        .def( "WaitSpinCount", &FThreadPool::WaitSpinCount )
+        .def( "Stats", &FThreadPool::Stats )
         .def_static( "MaxWorkers", &FThreadPool::MaxWorkers );
 
 
@@ -625,10 +730,50 @@ PYBIND11_MODULE( pyULIS4, m ) {
     /////////
     // FCommandQueue
     py::class_< FCommandQueue >( m, "FCommandQueue" )
-        .def( py::init< FThreadPool& >(), "pool"_a )
+        .def( py::init< FThreadPool&, eCommandQueuePriority >(), "pool"_a, "priority"_a = eCommandQueuePriority::CommandQueuePriority_Normal )
         .def( "Flush", &FCommandQueue::Flush )
         .def( "Finish", &FCommandQueue::Finish )
-        .def( "Fence", &FCommandQueue::Fence );
+        .def( "Fence", &FCommandQueue::Fence )
+        .def( "SetHazardTracking", &FCommandQueue::SetHazardTracking )
+        .def( "HazardTracking", &FCommandQueue::HazardTracking )
+        .def( "SetCommandFusion", &FCommandQueue::SetCommandFusion )
+        .def( "CommandFusion", &FCommandQueue::CommandFusion )
+        .def( "Priority", &FCommandQueue::Priority )
+        .def( "SetMemoryBudget", &FCommandQueue::SetMemoryBudget )
+        .def( "MemoryBudget", &FCommandQueue::MemoryBudget )
+        .def( "MemoryInFlight", &FCommandQueue::MemoryInFlight )
+        .def_static( "AvailableMemoryBudget", &FCommandQueue::AvailableMemoryBudget, "fraction"_a = 0.5f )
+        .def( "BeginRecording", &FCommandQueue::BeginRecording )
+        .def( "EndRecording", &FCommandQueue::EndRecording )
+        .def( "Recording", &FCommandQueue::Recording )
+        .def( "Submit", []( FCommandQueue* queue, const FCommandList& iList, py::list iWaitList, FEvent* iEvent ) {
+                TArray< FEvent > arr;
+                arr.Reserve( iWaitList.size() );
+                for( auto it = iWaitList.begin(); it != iWaitList.end(); ++it )
+                    arr.PushBack( (*it).cast< FEvent >() );
+                queue->Submit( iList, static_cast< uint32 >( arr.Size() ), arr.Data(), iEvent );
+            }
+            , "list"_a, "waitList"_a = py::list(), "event"_a = nullptr );
+
+
+
+    /////////
+    // FCommandList
+    py::class_< FCommandList >( m, "FCommandList" )
+        .def( py::init<>() )
+        .def( "Size", &FCommandList::Size )
+        .def( "IsEmpty", &FCommandList::IsEmpty );
+
+
+
+    /////////
+    // FSchedulingTrace
+    py::class_< FSchedulingTrace >( m, "FSchedulingTrace" )
+        .def_static( "Available", &FSchedulingTrace::Available )
+        .def_static( "Start", &FSchedulingTrace::Start )
+        .def_static( "Stop", &FSchedulingTrace::Stop )
+        .def_static( "Running", &FSchedulingTrace::Running )
+        .def_static( "Dump", &FSchedulingTrace::Dump, "path"_a );
 
 
 
@@ -662,7 +807,15 @@ PYBIND11_MODULE( pyULIS4, m ) {
         .def_readonly_static( "AsyncMultiScanlines",    &FSchedulePolicy::AsyncMultiScanlines   )
         .def_readonly_static( "AsyncMonoScanlines",     &FSchedulePolicy::AsyncMonoScanlines    )
         .def_readonly_static( "MultiScanlines",         &FSchedulePolicy::MultiScanlines        )
-        .def_readonly_static( "MonoScanlines",          &FSchedulePolicy::MonoScanlines         );
+        .def_readonly_static( "MonoScanlines",          &FSchedulePolicy::MonoScanlines         )
+        .def_readonly_static( "AsyncAuto",              &FSchedulePolicy::AsyncAuto             )
+        .def_readonly_static( "Auto",                   &FSchedulePolicy::Auto                  )
+        .def_readonly_static( "AsyncMultiTiles",        &FSchedulePolicy::AsyncMultiTiles       )
+        .def_readonly_static( "MultiTiles",             &FSchedulePolicy::MultiTiles            )
+        .def_readonly_static( "AsyncMonoTiles",         &FSchedulePolicy::AsyncMonoTiles        )
+        .def_readonly_static( "MonoTiles",              &FSchedulePolicy::MonoTiles             )
+        .def_readonly_static( "AsyncInline",            &FSchedulePolicy::AsyncInline           )
+        .def_readonly_static( "Inline",                 &FSchedulePolicy::Inline                );
 
 
 
@@ -710,6 +863,7 @@ PYBIND11_MODULE( pyULIS4, m ) {
         .def( "MaxWorkers",             &FHardwareMetrics::MaxWorkers               )
         .def( "L1CacheSize",            &FHardwareMetrics::L1CacheSize              )
         .def( "L1CacheLineSize",        &FHardwareMetrics::L1CacheLineSize          )
+        .def( "L2CacheSize",            &FHardwareMetrics::L2CacheSize              )
         .def( "Field",                  &FHardwareMetrics::Field                    );
 
 
@@ -1687,6 +1841,17 @@ PYBIND11_MODULE( pyULIS4, m ) {
         .def( "Fence", &FContext::Fence )
         .def( "Wait", &FContext::Wait )
         .def( "Format", &FContext::Format )
+        .def( "SetMetricsEnabled", &FContext::SetMetricsEnabled )
+        .def( "MetricsEnabled", &FContext::MetricsEnabled )
+        .def( "ResetMetrics", &FContext::ResetMetrics )
+        .def( "OperationMetrics", []( const FContext* ctx ) {
+            TArray< FOperationMetrics > metrics;
+            ctx->OperationMetrics( &metrics );
+            py::list list;
+            for( uint64 i = 0; i < metrics.Size(); ++i )
+                list.append( metrics[i] );
+            return  list;
+        } )
         .def( "FinishEventNo_OP", &FContext::FinishEventNo_OP )
         .def( "Dummy_OP", &FContext::Dummy_OP )
         .def( "AccumulateSample", ctxCallAdapter< const FBlock&, FColor*, const FRectI&, const FSchedulePolicy& >( &FContext::AccumulateSample )
@@ -434,7 +434,26 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
     enum_< eEventStatus >( "eEventStatus" )
         .value( "EventStatus_Idle",     eEventStatus::EventStatus_Idle      )
         .value( "EventStatus_Queued",   eEventStatus::EventStatus_Queued    )
-        .value( "EventStatus_Finished", eEventStatus::EventStatus_Finished  );
+        .value( "EventStatus_Finished", eEventStatus::EventStatus_Finished  )
+        .value( "EventStatus_Cancelled", eEventStatus::EventStatus_Cancelled );
+
+
+
+    /////////
+    // eDispatchPath
+    enum_< eDispatchPath >( "eDispatchPath" )
+        .value( "DispatchPath_MEM", eDispatchPath::DispatchPath_MEM )
+        .value( "DispatchPath_SSE", eDispatchPath::DispatchPath_SSE )
+        .value( "DispatchPath_AVX", eDispatchPath::DispatchPath_AVX );
+
+
+
+    /////////
+    // eCommandQueuePriority
+    enum_< eCommandQueuePriority >( "eCommandQueuePriority" )
+        .value( "CommandQueuePriority_High",    eCommandQueuePriority::CommandQueuePriority_High    )
+        .value( "CommandQueuePriority_Normal",  eCommandQueuePriority::CommandQueuePriority_Normal  )
+        .value( "CommandQueuePriority_Low",     eCommandQueuePriority::CommandQueuePriority_Low     );
 
 
 
@@ -450,7 +469,8 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
     // eScheduleRunPolicy
     enum_< eScheduleRunPolicy >( "eScheduleRunPolicy" )
         .value( "ScheduleRun_Mono",     eScheduleRunPolicy::ScheduleRun_Mono    )
-        .value( "ScheduleRun_Multi",    eScheduleRunPolicy::ScheduleRun_Multi   );
+        .value( "ScheduleRun_Multi",    eScheduleRunPolicy::ScheduleRun_Multi   )
+        .value( "ScheduleRun_Inline",   eScheduleRunPolicy::ScheduleRun_Inline  );
 
 
 
@@ -458,7 +478,9 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
     // eScheduleModePolicy
     enum_< eScheduleModePolicy >( "eScheduleModePolicy" )
         .value( "ScheduleMode_Scanlines",   eScheduleModePolicy::ScheduleMode_Scanlines )
-        .value( "ScheduleMode_Chunks",      eScheduleModePolicy::ScheduleMode_Chunks    );
+        .value( "ScheduleMode_Chunks",      eScheduleModePolicy::ScheduleMode_Chunks    )
+        .value( "ScheduleMode_Auto",        eScheduleModePolicy::ScheduleMode_Auto      )
+        .value( "ScheduleMode_Tiles",       eScheduleModePolicy::ScheduleMode_Tiles     );
 
 
 
@@ -585,7 +607,8 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
         .constructor<>()
         .constructor< const FOnEventComplete& >()
         .function( "Status", &FEvent::Status )
-        .function( "Wait", &FEvent::Wait );
+        .function( "Wait", &FEvent::Wait )
+        .function( "Cancel", &FEvent::Cancel );
     register_vector< FEvent >( "FEventVector" );
 
 
@@ -622,9 +645,39 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
     // FCommandQueue
     class_< FCommandQueue >( "FCommandQueue" )
         .constructor< FThreadPool& >()
+        .constructor< FThreadPool&, eCommandQueuePriority >()
         .function( "Flush", &FCommandQueue::Flush )
         .function( "Finish", &FCommandQueue::Finish )
-        .function( "Fence", &FCommandQueue::Fence );
+        .function( "Fence", &FCommandQueue::Fence )
+        .function( "SetHazardTracking", &FCommandQueue::SetHazardTracking )
+        .function( "HazardTracking", &FCommandQueue::HazardTracking )
+        .function( "SetCommandFusion", &FCommandQueue::SetCommandFusion )
+        .function( "CommandFusion", &FCommandQueue::CommandFusion )
+        .function( "Priority", &FCommandQueue::Priority )
+        .function( "BeginRecording", &FCommandQueue::BeginRecording )
+        .function( "EndRecording", &FCommandQueue::EndRecording )
+        .function( "Recording", &FCommandQueue::Recording )
+        .function( "Submit", optional_override( []( FCommandQueue& self, const FCommandList& iList ) { self.Submit( iList ); } ) );
+
+
+
+    /////////
+    // FCommandList
+    class_< FCommandList >( "FCommandList" )
+        .constructor<>()
+        .function( "Size", &FCommandList::Size )
+        .function( "IsEmpty", &FCommandList::IsEmpty );
+
+
+
+    /////////
+    // FSchedulingTrace
+    class_< FSchedulingTrace >( "FSchedulingTrace" )
+        .class_function( "Available", &FSchedulingTrace::Available )
+        .class_function( "Start", &FSchedulingTrace::Start )
+        .class_function( "Stop", &FSchedulingTrace::Stop )
+        .class_function( "Running", &FSchedulingTrace::Running )
+        .class_function( "Dump", &FSchedulingTrace::Dump );
 
 
 
@@ -652,7 +705,15 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
         .class_property( "AsyncMultiScanlines", (const FSchedulePolicy*)&FSchedulePolicy::AsyncMultiScanlines )
         .class_property( "AsyncMonoScanlines",  (const FSchedulePolicy*)&FSchedulePolicy::AsyncMonoScanlines  )
         .class_property( "MultiScanlines",      (const FSchedulePolicy*)&FSchedulePolicy::MultiScanlines      )
-        .class_property( "MonoScanlines",       (const FSchedulePolicy*)&FSchedulePolicy::MonoScanlines       );
+        .class_property( "MonoScanlines",       (const FSchedulePolicy*)&FSchedulePolicy::MonoScanlines       )
+        .class_property( "AsyncAuto",           (const FSchedulePolicy*)&FSchedulePolicy::AsyncAuto           )
+        .class_property( "Auto",                (const FSchedulePolicy*)&FSchedulePolicy::Auto                )
+        .class_property( "AsyncMultiTiles",     (const FSchedulePolicy*)&FSchedulePolicy::AsyncMultiTiles     )
+        .class_property( "MultiTiles",          (const FSchedulePolicy*)&FSchedulePolicy::MultiTiles          )
+        .class_property( "AsyncMonoTiles",      (const FSchedulePolicy*)&FSchedulePolicy::AsyncMonoTiles      )
+        .class_property( "MonoTiles",           (const FSchedulePolicy*)&FSchedulePolicy::MonoTiles           )
+        .class_property( "AsyncInline",         (const FSchedulePolicy*)&FSchedulePolicy::AsyncInline         )
+        .class_property( "Inline",              (const FSchedulePolicy*)&FSchedulePolicy::Inline              );
 
 
 
@@ -700,6 +761,7 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
         .function( "MaxWorkers",                &FHardwareMetrics::MaxWorkers               )
         .function( "L1CacheSize",               &FHardwareMetrics::L1CacheSize              )
         .function( "L1CacheLineSize",           &FHardwareMetrics::L1CacheLineSize          )
+        .function( "L2CacheSize",               &FHardwareMetrics::L2CacheSize              )
         .function( "Field",                     &FHardwareMetrics::Field                    );
 
 
@@ -1637,6 +1699,9 @@ EMSCRIPTEN_BINDINGS( wULIS4 ) {
         .function( "Fence", &FContext::Fence )
         .function( "Wait", &FContext::Wait )
         .function( "Format", &FContext::Format )
+        .function( "SetMetricsEnabled", &FContext::SetMetricsEnabled )
+        .function( "MetricsEnabled", &FContext::MetricsEnabled )
+        .function( "ResetMetrics", &FContext::ResetMetrics )
         //.function( "FontEngine", static_cast< FFontEngine& ( FContext::* )() >( &FContext::FontEngine ) )
         .function( "FinishEventNo_OP", &FContext::FinishEventNo_OP, allow_raw_pointers() )
         .function( "Dummy_OP", &FContext::Dummy_OP, allow_raw_pointers() )
@@ -18,11 +18,17 @@
 #include "Image/Gradient.h"
 #include "Math/Geometry/Rectangle.h"
 #include "Math/Geometry/Vector.h"
+#include "Memory/Array.h"
+#include "Scheduling/CommandMetrics.h"
 #include "Scheduling/SchedulePolicy.h"
 #include "System/CPUInfo/CPUInfo.h"
 #include <functional>
+#include <memory>
 
 ULIS_NAMESPACE_BEGIN
+class FCommand;
+class FMetricsTable;
+
 /////////////////////////////////////////////////////
 /// @class      FContext
 /// @brief      The FContext class provides a monolithic context for
@@ -39,6 +45,11 @@ ULIS_NAMESPACE_BEGIN
 ///             FContext can be expected to reach a size in the Ko magnitude,
 ///             there is a small overhead during instanciation at runtime.
 ///
+///             The context can collect the FCommandMetrics of the commands
+///             it issues, readable through their FEvent, and sum them per
+///             operation, see SetMetricsEnabled() and OperationMetrics().
+///             Collecting metrics costs two clock reads per job.
+///
 ///             \sa FBlock
 ///             \sa FThreadPool
 ///             \sa FCPUInfo
@@ -99,6 +110,28 @@ public:
     */
     eFormat Format() const;
 
+    /*!
+        Enable or disable the collection of metrics, for the commands issued
+        from now on. Disabled by default.
+    */
+    void SetMetricsEnabled( bool iEnable );
+
+    /*!
+        Check whether the metrics are collected.
+    */
+    bool MetricsEnabled() const;
+
+    /*!
+        Get the metrics of the finished commands issued with metrics enabled,
+        summed per operation, since the last ResetMetrics().
+    */
+    void OperationMetrics( TArray< FOperationMetrics >* oMetrics ) const;
+
+    /*!
+        Forget the metrics summed per operation.
+    */
+    void ResetMetrics();
+
 public:
     /*!
         Internal tool for notifying an user event the task is a no-op
@@ -106,6 +139,36 @@ public:
     ulError FinishEventNo_OP( FEvent* iEvent, ulError iError );
     ulError Dummy_OP( uint32 iNumWait, const FEvent* iWaitList, FEvent* iEvent );
 
+    /*!
+        Internal tool for running a function as a single job on the pool, the
+        event is done once it returns.
+    */
+    ulError Generic_OP( const std::function< void() >& iInvocation, uint32 iNumWait, const FEvent* iWaitList, FEvent* iEvent );
+
+    /*!
+        Internal tool for resizing a part of a destination: iSourceRect is
+        scaled to iDestinationRect, but only the pixels in iDestinationRoi
+        are written, so that the parts of a split resize match the whole.
+        The rects are not clipped, iSourceRect may exceed iSource as long as
+        the pixels sampled for iDestinationRoi are inside.
+    */
+    ulError
+    ResizePart(
+          const FBlock& iSource
+        , FBlock& iDestination
+        , const FRectI& iSourceRect
+        , const FRectF& iDestinationRect
+        , const FRectI& iDestinationRoi
+        , eResamplingMethod iResamplingMethod
+        , eBorderMode iBorderMode
+        , const ISample& iBorderValue
+        , const FBlock* iOptionalSummedAreaTable
+        , const FSchedulePolicy& iPolicy
+        , uint32 iNumWait
+        , const FEvent* iWaitList
+        , FEvent* iEvent
+    );
+
 public:
 /////////////////////////////////////////////////////
 // Layers
@@ -984,6 +1047,355 @@ public:
         , FEvent* iEvent = nullptr
     );
 
+/////////////////////////////////////////////////////
+// Sparse
+    /*!
+        Perform a blend operation with a tiled block, as a source, as a
+        backdrop, or both. The geometry follows Blend(), but a tiled block
+        has no bounds: the iSourceRect of a tiled source defaults to the
+        bounds of its tiles, and a tiled backdrop is not clipped. A
+        FLargeBlock is clipped to its bounds, which are also its default
+        rect.
+
+        Only the tiles of the backdrop that receive a part of the source
+        that is not empty are processed, with one command per tile, and the
+        empty tiles of the source are skipped unless the alpha mode lowers
+        the alpha of the backdrop. The layout of a tiled backdrop is updated
+        when the operation is pushed.
+
+        \sa FTiledBlock
+    */
+    ulError
+    Blend(
+          const FTiledBlock& iSource
+        , FTiledBlock& iBackdrop
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , eBlendMode iBlendingMode = Blend_Normal
+        , eAlphaMode iAlphaMode = Alpha_Normal
+        , ufloat iOpacity = 1.0f
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Blend() */
+    ulError
+    Blend(
+          const FBlock& iSource
+        , FTiledBlock& iBackdrop
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , eBlendMode iBlendingMode = Blend_Normal
+        , eAlphaMode iAlphaMode = Alpha_Normal
+        , ufloat iOpacity = 1.0f
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Blend() */
+    ulError
+    Blend(
+          const FTiledBlock& iSource
+        , FBlock& iBackdrop
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , eBlendMode iBlendingMode = Blend_Normal
+        , eAlphaMode iAlphaMode = Alpha_Normal
+        , ufloat iOpacity = 1.0f
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform a clear operation in a tiled block. The iRect defaults to the
+        bounds of its tiles. The tiles fully inside iRect are released, and
+        the other ones are cleared only if they are not empty.
+
+        \sa FTiledBlock
+    */
+    ulError
+    Clear(
+          FTiledBlock& iBlock
+        , const FRectI& iRect = FRectI::Auto
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform a conv operation with a tiled block, as a source, as a
+        destination, or both. The geometry follows ConvertFormat(), with the
+        rules of the tiled Blend(). The blocks of the same format are copied
+        with Copy().
+
+        The empty tiles of the source stay empty in the destination, where
+        they read as zeros in its format.
+
+        \sa FTiledBlock
+        \sa FLargeBlock
+    */
+    ulError
+    ConvertFormat(
+          const FTiledBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa ConvertFormat() */
+    ulError
+    ConvertFormat(
+          const FBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa ConvertFormat() */
+    ulError
+    ConvertFormat(
+          const FTiledBlock& iSource
+        , FBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform a copy operation with a tiled block, as a source, as a
+        destination, or both. The geometry follows Copy(), with the rules of
+        the tiled Blend().
+
+        Between two tiled blocks of the same pool, the tiles of the
+        destination that are fully covered by a tile of the source are
+        shared with it, without any pixel work, when the copy is aligned on
+        the tiles. Empty parts of the source are cleared in the destination.
+
+        \sa FTiledBlock
+    */
+    ulError
+    Copy(
+          const FTiledBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Copy() */
+    ulError
+    Copy(
+          const FBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Copy() */
+    ulError
+    Copy(
+          const FTiledBlock& iSource
+        , FBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FVec2I& iPosition = FVec2I( 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform a fill operation in a tiled block. The iRect defaults to the
+        bounds of its tiles. The tiles fully inside iRect all share a single
+        filled tile.
+
+        \sa FTiledBlock
+    */
+    ulError
+    Fill(
+          FTiledBlock& iBlock
+        , const ISample& iColor = FColor::RGBA8( 0, 0, 0 )
+        , const FRectI& iRect = FRectI::Auto
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Page in the tiles of a tiled block that hold the pixels of iRect, if
+        they are swapped out, as commands on the pool. The event is done when
+        they are all resident, they stay pinned until then. The iRect
+        defaults to the bounds of its tiles.
+
+        The other operations on tiled blocks page in the tiles they touch
+        when they are called. Prefetching the tiles that are about to be
+        used, such as the ones around a viewport, hides the latency of the
+        scratch file.
+
+        \sa FTiledBlock
+        \sa FTilePool::EnableSwap()
+    */
+    ulError
+    Prefetch(
+          const FTiledBlock& iBlock
+        , const FRectI& iRect = FRectI::Auto
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform a resize operation with a tiled block, as a source, as a
+        destination, or both. The geometry follows Resize(), with the rules
+        of the tiled Blend(). Each tile of the destination is resized with
+        the scale of the whole iDestinationRect, so that the result does not
+        depend on the tiles.
+
+        With a tiled source, the part of the source read by each tile of the
+        destination is gathered in a temporary block first, split in several
+        parts when it is large, and freed once the tile is resized. Set a
+        memory budget on the queue to bound the memory of the temporary
+        blocks of a large downscale. The destination tiles that only read
+        empty tiles are emptied if the border mode is Border_Transparent.
+
+        \sa FTiledBlock
+        \sa FLargeBlock
+        \sa FCommandQueue::SetMemoryBudget()
+    */
+    ulError
+    Resize(
+          const FTiledBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FRectF& iDestinationRect = FRectF::Auto
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Resize() */
+    ulError
+    Resize(
+          const FBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FRectF& iDestinationRect = FRectF::Auto
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa Resize() */
+    ulError
+    Resize(
+          const FTiledBlock& iSource
+        , FBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FRectF& iDestinationRect = FRectF::Auto
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*!
+        Perform an affine transform operation with a tiled block, as a
+        source, as a destination, or both. The geometry follows
+        TransformAffine(), with the rules of the tiled Blend().
+
+        With a tiled source, the part of the source read by each tile of the
+        destination is gathered in a temporary block first, and the
+        destination tiles that only read empty tiles are emptied. Only the
+        Border_Transparent and Border_Constant border modes are supported
+        with a tiled source.
+
+        \sa FTiledBlock
+    */
+    ulError
+    TransformAffine(
+          const FTiledBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FMat3F& iTransformMatrix = FMat3F()
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa TransformAffine() */
+    ulError
+    TransformAffine(
+          const FBlock& iSource
+        , FTiledBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FMat3F& iTransformMatrix = FMat3F()
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
+    /*! \sa TransformAffine() */
+    ulError
+    TransformAffine(
+          const FTiledBlock& iSource
+        , FBlock& iDestination
+        , const FRectI& iSourceRect = FRectI::Auto
+        , const FMat3F& iTransformMatrix = FMat3F()
+        , eResamplingMethod iResamplingMethod = eResamplingMethod::Resampling_Bilinear
+        , eBorderMode iBorderMode = eBorderMode::Border_Transparent
+        , const ISample& iBorderValue = FColor::RGBA8( 0, 0, 0 )
+        , const FSchedulePolicy& iPolicy = FSchedulePolicy::MonoChunk
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
 /////////////////////////////////////////////////////
 // IO
     /*!
@@ -2072,9 +2484,17 @@ public:
         , FEvent* iEvent = nullptr
     );
 
+private:
+    /*!
+        Push a command to the queue, iName is the name of the operation.
+    */
+    void Push( FCommand* iCommand, const char* iName );
+
 private:
     FCommandQueue& mCommandQueue;
     const FContextualDispatchTable* mContextualDispatchTable;
+    bool bMetrics;
+    std::shared_ptr< FMetricsTable > mMetrics;
 };
 
 ULIS_NAMESPACE_END
@@ -16,6 +16,7 @@
 ULIS_NAMESPACE_BEGIN
 
 ULIS_API void OnCleanup_FreeMemory( uint8* iData, void* iInfo );
+ULIS_API void OnCleanup_FreeAlignedMemory( uint8* iData, void* iInfo );
 
 template< typename R, typename ... Ts >
 class TCallback
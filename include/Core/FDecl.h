@@ -32,6 +32,7 @@ class   FGradient;
 class   FSanitizedGradient;
 class   FCPUInfo;
 class   FKernel;
+class   FLargeBlock;
 class   FStructuringElement;
 //struct  FMath;
 class   FPixel;
@@ -44,6 +45,8 @@ class   FTexture;
 #endif // ULIS_FEATURE_GPU_ENABLED
 class   FThreadPool;
 struct  FTileElement;
+class   FTiledBlock;
+class   FTilePool;
 class   FTransformation2D;
 class   FWString;
 class   IHasColorSpace;
@@ -272,7 +272,7 @@ namespace ULIS_NAMESPACE_NAME {}
 #define _mm_storeu_si32(p, a) (void)(*(int*)(p) = _mm_cvtsi128_si32((a)))
 #define _mm_loadu_si64(p) _mm_loadl_epi64((__m128i const*)(p))
 #define _mm_storeu_si64(p, a) (_mm_storel_epi64((__m128i*)(p), (a)))
-#else // GNUC 10+
+#elif __GNUC__ < 11 // GNUC 10
 //#define _mm_loadu_si32(p) _mm_castps_si128( _mm_load_ss((float*)p) )
 //#define _mm_storeu_si32(p, a) _mm_store_ss((float*)p, _mm_castsi128_ps(a))
 #define _mm_loadu_si32(p) _mm_cvtsi32_si128(*(unsigned int const*)(p))
@@ -43,6 +43,10 @@ typedef  int64      ulError;    ///< Used for errors reports defined below in th
 
 #define ULIS_FLOAT_MAX FLT_MAX
 
+/////////////////////////////////////////////////////
+// Alignment
+#define ULIS_SCANLINE_ALIGNMENT 64
+
 /////////////////////////////////////////////////////
 // Type codes
 #define ULIS_TYPE_UINT8    0x0
@@ -650,6 +654,20 @@ static const char* kwMipsLayout[] =
     , "MipsOnly"
 };
 
+/////////////////////////////////////////////////////
+// eScanlineLayout
+enum eScanlineLayout
+{
+      ScanlineLayout_Packed
+    , ScanlineLayout_Aligned
+};
+
+static const char* kwScanlineLayout[] =
+{
+      "Packed"
+    , "Aligned"
+};
+
 /////////////////////////////////////////////////////
 // eImageFormat
 enum eFileFormat {
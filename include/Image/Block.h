@@ -32,7 +32,13 @@ ULIS_NAMESPACE_BEGIN
 ///             The block has a format which specifies the type, memory layout,
 ///             color model, and other informations about the image.
 ///             The underlying data is always a regular contiguous buffer
-///             storage that lives on RAM with no alignment requirement.
+///             storage that lives on RAM. By default it has no alignment
+///             requirement and the scanlines are packed, but the block can
+///             also be allocated with an aligned scanline layout, where the
+///             base and the stride of the scanlines are aligned on
+///             ULIS_SCANLINE_ALIGNMENT bytes so that every scanline starts on
+///             a cache line. The padding at the end of the scanlines is not
+///             part of the image.
 ///
 ///             The FBlock class is very lightweight, the memory load is in the
 ///             data it points to, and the class never performs any kind of
@@ -86,6 +92,27 @@ public:
         , const FOnCleanupData& iOnCleanup = FOnCleanupData( &OnCleanup_FreeMemory )
     );
 
+    /*!
+    Construct a block with input size, format and scanline layout.
+
+    With ScanlineLayout_Aligned, the base of the bitmap data and the stride of
+    the scanlines are aligned on ULIS_SCANLINE_ALIGNMENT bytes, the scanlines
+    are padded as needed and BytesPerScanLine() reports the padded stride.
+    Planar formats keep packed scanlines, only their base is aligned. The data,
+    padding included, is left uninitialized and freed on destruction.
+
+    \warning The \a iWidth and \a iHeight parameters should be greater than
+    zero. A block doesn't own nor manage lifetime of its color-space.
+    */
+    FBlock(
+          uint16 iWidth
+        , uint16 iHeight
+        , eFormat iFormat
+        , eScanlineLayout iLayout
+        , const FColorSpace* iColorSpace = nullptr
+        , const FOnInvalidBlock& iOnInvalid = FOnInvalidBlock()
+    );
+
     /*!
     Construct a block from an existing external buffer with input size and
     format.
@@ -291,12 +318,21 @@ public:
     const uint8* PixelBits( uint16 iX, uint16 iY ) const;
 
     /*!
-    Return the numbers of bytes per scanline
+    Return the numbers of bytes per scanline, padding included.
 
     \sa BytesTotal()
+    \sa IsContiguous()
     */
     uint32 BytesPerScanLine() const;
 
+    /*!
+    Check wether the scanlines are packed, with no padding between them, so
+    that the pixels are one contiguous range of BytesTotal() bytes.
+
+    \sa BytesPerScanLine()
+    */
+    bool IsContiguous() const;
+
     /*!
     Return the numbers of bytes per plane
 
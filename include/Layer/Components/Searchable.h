@@ -31,7 +31,7 @@ public:
         ULIS_DEBUG_PRINTF( "TSearchable Created" )
     }
 
-    virtual ~TSearchable() = 0 {
+    virtual ~TSearchable() {
         ULIS_DEBUG_PRINTF( "TSearchable Destroyed" )
     }
 
@@ -25,13 +25,13 @@ class TAbstractLayerDrawable
 {
 public:
     using ILayer::ILayer;
-    virtual ~TAbstractLayerDrawable() override = 0 {
+    virtual ~TAbstractLayerDrawable() override {
         ULIS_DEBUG_PRINTF( "TAbstractLayerDrawable Destroyed" )
     }
 
     void OnChangeNotifiedInternal() override {
         ULIS_DEBUG_PRINTF( "Invalidation" )
-        InvalidImageCache();
+        this->InvalidImageCache();
     }
 };
 
@@ -80,7 +80,7 @@ public:
     }
 
     void SetParent( const tParent* iParent ) {
-        mParent = iParent;
+        (void)iParent;
         TOnParentChanged< Type >::Invoke( this, mParent );
     }
 
@@ -185,7 +185,7 @@ public:
         }
         mChildren.Clear();
 
-        mParent = iParent;
+        (void)iParent;
         TOnParentChanged< Type >::SetDelegate( iParentChangedDelegate );
         TOnNodeAdded< Type >::SetDelegate( iNodeAddedDelegate );
         TOnNodeRemoved< Type >::SetDelegate( iNodeRemovedDelegate );
@@ -0,0 +1,84 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandList.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FCommandList class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+
+ULIS_NAMESPACE_BEGIN
+class FCommandList_Private;
+
+/////////////////////////////////////////////////////
+/// @class      FCommandList
+/// @brief      The FCommandList class stores a recorded sequence of commands
+///             that can be submitted to a FCommandQueue over and over.
+/// @details    Commands are recorded once, with
+///             FCommandQueue::BeginRecording() and
+///             FCommandQueue::EndRecording(): every FContext call made on the
+///             queue in between is stored in the list instead of being
+///             queued. The jobs of the commands are built when the recording
+///             ends, and kept: FCommandQueue::Submit() then queues the
+///             recorded commands again without rebuilding anything, which is
+///             useful for work that is issued every frame with the same
+///             geometry, such as the composition of a viewport.
+///
+///             The list keeps the order between its commands: the wait lists
+///             given while recording, and the hazards tracked by the queue if
+///             enabled. Dependencies on commands outside of the list are not
+///             recorded, the wait list of Submit() stands for them. Events
+///             given while recording are never completed, the event given to
+///             Submit() completes when every command of the submission has.
+///
+///             The list refers to the blocks of its commands, it does not
+///             copy them: each submission reads their current content. Blocks
+///             can be rebound to other storage of the same size and format,
+///             for instance with FBlock::LoadFromData(), the jobs that point
+///             to the moved storage are then rebuilt on the next submission.
+///             Other parameters are fixed when recording, record the list
+///             again to change them.
+///
+///             A list can only be submitted again once its previous
+///             submission has been flushed, Submit() then waits for it to
+///             complete if needed.
+///
+///             \sa FCommandQueue
+///             \sa FContext
+class ULIS_API FCommandList
+{
+    friend class FCommandQueue;
+
+public:
+    /*! Destructor, waits for the commands of the list to complete. */
+    ~FCommandList();
+
+    /*! Constructor, builds an empty list. */
+    FCommandList();
+
+    FCommandList( const FCommandList& ) = delete;
+    FCommandList& operator=( const FCommandList& ) = delete;
+
+public:
+    /*!
+        Get the number of recorded commands, chains of fused commands count
+        as one.
+    */
+    uint64 Size() const;
+
+    /*!
+        Check whether the list holds no command.
+    */
+    bool IsEmpty() const;
+
+private:
+    FCommandList_Private* d;
+};
+
+ULIS_NAMESPACE_END
+
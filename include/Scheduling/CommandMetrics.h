@@ -0,0 +1,79 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandMetrics.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FCommandMetrics and FOperationMetrics structs.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+// eDispatchPath
+enum eDispatchPath : uint8
+{
+      DispatchPath_MEM = 0
+    , DispatchPath_SSE = 1
+    , DispatchPath_AVX = 2
+};
+
+/////////////////////////////////////////////////////
+/// @class      FCommandMetrics
+/// @brief      The FCommandMetrics struct holds the performance counters of
+///             a finished command, see FEvent::Metrics().
+/// @details    Times are in nanoseconds. The wall time goes from the time the
+///             command is queued to the time it finishes, it includes the
+///             time spent waiting for its dependencies and for a worker.
+///             The CPU time is the sum of the execution times of its jobs.
+///
+///             Bytes and pixels are derived from the regions of the blocks
+///             the command reads and writes, as declared for hazard tracking:
+///             they are left to zero for the operations that do not declare
+///             them. The pixels are the ones written.
+///
+///             The dispatch path is the instruction set the FContext selected
+///             for its operations, from its ePerformanceIntent and the host
+///             support. Operations without a specialization for it run their
+///             generic implementation.
+///
+///             The jobs of a chain of fused commands are counted on the first
+///             command of the chain.
+struct ULIS_API FCommandMetrics
+{
+    uint64 wallTime;
+    uint64 cpuTime;
+    uint64 numJobs;
+    uint64 bytesRead;
+    uint64 bytesWritten;
+    uint64 pixels;
+    eDispatchPath dispatchPath;
+};
+
+/////////////////////////////////////////////////////
+/// @class      FOperationMetrics
+/// @brief      The FOperationMetrics struct holds the sum of the
+///             FCommandMetrics of all the finished commands of an operation,
+///             see FContext::OperationMetrics().
+/// @details    The operation is the name of the FContext method that issued
+///             the commands, it lives as long as the library. Cancelled
+///             commands are not counted.
+struct ULIS_API FOperationMetrics
+{
+    const char* operation;
+    uint64 numCommands;
+    uint64 wallTime;
+    uint64 cpuTime;
+    uint64 numJobs;
+    uint64 bytesRead;
+    uint64 bytesWritten;
+    uint64 pixels;
+    eDispatchPath dispatchPath;
+};
+
+ULIS_NAMESPACE_END
+
@@ -14,15 +14,84 @@
 
 ULIS_NAMESPACE_BEGIN
 class FCommand;
+class FCommandList;
 class FCommandQueue_Private;
+class FEvent;
+
+/////////////////////////////////////////////////////
+// eCommandQueuePriority
+enum eCommandQueuePriority : uint8
+{
+      CommandQueuePriority_High = 0
+    , CommandQueuePriority_Normal
+    , CommandQueuePriority_Low
+    , NumCommandQueuePriorities
+};
 /////////////////////////////////////////////////////
 /// @class      FCommandQueue
 /// @brief      The FCommandQueue class provides a way to enqueue tasks for being
 ///             processed asynchronously in coordination with a FThreadPool
-/// @details    The FCommandQueue stores a TQueue of FCommand and schedules the
+/// @details    The FCommandQueue stores a list of FCommand and schedules the
 ///             commands on the FThreadPool.
 ///
+///             Several threads can push commands in the same queue at once,
+///             each through its own FContext bound to the queue. Pushes do
+///             not take any lock, unless hazard tracking, fusion or recording
+///             is enabled. The commands of each thread are queued in the
+///             order that thread pushed them, and Flush() issues all the
+///             commands pushed so far as a single batch. The settings of the
+///             queue and the recording must not change while other threads
+///             push commands.
+///
+///             Commands are free to run concurrently and in any order unless
+///             they are ordered with FEvent wait lists. Optionally, the queue
+///             can track hazards by itself: each pushed command then waits
+///             for the previous commands that access an overlapping region of
+///             the same FBlock, if at least one of the two accesses writes.
+///             Commands that work on disjoint regions, or on different blocks,
+///             still run concurrently. Blocks are identified by address, two
+///             FBlock objects that share external memory are not considered
+///             aliases.
+///
+///             Optionally too, consecutive point-wise commands that write the
+///             same region of the same FBlock, such as a Fill followed by a
+///             Blend and a Premultiply, can be fused in a single command
+///             before they are flushed. The fused chain runs by bands of
+///             scanlines, each band going through every command of the chain
+///             while it is still in cache. The commands of a chain run in
+///             order, and their events finish together.
+///
+///             Each queue has a priority class. Several queues can share the
+///             same FThreadPool, the pool then always picks the ready command
+///             and the job of highest priority first. A running job is never
+///             interrupted, but as soon as a worker is done with its current
+///             job it goes for the highest priority work available. This is
+///             useful to keep interactive work responsive, such as brush
+///             strokes, while background work such as exports runs on the
+///             same pool at a lower priority.
+///
+///             Fence() and Finish() only wait for the commands issued by this
+///             queue, not for the work of the other queues of the pool.
+///
+///             Commands can also be recorded in a FCommandList instead of
+///             being queued, and the list submitted later on, as many times
+///             as needed, without building the commands and their jobs again.
+///
+///             Optionally, the queue can bound the memory of its work in
+///             flight. Each pushed command is given a footprint, the size of
+///             the blocks it accesses, or of the image it loads. When the
+///             footprint of the commands pushed and not finished yet would
+///             exceed the memory budget, the push flushes the queue and
+///             blocks until enough of them finish. A producer that allocates
+///             blocks for its next commands is slowed down the same way. A
+///             command larger than the budget runs alone. Commands submitted
+///             from a FCommandList are not accounted. A push that waits for
+///             the budget must not be made from a command callback, nor
+///             while the commands in flight wait for an event that is not
+///             issued yet.
+///
 ///             \sa FCommand
+///             \sa FCommandList
 ///             \sa FThreadPool
 class ULIS_API FCommandQueue
 {
@@ -33,7 +102,7 @@ public:
     ~FCommandQueue();
 
     /*! Constructor */
-    FCommandQueue( FThreadPool& iPool );
+    FCommandQueue( FThreadPool& iPool, eCommandQueuePriority iPriority = CommandQueuePriority_Normal );
 
     FCommandQueue( const FCommandQueue& ) = delete;
     FCommandQueue& operator=( const FCommandQueue& ) = delete;
@@ -54,6 +123,89 @@ public:
     */
     void Fence();
 
+    /*!
+        Enable or disable the automatic hazard tracking, disabled by default.
+        It only applies to commands pushed after the call.
+    */
+    void SetHazardTracking( bool iEnable );
+
+    /*!
+        Check whether the automatic hazard tracking is enabled.
+    */
+    bool HazardTracking() const;
+
+    /*!
+        Enable or disable the fusion of point-wise commands, disabled by
+        default. It only applies to commands pushed after the call.
+    */
+    void SetCommandFusion( bool iEnable );
+
+    /*!
+        Check whether the fusion of point-wise commands is enabled.
+    */
+    bool CommandFusion() const;
+
+    /*!
+        Get the priority class of the queue.
+    */
+    eCommandQueuePriority Priority() const;
+
+    /*!
+        Set the memory budget of the commands in flight, in bytes, zero
+        disables it, which is the default. It only applies to commands pushed
+        after the call.
+    */
+    void SetMemoryBudget( uint64 iBytes );
+
+    /*!
+        Get the memory budget of the commands in flight, in bytes.
+    */
+    uint64 MemoryBudget() const;
+
+    /*!
+        Get the footprint of the commands pushed and not finished yet, in
+        bytes, while the memory budget is enabled.
+    */
+    uint64 MemoryInFlight() const;
+
+    /*!
+        Get a memory budget of iFraction of the RAM currently available on
+        the system, see FMemoryInfo.
+    */
+    static uint64 AvailableMemoryBudget( ufloat iFraction = 0.5f );
+
+    /*!
+        Start recording in oList, which is cleared first. Until EndRecording()
+        is called, the commands pushed in the queue are stored in the list
+        instead of being queued.
+    */
+    void BeginRecording( FCommandList& oList );
+
+    /*!
+        Stop recording, and build the jobs of the recorded commands.
+    */
+    void EndRecording();
+
+    /*!
+        Check whether the queue is recording.
+    */
+    bool Recording() const;
+
+    /*!
+        Queue the commands of iList again, they are issued with the next
+        Flush() or Finish(). The commands of the list that do not wait for
+        others of the list wait for iWaitList, and iEvent completes once all
+        the commands of the list have. If the list was already submitted,
+        this waits for the previous submission to complete first, it must
+        have been flushed.
+    */
+    void Submit(
+          const FCommandList& iList
+        , uint32 iNumWait = 0
+        , const FEvent* iWaitList = nullptr
+        , FEvent* iEvent = nullptr
+    );
+
 private:
     FCommandQueue_Private* d;
 };
@@ -12,6 +12,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "Core/Callback.h"
+#include "Scheduling/CommandMetrics.h"
 
 ULIS_NAMESPACE_BEGIN
 class FEvent_Private;
@@ -23,6 +24,7 @@ enum eEventStatus : uint8
       EventStatus_Idle
     , EventStatus_Queued
     , EventStatus_Finished
+    , EventStatus_Cancelled
 };
 
 /////////////////////////////////////////////////////
@@ -36,7 +38,26 @@ enum eEventStatus : uint8
 ///             in conjunction with FThreadPool, FSchedulePolicy, FCommandQueue
 ///             and FContext.
 ///
+///             The command of an event can be cancelled with Cancel(), as
+///             long as it is not finished. Its jobs that did not start yet
+///             are dropped, the ones already running complete, and the
+///             destination is left partially processed. A command that still
+///             waits for its dependencies is dropped as soon as they finish,
+///             before its jobs are even built. The commands that have a
+///             cancelled event in their wait list are cancelled too, but not
+///             the ones that are only ordered after it by hazard tracking.
+///             The event then ends with the EventStatus_Cancelled status,
+///             which satisfies Wait() and wait lists just like
+///             EventStatus_Finished. The commands of a fused chain run as
+///             one: only the first command of the chain can be cancelled, and
+///             it cancels the whole chain.
+///
+///             If the FContext that issued the command collects metrics, see
+///             FContext::SetMetricsEnabled(), the performance counters of the
+///             command can be read with Metrics() once it is finished.
+///
 ///             \sa FContext
+///             \sa FCommandMetrics
 ///             \sa FSchedulePolicy
 ///             \sa FThreadPool
 ///             \sa FCPUInfo
@@ -59,6 +80,14 @@ public:
 
     eEventStatus Status() const;
     void Wait() const;
+    bool Cancel();
+
+    /*!
+        Get the performance counters of the command.
+        Returns false if the command is not finished yet, or if its metrics
+        were not collected.
+    */
+    bool Metrics( FCommandMetrics* oMetrics ) const;
 
     static FEvent NoOP();
 
@@ -21,11 +21,14 @@ enum eScheduleTimePolicy : uint8 {
 enum eScheduleRunPolicy : uint8 {
       ScheduleRun_Mono  = 0
     , ScheduleRun_Multi = 1
+    , ScheduleRun_Inline = 2
 };
 
 enum eScheduleModePolicy : uint8 {
       ScheduleMode_Scanlines = 0
     , ScheduleMode_Chunks = 1
+    , ScheduleMode_Auto = 2
+    , ScheduleMode_Tiles = 3
 };
 
 enum eScheduleParameterPolicy : uint8 {
@@ -43,6 +46,36 @@ enum eScheduleParameterPolicy : uint8 {
 ///             Wether the scheduling is done on a chunk basis, or on a scanline
 ///             basis, for example.
 ///
+///             With ScheduleMode_Auto, the number of jobs and their size are
+///             chosen for each command from the size of the region it
+///             processes, an estimate of the cost of the operation per pixel,
+///             the number of workers of the pool and the cache sizes reported
+///             by FCPUInfo. Small commands run as a single job, large ones are
+///             split in enough jobs to keep every worker busy, without making
+///             jobs so short that scheduling them would cost more than the
+///             work they do. Chunks are used when the operation allows it,
+///             scanlines otherwise. The parameter policy and value are
+///             ignored.
+///
+///             With ScheduleMode_Tiles, the destination rect is split in
+///             square tiles which side is the parameter value, or
+///             DefaultTileSize if the value is not positive. Each tile is a
+///             job, or all the tiles run in order in a single job for a mono
+///             run. This suits operations that sample a 2D neighbourhood of
+///             the source, such as convolutions, transforms and resizes, as
+///             the source pixels read by a job stay in cache. Operations that
+///             do not support tiles run on scanlines instead.
+///
+///             With ScheduleRun_Inline, the command runs as a single job on
+///             the thread that flushes its queue, instead of going through
+///             the scheduler thread and a worker, if all the commands it
+///             waits for are finished at that time. Otherwise it is scheduled
+///             on the pool as with ScheduleRun_Mono. This suits tiny
+///             commands, for which the dispatch would cost more than the
+///             work. With ScheduleMode_Auto, commands are run inline when
+///             their estimated duration is below a threshold, see
+///             FScheduleCostModel.
+///
 ///             \sa FContext
 ///             \sa FThreadPool
 ///             \sa FCPUInfo
@@ -89,6 +122,17 @@ public:
     static const FSchedulePolicy AsyncMonoScanlines;
     static const FSchedulePolicy MultiScanlines;
     static const FSchedulePolicy MonoScanlines;
+    static const FSchedulePolicy AsyncAuto;
+    static const FSchedulePolicy Auto;
+    static const FSchedulePolicy AsyncMultiTiles;
+    static const FSchedulePolicy MultiTiles;
+    static const FSchedulePolicy AsyncMonoTiles;
+    static const FSchedulePolicy MonoTiles;
+    static const FSchedulePolicy AsyncInline;
+    static const FSchedulePolicy Inline;
+
+    /*! Tile side used by ScheduleMode_Tiles when no value is specified. */
+    static constexpr int64 DefaultTileSize = 64;
 
 private:
     eScheduleTimePolicy         mTime;
@@ -0,0 +1,74 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingTrace.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FSchedulingTrace class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include <string>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FSchedulingTrace
+/// @brief      The FSchedulingTrace class provides a timeline of the work done
+///             by all FThreadPool, that can be exported for chrome://tracing
+///             or Perfetto.
+/// @details    While the trace runs, every thread records:
+///             - the execution of each job, named after the operation of its
+///               command, on the worker that runs it.
+///             - the lifetime of each command, from the time it is queued in
+///               a FCommandQueue to the time it is scheduled, when its wait
+///               list is complete, and then to the time it finishes.
+///             - the waits for completion, through
+///               FThreadPool::WaitForCompletion(), FCommandQueue::Fence() or
+///               FEvent::Wait().
+///
+///             Dump() writes the records in the Chrome trace event JSON
+///             format. Jobs and waits are complete events on the track of
+///             their thread, commands are async events linked to their jobs
+///             by the command id.
+///
+///             The trace is disabled by default, it then costs one relaxed
+///             atomic load per job and per command. It can also be compiled
+///             out altogether with the ULIS_BUILD_TRACE CMake option, in
+///             which case Start() does nothing and Dump() fails.
+///
+///             \sa FThreadPool
+///             \sa FCommandQueue
+class ULIS_API FSchedulingTrace
+{
+private:
+    ~FSchedulingTrace() = delete;
+    FSchedulingTrace() = delete;
+    FSchedulingTrace( const FSchedulingTrace& ) = delete;
+    FSchedulingTrace( FSchedulingTrace&& ) = delete;
+
+public:
+    /*! Check whether the trace is compiled in. */
+    static bool Available();
+
+    /*! Clear the previous records and start recording. */
+    static void Start();
+
+    /*! Stop recording, the records are kept until the next Start(). */
+    static void Stop();
+
+    /*! Check whether the trace is recording. */
+    static bool Running();
+
+    /*!
+        Write the records as Chrome trace event JSON at iPath.
+        Returns false if the file cannot be written, or if the trace is
+        compiled out.
+    */
+    static bool Dump( const std::string& iPath );
+};
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,64 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         LargeBlock.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FLargeBlock class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Sparse/TiledBlock.h"
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FLargeBlock
+/// @brief      The FLargeBlock class is an image of fixed size, made of
+///             tiles, that can be larger than the 65535 pixels of a FBlock.
+/// @details    A large block is a FTiledBlock with bounds: its size is
+///             stored on 32 bits, and the FContext operations on tiled
+///             blocks are clipped to its rect, which is also their default
+///             rect. The pixels are only allocated for the tiles that are
+///             written, the other ones read as zeros, so that a poster or a
+///             gigapixel scan only costs the tiles it actually uses.
+///
+///             Every FContext operation on tiled blocks accepts a large
+///             block, and additionally Resize() and ConvertFormat(). They
+///             issue one command per tile, so that the work is split per
+///             tile rather than per scanline.
+///
+///             The width and height are limited to the range of the 32 bits
+///             signed coordinates of FRectI.
+///
+///             \sa FTiledBlock
+///             \sa FTilePool
+class ULIS_API FLargeBlock
+    : public FTiledBlock
+{
+public:
+    /*! Destructor, releases the tiles. */
+    ~FLargeBlock() override;
+
+    /*! Constructor, creates an empty large block that uses the pool. */
+    FLargeBlock(
+          FTilePool& iPool
+        , uint32 iWidth
+        , uint32 iHeight
+    );
+
+public:
+    /*! Width of the block, in pixels. */
+    uint32 Width() const;
+
+    /*! Height of the block, in pixels. */
+    uint32 Height() const;
+
+    /*! Number of pixels of the block. */
+    uint64 Area() const;
+};
+
+ULIS_NAMESPACE_END
+
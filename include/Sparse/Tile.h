@@ -0,0 +1,73 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         Tile.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FTileElement struct.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FTileElement
+/// @brief      The FTileElement struct is a tile of a FTiledBlock, allocated
+///             and recycled by a FTilePool.
+/// @details    A tile is referenced by the entries of the tiled blocks that
+///             hold it, a tile referenced more than once is shared and must
+///             not be written, see FTilePool::MakeWritable(). It is also
+///             pinned by the commands that use it, so that it is not
+///             recycled before they are done.
+///
+///             A hashed tile is registered in the pool for deduplication,
+///             the other ones are dirty.
+///
+///             The tiles in use are linked from the least to the most
+///             recently pinned. When the pool swaps, a tile that is not
+///             resident has its pixels in a slot of the swap file, and its
+///             block has no data until it is paged in. Pinned tiles are
+///             never evicted.
+///
+///             A tile that was not pinned for a while can also be compressed
+///             in memory, see FTilePool::CompressColdTiles(). It is not
+///             resident either, its pixels are packed in mPacked: a single
+///             pixel when they are all the same, a zlib stream otherwise.
+///
+///             The counters are guarded by the FTilePool.
+struct ULIS_API FTileElement
+{
+    FTileElement( FBlock* iBlock )
+        : mBlock( iBlock )
+        , mHash( 0 )
+        , mRefCount( 0 )
+        , mNumPins( 0 )
+        , bDirty( true )
+        , bResident( true )
+        , mSwapSlot( -1 )
+        , mPacked( nullptr )
+        , mPackedSize( 0 )
+        , mLastUse( 0 )
+        , mPrevious( nullptr )
+        , mNext( nullptr )
+    {}
+
+    FBlock* mBlock;
+    uint32  mHash;
+    uint32  mRefCount;
+    uint32  mNumPins;
+    bool    bDirty;
+    bool    bResident;
+    int64   mSwapSlot;
+    uint8*  mPacked;
+    uint32  mPackedSize;
+    uint64  mLastUse;
+    FTileElement* mPrevious;
+    FTileElement* mNext;
+};
+
+ULIS_NAMESPACE_END
+
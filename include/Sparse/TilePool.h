@@ -0,0 +1,331 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TilePool.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FTilePool class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Image/Format.h"
+#include "Scheduling/Event.h"
+#include "Sparse/Tile.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+class FLargeBlock;
+class FSwapFile;
+class FTiledBlock;
+
+/////////////////////////////////////////////////////
+// eMicro
+/// Size of the tiles, as a power of two in pixels.
+enum eMicro : uint8
+{
+      Micro_32  = 5
+    , Micro_64  = 6
+    , Micro_128 = 7
+    , Micro_256 = 8
+};
+
+/////////////////////////////////////////////////////
+// eMacro
+/// Size of the root chunks, as a power of two in tiles.
+enum eMacro : uint8
+{
+      Macro_256   = 2
+    , Macro_512   = 3
+    , Macro_1024  = 4
+    , Macro_2048  = 5
+};
+
+/////////////////////////////////////////////////////
+/// @class      FTilePool
+/// @brief      The FTilePool class allocates, shares and recycles the tiles
+///             of the FTiledBlock instances that use it.
+/// @details    All the tiles of a pool have the same format and size. A pool
+///             holds a single zero tile, that stands for all the empty tiles
+///             of its blocks, and a table of the hashed tiles, so that the
+///             tiles with the same content are stored once, see
+///             FTiledBlock::SanitizeNow().
+///
+///             Tiles that are not in use anymore are kept for the next
+///             queries, as long as the memory of the pool stays under the
+///             RAM usage cap target, and deleted otherwise.
+///
+///             Once EnableSwap() is called, the pool keeps the tiles in
+///             memory under a resident budget: the least recently used tiles
+///             that are not pinned are evicted to a scratch file mapped in
+///             memory, and paged in again when they are used. The FContext
+///             operations on tiled blocks request the page-in of the tiles
+///             they touch when they are called, as commands on the pool that
+///             their own commands wait for, see FContext::Prefetch().
+///
+///             The tiles that are not used for a while can be compressed in
+///             memory with CompressColdTiles(), they are decompressed in the
+///             same way as they are paged in when they are used again.
+///
+///             The pool is thread safe, it can be shared by tiled blocks
+///             used from different threads. It must outlive them.
+///
+///             \sa FTiledBlock
+///             \sa TTilePool
+class ULIS_API FTilePool
+    : public IHasFormat
+{
+public:
+    /*! Destructor, deletes the remaining tiled blocks. */
+    virtual ~FTilePool();
+
+    /*! Constructor, with the size of the tiles and of the root chunks. */
+    FTilePool(
+          eFormat iFormat
+        , eMicro iMicro = Micro_64
+        , eMacro iMacro = Macro_1024
+    );
+
+    FTilePool( const FTilePool& ) = delete;
+    FTilePool& operator=( const FTilePool& ) = delete;
+
+public:
+    /*! Size of the tiles, in pixels. */
+    uint16 TileSize() const;
+
+    /*! Size of the tiles, as a power of two in pixels. */
+    uint8 Micro() const;
+
+    /*! Size of the root chunks, as a power of two in tiles. */
+    uint8 Macro() const;
+
+    /*! Memory of one tile, in bytes. */
+    uint64 BytesPerTile() const;
+
+    /*! Create a new tiled block that uses this pool. */
+    FTiledBlock* CreateNewTiledBlock();
+
+    /*! Create a new large block of the given size that uses this pool. */
+    FLargeBlock* CreateNewLargeBlock( uint32 iWidth, uint32 iHeight );
+
+    /*! Delete a tiled or large block of this pool and release its tiles. */
+    void RequestTiledBlockDeletion( FTiledBlock* iBlock );
+
+    /*!
+        Set the memory of the pool above which the tiles that are not in use
+        anymore are deleted instead of being kept, in bytes.
+    */
+    void SetRAMUsageCapTarget( uint64 iValue );
+
+    /*! Get the RAM usage cap target, in bytes. */
+    uint64 RAMUsageCapTarget() const;
+
+    /*! Memory of the tiles of the pool, in use or not, in bytes. */
+    uint64 CurrentRAMUsage() const;
+
+    /*! Number of tiles kept for the next queries. */
+    uint64 NumFreshTilesAvailableForQuery() const;
+
+    /*! Number of dirty tiles in use. */
+    uint64 NumDirtyHashedTilesCurrentlyInUse() const;
+
+    /*! Number of hashed tiles in use. */
+    uint64 NumCorrectlyHashedTilesCurrentlyInUse() const;
+
+    /*! Number of tiled blocks that use this pool. */
+    uint64 NumRegisteredTiledBlocks() const;
+
+    /*! Delete the tiles kept for the next queries. */
+    void PurgeAllNow();
+
+    /*!
+        Start evicting the least recently used tiles to a scratch file in
+        iDirectory, the temporary directory of the system if empty, when the
+        tiles in memory exceed iResidentBudget bytes. If the swap is already
+        enabled, only the budget changes. The tiles pinned by the commands
+        in flight stay in memory, so that a large operation can exceed the
+        budget until it is done.
+        Returns false if the scratch file cannot be created, the tiles stay
+        in memory then.
+    */
+    bool EnableSwap( uint64 iResidentBudget = DefaultResidentBudget(), const std::string& iDirectory = std::string() );
+
+    /*! Check whether the tiles can be evicted to the scratch file. */
+    bool IsSwapEnabled() const;
+
+    /*! Set the memory of the resident tiles above which tiles are evicted, in bytes. */
+    void SetResidentBudget( uint64 iValue );
+
+    /*! Get the resident budget, in bytes. */
+    uint64 ResidentBudget() const;
+
+    /*! Default resident budget, half of the RAM of the system, in bytes. */
+    static uint64 DefaultResidentBudget();
+
+    /*! Number of tiles whose pixels are in memory. */
+    uint64 NumResidentTiles() const;
+
+    /*! Number of tiles whose pixels are in the scratch file. */
+    uint64 NumSwappedTiles() const;
+
+    /*! Size of the scratch file, in bytes. */
+    uint64 SwapFileSize() const;
+
+    /*! Number of tiles evicted to the scratch file so far. */
+    uint64 NumEvictions() const;
+
+    /*! Number of tiles paged in from the scratch file so far. */
+    uint64 NumPageIns() const;
+
+    /*! Total time spent paging tiles in, in nanoseconds. */
+    uint64 PageInTime() const;
+
+    /*!
+        Compress in memory the resident tiles that are not pinned and were
+        not used for iIdleTime milliseconds. The tiles of a single color
+        are collapsed to one pixel, the other ones are compressed with zlib
+        and stay as they are if they do not shrink. The tiles used by
+        commands while they are compressed are left as they are.
+        The tiles are compressed on the calling thread, outside of the lock
+        of the pool: the pass can run in the background, on a thread of the
+        application or as a job of the pool, while the tiles are in use.
+        Returns the number of tiles compressed.
+    */
+    uint64 CompressColdTiles( uint64 iIdleTime );
+
+    /*! Number of tiles whose pixels are compressed in memory. */
+    uint64 NumCompressedTiles() const;
+
+    /*! Memory of the compressed tiles, in bytes. */
+    uint64 CompressedBytes() const;
+
+    /*! Size of the pixels of the compressed tiles over their memory. */
+    float CompressionRatio() const;
+
+    /*! Number of tiles decompressed so far. */
+    uint64 NumDecompressions() const;
+
+    /*! Total time spent decompressing tiles, in nanoseconds. */
+    uint64 DecompressionTime() const;
+
+public:
+    // Tile API, for the tiled blocks and the FContext.
+    /*! The zero tile, it stands for all the empty tiles, never write it. */
+    const FBlock& EmptyTile() const;
+
+    /*!
+        Get a new dirty tile, with a reference. Its content is undefined.
+        It is not evicted before it is pinned a first time.
+    */
+    FTileElement* QueryFreshTile();
+
+    /*! Add a reference to a tile. */
+    void RetainTile( FTileElement* iTile );
+
+    /*! Remove a reference to a tile, it is recycled when it is not used. */
+    void ReleaseTile( FTileElement* iTile );
+
+    /*!
+        Keep a tile from being recycled or evicted while a command uses it.
+        It becomes the most recently used tile.
+    */
+    void PinTile( FTileElement* iTile );
+
+    /*! Remove a pin from a tile, it is recycled when it is not used. */
+    void UnpinTile( FTileElement* iTile );
+
+    /*!
+        Check that a tile is referenced once, and unregister it from the hash
+        table if it is hashed, so that it can be written.
+        Returns false if the tile is shared.
+    */
+    bool MakeWritable( FTileElement* iTile );
+
+    /*!
+        Hash a dirty tile and look for a hashed tile with the same content.
+        Returns the tile found with a reference, or the input tile once it is
+        hashed, or nullptr if the tile is all zeros.
+        The tile must not be written by any command in flight. A tile that
+        is not resident is left as is.
+    */
+    FTileElement* Deduplicate( FTileElement* iTile );
+
+    /*!
+        Get the page-in of a pinned tile that is not resident, from the
+        scratch file or from its compressed pixels.
+        Returns false if the tile is resident. Otherwise oEvent is the
+        page-in of the tile, oNew tells whether it was just created: it must
+        then be scheduled by the caller with FContext::Generic_OP(), without
+        wait list, as a call to PageIn() on the pool.
+    */
+    bool RequestPageIn( FTileElement* iTile, FEvent* oEvent, bool* oNew );
+
+    /*!
+        Page in a tile on the calling thread, if it is not resident.
+        A tile that is not pinned may be evicted or compressed again by the
+        next uses of the pool.
+    */
+    void PageIn( FTileElement* iTile );
+
+private:
+    friend class FTiledBlock;
+    void RegisterTiledBlock( FTiledBlock* iBlock );
+    void UnregisterTiledBlock( FTiledBlock* iBlock );
+    void RecycleTile_Unsafe( FTileElement* iTile );
+    void UnhashTile_Unsafe( FTileElement* iTile );
+    void DeleteTile_Unsafe( FTileElement* iTile );
+    void LinkUsed_Unsafe( FTileElement* iTile );
+    void UnlinkUsed_Unsafe( FTileElement* iTile );
+    void EnforceResidentBudget_Unsafe();
+    bool EvictTile_Unsafe( FTileElement* iTile );
+    void Unpack( const FTileElement* iTile, uint8* oData ) const;
+    uint64 ResidentBytes_Unsafe() const;
+
+private:
+    const uint8 mMicro;
+    const uint8 mMacro;
+    const uint16 mTileSize;
+    FBlock* mEmptyTile;
+    mutable std::mutex mMutex;
+    std::vector< FTileElement* > mFreshTiles;
+    std::unordered_multimap< uint32, FTileElement* > mHashedTiles;
+    std::unordered_set< FTiledBlock* > mTiledBlocks;
+    uint64 mRAMUsageCapTarget;
+    uint64 mNumTiles;
+    FTileElement* mLeastRecentlyUsed;
+    FTileElement* mMostRecentlyUsed;
+    FSwapFile* mSwapFile;
+    std::unordered_map< FTileElement*, FEvent > mPageIns;
+    uint64 mResidentBudget;
+    uint64 mNumSwappedTiles;
+    uint64 mNumEvictions;
+    uint64 mNumPageIns;
+    uint64 mPageInTime;
+    uint64 mNumCompressedTiles;
+    uint64 mCompressedBytes;
+    uint64 mNumDecompressions;
+    uint64 mDecompressionTime;
+};
+
+/////////////////////////////////////////////////////
+/// @class      TTilePool
+/// @brief      The TTilePool class is a FTilePool with the size of its tiles
+///             and root chunks known at compile time.
+template< uint8 _MICRO, uint8 _MACRO >
+class TTilePool
+    : public FTilePool
+{
+public:
+    TTilePool( eFormat iFormat, void* = nullptr )
+        : FTilePool( iFormat, static_cast< eMicro >( _MICRO ), static_cast< eMacro >( _MACRO ) )
+    {}
+};
+
+ULIS_NAMESPACE_END
+
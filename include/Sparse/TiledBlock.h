@@ -0,0 +1,165 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TiledBlock.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FTiledBlock class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Image/Format.h"
+#include "Math/Geometry/Rectangle.h"
+#include "Math/Geometry/Vector.h"
+#include "Sparse/Tile.h"
+#include "Sparse/TilePool.h"
+#include <unordered_map>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FTiledBlock
+/// @brief      The FTiledBlock class is a sparse image made of tiles,
+///             allocated and shared by a FTilePool.
+/// @details    A tiled block has no bounds: its tiles are allocated when
+///             something is drawn on them, and the other ones are empty,
+///             they read as zeros from the shared empty tile of the pool.
+///             Tiles are grouped in root chunks, which are allocated as
+///             needed too, so that a mostly empty canvas costs a few tiles.
+///
+///             The FContext operations that accept tiled blocks, such as
+///             Blend(), Copy(), Fill(), Clear() and TransformAffine(), only
+///             schedule work on the tiles that are allocated or written, as
+///             regular commands on the FBlock of each tile. They update the
+///             layout of the tiled block when they are called: a tile that
+///             is fully filled, cleared or copied from another tiled block
+///             of the same pool is shared or released without any pixel
+///             work. A shared tile is copied before it is written.
+///
+///             SanitizeNow() deduplicates the tiles with the same content
+///             and releases the tiles that are all zeros, it should be
+///             called once the commands on the block are finished.
+///
+///             A tiled block must not be used from several threads at the
+///             same time.
+///
+///             \sa FLargeBlock
+///             \sa FTilePool
+///             \sa FTileElement
+///             \sa FContext
+class ULIS_API FTiledBlock
+    : public IHasFormat
+{
+public:
+    /*! Destructor, releases the tiles. */
+    virtual ~FTiledBlock();
+
+    /*! Constructor, creates an empty tiled block that uses the pool. */
+    FTiledBlock( FTilePool& iPool );
+
+    FTiledBlock( const FTiledBlock& ) = delete;
+    FTiledBlock& operator=( const FTiledBlock& ) = delete;
+
+protected:
+    /*! Constructor, for a tiled block clipped to iBounds. */
+    FTiledBlock( FTilePool& iPool, const FRectI& iBounds );
+
+public:
+    /*! The pool of the tiles. */
+    FTilePool& TilePool() const;
+
+    /*! Size of the tiles, in pixels. */
+    uint16 TileSize() const;
+
+    /*! Number of tiles that are not empty. */
+    uint64 NumTiles() const;
+
+    /*!
+        Bounds of the tiles that are not empty, in pixels.
+        Returns an empty rect if the block is empty.
+    */
+    FRectI Rect() const;
+
+    /*! Check whether the operations on the block are clipped to Bounds(). */
+    bool IsBounded() const;
+
+    /*!
+        Bounds of the block, in pixels, if it is bounded.
+        Returns an empty rect otherwise.
+    */
+    const FRectI& Bounds() const;
+
+    /*! Coordinates of the tile that holds a pixel. */
+    FVec2I TileCoordinatesFromPixelCoordinates( const FVec2I& iPos ) const;
+
+    /*! Rect of a tile, in pixels. */
+    FRectI TileRect( const FVec2I& iTile ) const;
+
+    /*! Rect of the tiles that hold the pixels of a rect, in tiles. */
+    FRectI TileRange( const FRectI& iRect ) const;
+
+    /*!
+        Get the block of the tile that holds a pixel, for reading, and the
+        coordinates of the pixel in this block. Returns the empty tile of
+        the pool if the tile is empty. A swapped tile is paged in first.
+    */
+    const FBlock* QueryConstBlockAtPixelCoordinates( const FVec2I& iPos, FVec2I* oLocalCoords ) const;
+
+    /*!
+        Get the tile that holds a pixel, ready to be written on the calling
+        thread, and the coordinates of the pixel in its block. The tile is
+        allocated if it is empty and copied if it is shared, and paged in
+        if it is swapped.
+        The tiles of the block must not be used by any command in flight.
+    */
+    FTileElement** QueryOneMutableTileElementForImminentDirtyOperationAtPixelCoordinates( const FVec2I& iPos, FVec2I* oLocalCoords );
+
+    /*! Release all the tiles, the block is empty afterwards. */
+    void Clear();
+
+    /*!
+        Deduplicate the dirty tiles and release the ones that are all zeros.
+        The tiles of the block must not be written by any command in flight.
+    */
+    void SanitizeNow();
+
+public:
+    // Tile API, for the FContext.
+    /*! Get a tile, or nullptr if it is empty. */
+    FTileElement* QueryTile( const FVec2I& iTile ) const;
+
+    /*!
+        Set a tile, or empty it with nullptr. The new tile gets a reference,
+        and the previous one is released.
+    */
+    void SetTile( const FVec2I& iTile, FTileElement* iElement );
+
+private:
+    struct FRootChunk
+    {
+        std::vector< FTileElement* > mTiles;
+        uint32 mNumTiles;
+    };
+
+    uint64 KeyFromTileCoordinates( const FVec2I& iTile, uint32* oIndex ) const;
+    FVec2I TileCoordinatesFromKey( uint64 iKey, uint32 iIndex ) const;
+
+private:
+    FTilePool& mTilePool;
+    std::unordered_map< uint64, FRootChunk > mSparseMap;
+    uint64 mNumTiles;
+    mutable FRectI mRect;
+    mutable bool bRectDirty;
+    const FRectI mBounds;
+    const bool bBounded;
+};
+
+/// Tiled blocks of a TTilePool.
+template< uint8 _MICRO, uint8 _MACRO >
+using TTiledBlock = FTiledBlock;
+
+ULIS_NAMESPACE_END
+
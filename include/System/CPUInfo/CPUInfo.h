@@ -36,6 +36,14 @@ enum ePerformanceIntent : uint32 {
 ///             assumed to be true.
 ///             FCPUInfo also provides some insight about the hardware such
 ///             as the number of available cores, or the size of cache lines.
+///
+///             The topology of the logical cores the process is allowed to
+///             run on is described by index, from 0 to NumLogicalCores():
+///             the physical core and the NUMA node each one belongs to, and
+///             the set of logical cores it shares its L1, L2 or L3 cache
+///             with. It is only detected on Linux for now; elsewhere, each
+///             logical core is assumed to be a physical core of its own, all
+///             of them sharing the last level cache on a single node.
 class ULIS_API FCPUInfo
 {
 private:
@@ -85,6 +93,14 @@ public:
     static uint32 MaxWorkers();
     static uint32 L1CacheSize();
     static uint32 L1CacheLineSize();
+    static uint32 L2CacheSize();
+    static uint32 NumLogicalCores();
+    static uint32 NumPhysicalCores();
+    static uint32 NumNUMANodes();
+    static uint32 LogicalCoreID( uint32 iIndex );
+    static uint32 PhysicalCore( uint32 iIndex );
+    static uint32 NUMANode( uint32 iIndex );
+    static uint32 CacheGroup( uint32 iIndex, uint8 iLevel );
 };
 
 ULIS_NAMESPACE_END
@@ -0,0 +1,94 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         Executor.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the IExecutor interface and the FCallbackExecutor class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Core/Callback.h"
+#include "Scheduling/CommandQueue.h"
+
+ULIS_NAMESPACE_BEGIN
+/*! A task of ULIS, to be called once with its data. */
+typedef void (*fpExecutorTask)( void* /* iData */ );
+
+/////////////////////////////////////////////////////
+/// @class      IExecutor
+/// @brief      The IExecutor interface lets a FThreadPool run its jobs on
+///             the task system of the host application, instead of its own
+///             threads.
+/// @details    A FThreadPool built on an executor spawns neither workers
+///             nor a scheduler thread. The jobs of a command are built on the
+///             thread that makes it ready, either the thread that flushes its
+///             queue or the one that finishes its last dependency, and handed
+///             to Dispatch() right away.
+///
+///             Dispatch() can be called from any thread, including from the
+///             tasks of the executor, it must not wait for the task to run.
+///             Tasks are short, they never block, they can run in any order
+///             and concurrently. The priority is the one of the queue of the
+///             command, the executor is free to ignore it.
+///
+///             Waiting for completion from a task of the executor, through
+///             FCommandQueue::Finish() for instance, deadlocks if the
+///             executor cannot run other tasks in the meantime.
+///
+///             \sa FThreadPool
+///             \sa FCallbackExecutor
+class ULIS_API IExecutor
+{
+public:
+    virtual ~IExecutor() {}
+
+    /*!
+        Get the number of tasks the executor runs in parallel, commands are
+        split in jobs according to it.
+    */
+    virtual uint32 Concurrency() const = 0;
+
+    /*! Run iTask( iData ) once, later on, on any thread. */
+    virtual void Dispatch( fpExecutorTask iTask, void* iData, eCommandQueuePriority iPriority ) = 0;
+};
+
+typedef TCallback< void, fpExecutorTask /* iTask */, void* /* iData */, eCommandQueuePriority /* iPriority */ > FOnDispatchTask;
+template class ULIS_API TCallback< void, fpExecutorTask, void*, eCommandQueuePriority >;
+
+/////////////////////////////////////////////////////
+/// @class      FCallbackExecutor
+/// @brief      The FCallbackExecutor class is a reference adapter of
+///             IExecutor, which forwards the tasks to a callback.
+/// @details    It suits task systems that take a function and its data, the
+///             callback receives the extra info it was bound with, typically
+///             the task system itself:
+///
+///             \code
+///             void Dispatch( fpExecutorTask iTask, void* iData, eCommandQueuePriority, void* iInfo ) {
+///                 static_cast< FHostJobSystem* >( iInfo )->Submit( [iTask, iData](){ iTask( iData ); } );
+///             }
+///             FCallbackExecutor executor( host.NumThreads(), FOnDispatchTask( &Dispatch, &host ) );
+///             FThreadPool pool( executor );
+///             \endcode
+///
+///             \sa IExecutor
+class ULIS_API FCallbackExecutor
+    : public IExecutor
+{
+public:
+    ~FCallbackExecutor() override;
+    FCallbackExecutor( uint32 iConcurrency, const FOnDispatchTask& iDispatch );
+    uint32 Concurrency() const override;
+    void Dispatch( fpExecutorTask iTask, void* iData, eCommandQueuePriority iPriority ) override;
+
+private:
+    uint32 mConcurrency;
+    FOnDispatchTask mDispatch;
+};
+
+ULIS_NAMESPACE_END
+
@@ -14,6 +14,64 @@
 
 ULIS_NAMESPACE_BEGIN
 class FThreadPool_Private;
+class IExecutor;
+
+/////////////////////////////////////////////////////
+// eThreadPoolBackend
+enum eThreadPoolBackend : uint8
+{
+      ThreadPoolBackend_SharedQueue = 0
+    , ThreadPoolBackend_WorkStealing = 1
+};
+
+/////////////////////////////////////////////////////
+// eThreadPoolAffinity
+enum eThreadPoolAffinity : uint8
+{
+      ThreadPoolAffinity_None = 0
+    , ThreadPoolAffinity_Pinned = 1
+    , ThreadPoolAffinity_PhysicalCores = 2
+};
+
+/////////////////////////////////////////////////////
+/// @class      FThreadPoolStats
+/// @brief      The FThreadPoolStats struct holds a snapshot of the runtime
+///             counters of a FThreadPool, see FThreadPool::Stats().
+/// @details    Queued commands are submitted and not scheduled yet, either
+///             waiting for their dependencies or for the scheduler thread.
+///             Pending commands are submitted and not finished yet. Queued
+///             jobs are scheduled and not started yet.
+///
+///             The finished counts and the histograms cover the lifetime of
+///             the pool. Histograms count durations in buckets of powers of
+///             two microseconds: bucket 0 counts the durations under 1 us,
+///             bucket i the ones from 2^(i-1) to 2^i us, and the last bucket
+///             everything above. The job time is the execution time of a
+///             job, the scheduling latency is the time from the moment a
+///             command has all its dependencies finished to the start of its
+///             first job. A chain of fused commands counts as one command.
+///
+///             The utilisation is the percentage of the time the workers
+///             spent running jobs, and the commands per second the rate of
+///             finished commands, both since the previous call to Stats().
+struct ULIS_API FThreadPoolStats
+{
+    static constexpr uint32 NumHistogramBuckets = 16;
+
+    uint32 numWorkers;
+    uint32 numBusyWorkers;
+    uint32 numIdleWorkers;
+    uint32 numQueuedCommands;
+    uint32 numPendingCommands;
+    uint64 numQueuedJobs;
+    uint64 numCommandsFinished;
+    uint64 numJobsFinished;
+    float utilisation;
+    float commandsPerSecond;
+    uint64 jobTimeHistogram[ NumHistogramBuckets ];
+    uint64 schedulingLatencyHistogram[ NumHistogramBuckets ];
+};
+
 /////////////////////////////////////////////////////
 /// @class      FThreadPool
 /// @brief      The FThreadPool class provides a way to hold a thread pool with
@@ -26,7 +84,52 @@ class FThreadPool_Private;
 ///             behaviour anyway with no change to application logic, but it
 ///             processes it in a linear monothreaded fashion.
 ///
+///             The backend used to distribute jobs among workers is chosen at
+///             construction time. ThreadPoolBackend_SharedQueue stores all jobs
+///             in a single queue guarded by a mutex, while
+///             ThreadPoolBackend_WorkStealing gives each worker its own queue
+///             and lets idle workers steal jobs from the busy ones, which
+///             scales better with many workers and many small jobs.
+///
+///             The affinity of the workers is chosen at construction time as
+///             well. With ThreadPoolAffinity_None, the OS is free to move them
+///             around. With ThreadPoolAffinity_Pinned, each worker is pinned
+///             to one logical core: one per physical core first, then their
+///             SMT siblings if there are more workers than physical cores.
+///             ThreadPoolAffinity_PhysicalCores pins them the same way, but
+///             never puts two workers on the same physical core, which also
+///             limits the number of workers to FCPUInfo::NumPhysicalCores().
+///             In both pinned modes, workers are ordered by NUMA node and by
+///             shared cache, so that with ThreadPoolBackend_WorkStealing the
+///             contiguous runs of jobs of a command, such as neighbour chunks
+///             of a block, go to workers that share a cache, and idle workers
+///             steal from their closest neighbours first. Pinning is only
+///             supported on Linux, elsewhere the workers are left free.
+///
+///             Threads waiting for completion, either through
+///             WaitForCompletion(), FCommandQueue::Fence() or FEvent::Wait(),
+///             are parked and do not consume CPU time. A bounded spin phase
+///             can be enabled with SetWaitSpinCount() to lower the latency of
+///             short waits, at the expense of CPU time.
+///
+///             The jobs, commands and waits of all pools can be recorded on a
+///             timeline with FSchedulingTrace.
+///
+///             Instead of its own threads, a pool can run its jobs on the task
+///             system of the host application, through an IExecutor given at
+///             construction time. The pool then spawns no thread at all, its
+///             number of workers is the concurrency of the executor and cannot
+///             be changed, the backend and affinity do not apply. The
+///             executor must outlive the pool.
+///
+///             Live counters of the pool can be sampled with Stats(), for
+///             monitoring. Each worker updates its own counters, without
+///             atomic read-modify-write, and Stats() only reads them, without
+///             taking any lock.
+///
 ///             \sa FCPUInfo
+///             \sa IExecutor
+///             \sa FSchedulingTrace
 ///             \sa FCommandQueue
 class ULIS_API FThreadPool
 {
@@ -34,12 +137,23 @@ class ULIS_API FThreadPool
 
 public:
     ~FThreadPool();
-    FThreadPool( uint32 iNumWorkers = MaxWorkers() );
+    FThreadPool(
+          uint32 iNumWorkers = MaxWorkers()
+        , eThreadPoolBackend iBackend = ThreadPoolBackend_SharedQueue
+        , eThreadPoolAffinity iAffinity = ThreadPoolAffinity_None
+    );
+    explicit FThreadPool( IExecutor& iExecutor );
     FThreadPool( const FThreadPool& ) = delete;
     FThreadPool& operator=( const FThreadPool& ) = delete;
     void WaitForCompletion();
     void SetNumWorkers( uint32 iNumWorkers );
     uint32 GetNumWorkers() const;
+    eThreadPoolBackend Backend() const;
+    eThreadPoolAffinity Affinity() const;
+    void SetWaitSpinCount( uint32 iSpinCount );
+    uint32 WaitSpinCount() const;
+    FThreadPoolStats Stats() const;
+    IExecutor* Executor() const;
     static uint32 MaxWorkers();
 
 private:
@@ -59,15 +59,16 @@
 #include "System/MemoryInfo/MemoryInfo.h"
 #include "System/FilePathRegistry.h"
 #include "System/ThreadPool/ThreadPool.h"
+#include "System/ThreadPool/Executor.h"
 // Scheduling
+#include "Scheduling/CommandList.h"
 #include "Scheduling/CommandQueue.h"
 #include "Scheduling/Event.h"
 #include "Scheduling/SchedulePolicy.h"
-/*
+#include "Scheduling/SchedulingTrace.h"
 // Sparse
-#include "Sparse/Chunk.h"
+#include "Sparse/LargeBlock.h"
 #include "Sparse/Tile.h"
 #include "Sparse/TiledBlock.h"
 #include "Sparse/TilePool.h"
-*/
 
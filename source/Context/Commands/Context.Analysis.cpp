@@ -80,7 +80,7 @@ FContext::AnalyzeSmallestVisibleRect(
     XAllocateBlockData( *strip, 1, src_roi.h, Format_CMYK16, nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ), FSchedulePolicy::MonoChunk, iNumWait, iWaitList, &event_alloc );
 
     FEvent xpass_event;
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAnalyzeSmallestVisibleRectXPass
             , new FDualBufferCommandArgs(
@@ -97,6 +97,7 @@ FContext::AnalyzeSmallestVisibleRect(
             , &xpass_event
             , strip->Rect()
         )
+        , __func__
     );
 
     FEvent ypass_event(
@@ -113,7 +114,7 @@ FContext::AnalyzeSmallestVisibleRect(
             }
         )
     );
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAnalyzeSmallestVisibleRectYPass
             , new FSimpleBufferCommandArgs(
@@ -128,6 +129,7 @@ FContext::AnalyzeSmallestVisibleRect(
             , &ypass_event
             , strip->Rect()
         )
+        , __func__
     );
 
     Dummy_OP( 1, &ypass_event, iEvent );
@@ -187,7 +189,7 @@ FContext::AccumulateSample(
     XAllocateBlockData( *strip, 1, src_roi.h, SummedAreaTableMetrics( iBlock ), nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ), FSchedulePolicy::MonoChunk, iNumWait, iWaitList, &event_alloc );
 
     FEvent xpass_event;
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAccumulativeSamplingXPass
             , new FDualBufferCommandArgs(
@@ -204,6 +206,7 @@ FContext::AccumulateSample(
             , &xpass_event
             , strip->Rect()
         )
+        , __func__
     );
 
     FEvent ypass_event(
@@ -219,7 +222,7 @@ FContext::AccumulateSample(
             }
         )
     );
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAccumulativeSamplingYPass
             , new FSimpleBufferCommandArgs(
@@ -234,6 +237,7 @@ FContext::AccumulateSample(
             , &ypass_event
             , strip->Rect()
         )
+        , __func__
     );
     Dummy_OP( 1, &ypass_event, iEvent );
 
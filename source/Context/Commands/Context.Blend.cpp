@@ -58,7 +58,7 @@ FContext::Blend(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleBlend( iBlendingMode )
             , new FBlendCommandArgs(
@@ -84,7 +84,9 @@ FContext::Blend(
             , iWaitList
             , iEvent
             , dst_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -153,7 +155,7 @@ FContext::BlendAA(
     const int coverageY = src_roi.h - ( src_roi.y + shift.y ) >= dst_roi.h ? dst_roi.h : static_cast< int >( dst_roi.h - ceil( subpixelComponent.y ) );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleBlendSubpixel( iBlendingMode )
             , new FBlendCommandArgs(
@@ -180,6 +182,7 @@ FContext::BlendAA(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -216,7 +219,7 @@ FContext::AlphaBlend(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAlphaBlend
             , new FBlendCommandArgs(
@@ -242,7 +245,9 @@ FContext::AlphaBlend(
             , iWaitList
             , iEvent
             , dst_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -289,7 +294,7 @@ FContext::AlphaBlendAA(
     const int coverageY = src_roi.h - ( src_roi.y + shift.y ) >= dst_roi.h ? dst_roi.h : static_cast< int >( dst_roi.h - ceil( subpixelComponent.y ) );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleAlphaBlendSubpixel
             , new FBlendCommandArgs(
@@ -316,6 +321,7 @@ FContext::AlphaBlendAA(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -360,7 +366,7 @@ FContext::BlendTiled(
     );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleTiledBlend( iBlendingMode )
             , new FBlendCommandArgs(
@@ -388,6 +394,7 @@ FContext::BlendTiled(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -421,7 +428,7 @@ FContext::BlendColor(
     ISample::ConvertFormat( iColor, proxy );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleTiledBlend( iBlendingMode )
             , new FBlendCommandArgs(
@@ -449,7 +456,9 @@ FContext::BlendColor(
             , iWaitList
             , iEvent
             , dst_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
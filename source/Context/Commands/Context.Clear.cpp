@@ -42,7 +42,7 @@ FContext::Clear(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleClear
             , new FSimpleBufferCommandArgs(
@@ -56,7 +56,9 @@ FContext::Clear(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -52,7 +52,7 @@ FContext::ConvertFormat(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvertFormat
             , new FConvCommandArgs(
@@ -69,7 +69,9 @@ FContext::ConvertFormat(
             , iWaitList
             , iEvent
             , dst_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
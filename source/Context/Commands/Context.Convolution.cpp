@@ -58,7 +58,7 @@ FContext::Convolve(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolve
             , new FConvolutionCommandArgs(
@@ -76,6 +76,7 @@ FContext::Convolve(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -114,7 +115,7 @@ FContext::ConvolveMax(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolveMax
             , new FConvolutionCommandArgs(
@@ -132,6 +133,7 @@ FContext::ConvolveMax(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -170,7 +172,7 @@ FContext::ConvolveMin(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolveMin
             , new FConvolutionCommandArgs(
@@ -188,6 +190,7 @@ FContext::ConvolveMin(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -226,7 +229,7 @@ FContext::ConvolvePremult(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolvePremult
             , new FConvolutionCommandArgs(
@@ -244,6 +247,7 @@ FContext::ConvolvePremult(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -282,7 +286,7 @@ FContext::ConvolvePremultMax(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolvePremultMax
             , new FConvolutionCommandArgs(
@@ -300,6 +304,7 @@ FContext::ConvolvePremultMax(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -338,7 +343,7 @@ FContext::ConvolvePremultMin(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleConvolvePremultMin
             , new FConvolutionCommandArgs(
@@ -356,6 +361,7 @@ FContext::ConvolvePremultMin(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -394,7 +400,7 @@ FContext::MorphologicalProcess(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleMorphologicalProcess
             , new FMorphoCommandArgs(
@@ -412,6 +418,7 @@ FContext::MorphologicalProcess(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -52,7 +52,7 @@ FContext::Copy(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleCopy
             , new FDualBufferCommandArgs(
@@ -68,7 +68,9 @@ FContext::Copy(
             , iWaitList
             , iEvent
             , dst_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
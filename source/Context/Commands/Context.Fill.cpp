@@ -55,7 +55,7 @@ FContext::Fill(
 
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFill
             , new FFillCommandArgs(
@@ -70,7 +70,9 @@ FContext::Fill(
             , iWaitList
             , iEvent
             , roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -96,7 +98,7 @@ FContext::FillPreserveAlpha(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFillPreserveAlpha
             , new FFillPreserveAlphaCommandArgs(
@@ -111,7 +113,9 @@ FContext::FillPreserveAlpha(
             , iWaitList
             , iEvent
             , roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
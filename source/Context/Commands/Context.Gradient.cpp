@@ -51,7 +51,7 @@ FContext::RasterGradient(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleRasterGradient( iType )
             , new FGradientCommandArgs(
@@ -71,6 +71,7 @@ FContext::RasterGradient(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
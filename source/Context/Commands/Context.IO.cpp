@@ -49,13 +49,16 @@ FContext::XLoadBlockFromDisk(
        return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_BAD_INPUT_DATA );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFileLoad
             , new FDiskIOCommandArgs(
                   ioBlock
                 , FRectI( 0, 0, ULIS_UINT16_MAX, ULIS_UINT16_MAX )
                 , iPath
+                , eFileFormat::FileFormat_png
+                , 100
+                , true
             )
             , iPolicy
             , true
@@ -65,6 +68,7 @@ FContext::XLoadBlockFromDisk(
             , iEvent
             , FRectI( 0, 0, ULIS_UINT16_MAX, ULIS_UINT16_MAX )
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -95,7 +99,7 @@ FContext::SaveBlockToDisk(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_BAD_FILE_FORMAT );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFileSave
             , new FDiskIOCommandArgs(
@@ -113,6 +117,7 @@ FContext::SaveBlockToDisk(
             , iEvent
             , iBlock.Rect()
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
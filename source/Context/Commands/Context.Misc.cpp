@@ -166,7 +166,7 @@ FContext::Extract(
     #pragma warning(pop)
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleExtract
             , new FExtractCommandArgs(
@@ -187,6 +187,7 @@ FContext::Extract(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -212,7 +213,7 @@ FContext::Filter(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFilter
             , new FFilterCommandArgs(
@@ -228,6 +229,7 @@ FContext::Filter(
             , iEvent
             , src_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -253,7 +255,7 @@ FContext::FilterInPlace(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFilterInPlace
             , new FFilterInPlaceCommandArgs(
@@ -268,7 +270,9 @@ FContext::FilterInPlace(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -299,7 +303,7 @@ FContext::FilterInto(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleFilterInto
             , new FFilterIntoCommandArgs(
@@ -317,6 +321,7 @@ FContext::FilterInto(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -341,7 +346,7 @@ FContext::sRGBToLinear(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mSchedulesRGBToLinear
             , new FSimpleBufferCommandArgs(
@@ -355,7 +360,9 @@ FContext::sRGBToLinear(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -380,7 +387,7 @@ FContext::LinearTosRGB(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleLinearTosRGB
             , new FSimpleBufferCommandArgs(
@@ -394,7 +401,9 @@ FContext::LinearTosRGB(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -422,7 +431,7 @@ FContext::Premultiply(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mSchedulePremultiply
             , new FSimpleBufferCommandArgs(
@@ -436,7 +445,9 @@ FContext::Premultiply(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -464,7 +475,7 @@ FContext::Unpremultiply(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleUnpremultiply
             , new FSimpleBufferCommandArgs(
@@ -478,7 +489,9 @@ FContext::Unpremultiply(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -506,7 +519,7 @@ FContext::SanitizeZeroAlpha(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleSanitize
             , new FSimpleBufferCommandArgs(
@@ -520,7 +533,9 @@ FContext::SanitizeZeroAlpha(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -556,7 +571,7 @@ FContext::Swap(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleSwap
             , new FSwapCommandArgs(
@@ -572,7 +587,9 @@ FContext::Swap(
             , iWaitList
             , iEvent
             , src_roi
+            , true
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -594,7 +611,7 @@ FContext::XAllocateBlockData(
 )
 {
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               &ScheduleAlloc
             , new FAllocCommandArgs(
@@ -614,6 +631,7 @@ FContext::XAllocateBlockData(
             , iEvent
             , FRectI( 0, 0, iWidth, iHeight )
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -629,7 +647,7 @@ FContext::XDeallocateBlockData(
 )
 {
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               &ScheduleDealloc
             , new FSimpleBufferCommandArgs(
@@ -644,6 +662,7 @@ FContext::XDeallocateBlockData(
             , iEvent
             , iBlock.Rect()
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
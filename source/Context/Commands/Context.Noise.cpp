@@ -50,7 +50,7 @@ FContext::WhiteNoise(
     int seed = iSeed < 0 ? static_cast< int >( time( 0 ) ) : iSeed;
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleWhiteNoise
             , new FWhiteNoiseCommandArgs(
@@ -66,6 +66,7 @@ FContext::WhiteNoise(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -96,7 +97,7 @@ FContext::ValueNoise(
     int seed = iSeed < 0 ? static_cast< int >( time( 0 ) ) : iSeed;
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleValueNoise
             , new FValueNoiseCommandArgs(
@@ -113,6 +114,7 @@ FContext::ValueNoise(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -155,7 +157,7 @@ FContext::BrownianNoise(
     }
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleBrownianNoise
             , new FBrownianNoiseCommandArgs(
@@ -176,6 +178,7 @@ FContext::BrownianNoise(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -220,7 +223,7 @@ FContext::VoronoiNoise(
 
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleVoronoiNoise
             , new FVoronoiNoiseCommandArgs(
@@ -238,6 +241,7 @@ FContext::VoronoiNoise(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -48,7 +48,7 @@ FContext::DrawLine(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawLine
             , new FDrawLineCommandArgs(
@@ -66,6 +66,7 @@ FContext::DrawLine(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -96,7 +97,7 @@ FContext::DrawLineAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawLineAA
             , new FDrawLineCommandArgs(
@@ -114,6 +115,7 @@ FContext::DrawLineAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -144,7 +146,7 @@ FContext::DrawLineSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawLineSP
             , new FDrawLineSPCommandArgs(
@@ -162,6 +164,7 @@ FContext::DrawLineSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -193,7 +196,7 @@ FContext::DrawCircle(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawCircle
             , new FDrawCircleCommandArgs(
@@ -212,6 +215,7 @@ FContext::DrawCircle(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -243,7 +247,7 @@ FContext::DrawCircleAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawCircleAA
             , new FDrawCircleCommandArgs(
@@ -262,6 +266,7 @@ FContext::DrawCircleAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -293,7 +298,7 @@ FContext::DrawCircleSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawCircleSP
             , new FDrawCircleSPCommandArgs(
@@ -312,6 +317,7 @@ FContext::DrawCircleSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -344,7 +350,7 @@ FContext::DrawArc(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawArc
             , new FDrawArcCommandArgs(
@@ -364,6 +370,7 @@ FContext::DrawArc(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -396,7 +403,7 @@ FContext::DrawArcAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawArcAA
             , new FDrawArcCommandArgs(
@@ -416,6 +423,7 @@ FContext::DrawArcAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -448,7 +456,7 @@ FContext::DrawArcSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawArcSP
             , new FDrawArcSPCommandArgs(
@@ -468,6 +476,7 @@ FContext::DrawArcSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -500,7 +509,7 @@ FContext::DrawEllipse(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawEllipse
             , new FDrawEllipseCommandArgs(
@@ -520,6 +529,7 @@ FContext::DrawEllipse(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -552,7 +562,7 @@ FContext::DrawEllipseAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawEllipseAA
             , new FDrawEllipseCommandArgs(
@@ -572,6 +582,7 @@ FContext::DrawEllipseAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -604,7 +615,7 @@ FContext::DrawEllipseSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
             mContextualDispatchTable->mScheduleDrawEllipseSP
             , new FDrawEllipseSPCommandArgs(
@@ -624,6 +635,7 @@ FContext::DrawEllipseSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -657,7 +669,7 @@ FContext::DrawRotatedEllipse(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawRotatedEllipse
             , new FDrawRotatedEllipseCommandArgs(
@@ -678,6 +690,7 @@ FContext::DrawRotatedEllipse(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -711,7 +724,7 @@ FContext::DrawRotatedEllipseAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawRotatedEllipseAA
             , new FDrawRotatedEllipseCommandArgs(
@@ -732,6 +745,7 @@ FContext::DrawRotatedEllipseAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -765,7 +779,7 @@ FContext::DrawRotatedEllipseSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawRotatedEllipseSP
             , new FDrawRotatedEllipseSPCommandArgs(
@@ -786,6 +800,7 @@ FContext::DrawRotatedEllipseSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -829,7 +844,7 @@ FContext::DrawRectangle(
     }
     else
         // Bake and push command
-        mCommandQueue.d->Push(
+        Push(
             new FCommand(
                   mContextualDispatchTable->mScheduleDrawRectangle
                 , new FDrawRectangleCommandArgs(
@@ -847,6 +862,7 @@ FContext::DrawRectangle(
                 , iEvent
                 , src_roi
             )
+            , __func__
         );
     
     return  ULIS_NO_ERROR;
@@ -877,7 +893,7 @@ FContext::DrawPolygon(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawPolygon
             , new FDrawPolygonCommandArgs(
@@ -895,6 +911,7 @@ FContext::DrawPolygon(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -925,7 +942,7 @@ FContext::DrawPolygonAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawPolygonAA
             , new FDrawPolygonCommandArgs(
@@ -943,6 +960,7 @@ FContext::DrawPolygonAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -973,7 +991,7 @@ FContext::DrawPolygonSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawPolygonSP
             , new FDrawPolygonSPCommandArgs(
@@ -991,6 +1009,7 @@ FContext::DrawPolygonSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -1023,7 +1042,7 @@ FContext::DrawQuadraticBezier(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawQuadraticBezier
             , new FDrawQuadraticBezierCommandArgs(
@@ -1043,6 +1062,7 @@ FContext::DrawQuadraticBezier(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -1075,7 +1095,7 @@ FContext::DrawQuadraticBezierAA(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawQuadraticBezierAA
             , new FDrawQuadraticBezierCommandArgs(
@@ -1095,6 +1115,7 @@ FContext::DrawQuadraticBezierAA(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
@@ -1128,7 +1149,7 @@ FContext::DrawQuadraticBezierSP(
     FColor color = iColor.ToFormat(iBlock.Format());
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleDrawQuadraticBezierSP
             , new FDrawQuadraticBezierSPCommandArgs(
@@ -1148,6 +1169,7 @@ FContext::DrawQuadraticBezierSP(
             , iEvent
             , src_roi
         )
+        , __func__
     );
     
     return  ULIS_NO_ERROR;
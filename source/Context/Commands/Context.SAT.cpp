@@ -38,7 +38,7 @@ FContext::BuildSummedAreaTable(
     ULIS_ASSERT_RETURN_ERROR( iDestination.Format() == SummedAreaTableMetrics( iSource ), "Cannot build an SAT in this format, use SummedAreaTableMetrics.", FinishEventNo_OP( iEvent, ULIS_ERROR_BAD_INPUT_DATA ) );
 
     FEvent xpass_event;
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleBuildSATXPass
             , new FDualBufferCommandArgs(
@@ -55,6 +55,7 @@ FContext::BuildSummedAreaTable(
             , &xpass_event
             , iDestination.Rect()
         )
+        , __func__
     );
 
     // Dirty tricks for SAT:
@@ -71,7 +72,7 @@ FContext::BuildSummedAreaTable(
             }
         )
     );
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleBuildSATYPass
             , new FDualBufferCommandArgs(
@@ -88,6 +89,7 @@ FContext::BuildSummedAreaTable(
             , &ypass_event
             , iDestination.Rect()
         )
+        , __func__
     );
     // Reset fake rotation to avoid ambiguous rect work
     fakeSourceRotated->LoadFromData( fakeSourceRotated->Bits(), iSource.Width(), iSource.Height(), iSource.Format(), nullptr, FOnInvalidBlock(), FOnCleanupData() );
@@ -111,7 +113,7 @@ FContext::BuildPremultipliedSummedAreaTable(
     ULIS_ASSERT_RETURN_ERROR( iDestination.Format() == SummedAreaTableMetrics( iSource ), "Cannot build an SAT in this format, use SummedAreaTableMetrics.", FinishEventNo_OP( iEvent, ULIS_ERROR_BAD_INPUT_DATA ) );
 
     FEvent xpass_event;
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleBuildPremultipliedSATXPass
             , new FDualBufferCommandArgs(
@@ -128,6 +130,7 @@ FContext::BuildPremultipliedSummedAreaTable(
             , &xpass_event
             , iDestination.Rect()
         )
+        , __func__
     );
 
     // Dirty tricks for SAT:
@@ -144,7 +147,7 @@ FContext::BuildPremultipliedSummedAreaTable(
             }
         )
     );
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleBuildPremultipliedSATYPass
             , new FDualBufferCommandArgs(
@@ -161,6 +164,7 @@ FContext::BuildPremultipliedSummedAreaTable(
             , &ypass_event
             , iDestination.Rect()
         )
+        , __func__
     );
     // Reset fake rotation to avoid ambiguous rect work
     fakeSourceRotated->LoadFromData( fakeSourceRotated->Bits(), iSource.Width(), iSource.Height(), iSource.Format(), nullptr, FOnInvalidBlock(), FOnCleanupData() );
@@ -0,0 +1,1255 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         Context.Sparse.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the implementation of the tiled block API
+*               entry points in the FContext class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Context/Context.h"
+#include "Image/Block.h"
+#include "Scheduling/Event.h"
+#include "Sparse/TiledBlock.h"
+#include "Sparse/TilePool.h"
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+// Geometry helpers
+// A part of a source, in the coordinates of its block, and its origin in the
+// source. Empty tiles read from the empty tile of the pool.
+struct FSourcePart
+{
+    const FBlock* block;
+    FTileElement* tile;
+    FRectI rect;
+    FVec2I origin;
+    bool bEmpty;
+};
+
+// A part of a destination: the rect to process, inside the rect of a tile,
+// in the coordinates of the destination. A FBlock is a single tile. The part
+// is whole when it covers all the pixels of the tile that can be read, the
+// pixels of a tile beyond the bounds of a large block are never read.
+struct FTargetPart
+{
+    FVec2I tile;
+    FRectI rect;
+    FRectI tileRect;
+    bool bWhole;
+};
+
+static
+FRectI
+SourceRoi( const FBlock& iSource, const FRectI& iSourceRect )
+{
+    return  iSourceRect.Sanitized() & iSource.Rect();
+}
+
+static
+FRectI
+SourceRoi( const FTiledBlock& iSource, const FRectI& iSourceRect )
+{
+    if( iSource.IsBounded() )
+        return  iSourceRect == FRectI::Auto ? iSource.Bounds() : iSourceRect.Sanitized() & iSource.Bounds();
+
+    return  iSourceRect == FRectI::Auto ? iSource.Rect() : iSourceRect.Sanitized();
+}
+
+static
+FRectI
+ClipDestination( const FBlock& iDestination, const FRectI& iRect )
+{
+    return  iRect & iDestination.Rect();
+}
+
+static
+FRectI
+ClipDestination( const FTiledBlock& iDestination, const FRectI& iRect )
+{
+    return  iDestination.IsBounded() ? iRect & iDestination.Bounds() : iRect;
+}
+
+// Destination rect of a resize, before clipping.
+static
+FRectF
+DestinationAim( const FBlock&, const FRectF& iRect )
+{
+    return  iRect.Sanitized();
+}
+
+static
+FRectF
+DestinationAim( const FTiledBlock& iDestination, const FRectF& iRect )
+{
+    return  iRect == FRectF::Auto ? FRectF( SourceRoi( iDestination, FRectI::Auto ) ) : iRect.Sanitized();
+}
+
+static
+FRectF
+ClipDestination( const FBlock& iDestination, const FRectF& iRect )
+{
+    return  iRect & FRectF( iDestination.Rect() );
+}
+
+static
+FRectF
+ClipDestination( const FTiledBlock& iDestination, const FRectF& iRect )
+{
+    return  iDestination.IsBounded() ? iRect & FRectF( iDestination.Bounds() ) : iRect;
+}
+
+static
+bool
+IsEmptyRect( const FRectI& iRect )
+{
+    return  iRect.w <= 0 || iRect.h <= 0;
+}
+
+static
+void
+GatherSource( const FBlock& iSource, const FRectI& iRect, std::vector< FSourcePart >* oParts )
+{
+    oParts->clear();
+    oParts->push_back( { &iSource, nullptr, iRect, iRect.Position(), false } );
+}
+
+static
+void
+GatherSource( const FTiledBlock& iSource, const FRectI& iRect, std::vector< FSourcePart >* oParts )
+{
+    oParts->clear();
+    const FRectI range = iSource.TileRange( iRect );
+    for( int y = range.y; y < range.y + range.h; ++y ) {
+        for( int x = range.x; x < range.x + range.w; ++x ) {
+            const FVec2I coords( x, y );
+            const FRectI tileRect = iSource.TileRect( coords );
+            const FRectI inter = iRect & tileRect;
+            FTileElement* tile = iSource.QueryTile( coords );
+            const FBlock* block = tile ? tile->mBlock : &( iSource.TilePool().EmptyTile() );
+            oParts->push_back( { block, tile, FRectI::FromPositionAndSize( inter.Position() - tileRect.Position(), inter.Size() ), inter.Position(), tile == nullptr } );
+        }
+    }
+}
+
+static
+void
+GatherTargets( const FBlock& iDestination, const FRectI& iRoi, std::vector< FTargetPart >* oParts )
+{
+    oParts->clear();
+    oParts->push_back( { FVec2I( 0 ), iRoi, iDestination.Rect(), iRoi == iDestination.Rect() } );
+}
+
+static
+void
+GatherTargets( const FTiledBlock& iDestination, const FRectI& iRoi, std::vector< FTargetPart >* oParts )
+{
+    oParts->clear();
+    const FRectI range = iDestination.TileRange( iRoi );
+    for( int y = range.y; y < range.y + range.h; ++y ) {
+        for( int x = range.x; x < range.x + range.w; ++x ) {
+            const FVec2I coords( x, y );
+            const FRectI tileRect = iDestination.TileRect( coords );
+            const FRectI readable = iDestination.IsBounded() ? tileRect & iDestination.Bounds() : tileRect;
+            oParts->push_back( { coords, iRoi & tileRect, tileRect, ( iRoi & tileRect ) == readable } );
+        }
+    }
+}
+
+static
+bool
+IsEmptyTarget( const FBlock&, const FTargetPart& )
+{
+    return  false;
+}
+
+static
+bool
+IsEmptyTarget( const FTiledBlock& iDestination, const FTargetPart& iTarget )
+{
+    return  iDestination.QueryTile( iTarget.tile ) == nullptr;
+}
+
+/////////////////////////////////////////////////////
+// FTiledOperation
+// Collects the commands of an operation on tiled blocks with the tiles they
+// use, which stay pinned until all of them are done, and aggregates their
+// events in the event of the operation. The tiles that are swapped out or
+// compressed are paged in by commands that the ones reading them wait for.
+class FTiledOperation
+{
+public:
+    FTiledOperation(
+          FContext& iContext
+        , const FSchedulePolicy& iPolicy
+        , uint32 iNumWait
+        , const FEvent* iWaitList
+    )
+        : mContext( iContext )
+        , mPolicy( iPolicy )
+        , mPagingPolicy( ScheduleTime_Async, iPolicy.RunPolicy(), iPolicy.ModePolicy(), iPolicy.ParameterPolicy(), iPolicy.Value() )
+        , bPaging( false )
+        , mNumWait( iNumWait )
+        , mWaitList( iWaitList )
+    {}
+
+    // Policy of the next commands. Once a tile is paged in, they build their
+    // jobs when they are ready rather than when pushed, the bits of the tiles
+    // they wait for are not there yet.
+    const FSchedulePolicy& Policy() const {
+        return  bPaging ? mPagingPolicy : mPolicy;
+    }
+
+    // Wait list of the user, followed by the extra events.
+    uint32 WaitFor( const std::vector< FEvent >& iExtra, const FEvent** oWaitList ) {
+        if( iExtra.empty() ) {
+            *oWaitList = mWaitList;
+            return  mNumWait;
+        }
+
+        mScratch.assign( mWaitList, mWaitList + mNumWait );
+        mScratch.insert( mScratch.end(), iExtra.begin(), iExtra.end() );
+        *oWaitList = mScratch.data();
+        return  static_cast< uint32 >( mScratch.size() );
+    }
+
+    FEvent* NewEvent() {
+        mEvents.emplace_back();
+        return  &mEvents.back();
+    }
+
+    void Pin( FTilePool& iPool, FTileElement* iTile ) {
+        if( !iTile )
+            return;
+
+        iPool.PinTile( iTile );
+        mPinned.emplace_back( &iPool, iTile );
+    }
+
+    // Pin a tile that is read or written, the extra event has to be waited
+    // for if it is paged in.
+    void Fetch( FTilePool& iPool, FTileElement* iTile, std::vector< FEvent >* oExtra ) {
+        if( !iTile )
+            return;
+
+        Pin( iPool, iTile );
+        FEvent pageIn;
+        bool schedule = false;
+        if( iPool.RequestPageIn( iTile, &pageIn, &schedule ) ) {
+            if( schedule )
+                mContext.Generic_OP( [&iPool, iTile]() { iPool.PageIn( iTile ); }, 0, nullptr, &pageIn );
+            oExtra->push_back( pageIn );
+            bPaging = true;
+        }
+    }
+
+    void Fetch( const FSourcePart&, const FBlock&, std::vector< FEvent >* ) {
+    }
+
+    void Fetch( const FSourcePart& iPart, const FTiledBlock& iSource, std::vector< FEvent >* oExtra ) {
+        Fetch( iSource.TilePool(), iPart.tile, oExtra );
+    }
+
+    void Keep( FBlock* iTemporary ) {
+        mTemporaries.push_back( iTemporary );
+    }
+
+    // The block to write a FBlock destination, it is ready.
+    FBlock* Writable( FBlock& iDestination, const FTargetPart&, bool, std::vector< FEvent >* ) {
+        return  &iDestination;
+    }
+
+    // The block to write a tile of a tiled destination. An empty tile is
+    // allocated, cleared unless it is overwritten, and a shared tile is
+    // copied, the extra event has to be waited for.
+    FBlock* Writable( FTiledBlock& iDestination, const FTargetPart& iTarget, bool iOverwritten, std::vector< FEvent >* oExtra ) {
+        FTilePool& pool = iDestination.TilePool();
+        FTileElement* tile = iDestination.QueryTile( iTarget.tile );
+        if( tile && pool.MakeWritable( tile ) ) {
+            Fetch( pool, tile, oExtra );
+            return  tile->mBlock;
+        }
+
+        FTileElement* fresh = pool.QueryFreshTile();
+        Pin( pool, fresh );
+        if( !iOverwritten ) {
+            FEvent* prep = NewEvent();
+            if( tile ) {
+                std::vector< FEvent > ready;
+                Fetch( pool, tile, &ready );
+                const FEvent* waitList = nullptr;
+                const uint32 numWait = WaitFor( ready, &waitList );
+                mContext.Copy( *( tile->mBlock ), *( fresh->mBlock ), tile->mBlock->Rect(), FVec2I( 0 ), Policy(), numWait, waitList, prep );
+            } else {
+                mContext.Clear( *( fresh->mBlock ), fresh->mBlock->Rect(), Policy(), mNumWait, mWaitList, prep );
+            }
+            oExtra->push_back( *prep );
+        }
+        iDestination.SetTile( iTarget.tile, fresh );
+        pool.ReleaseTile( fresh );
+        return  fresh->mBlock;
+    }
+
+    // Empty a part of a FBlock destination.
+    void Empty( FBlock& iDestination, const FTargetPart& iTarget ) {
+        mContext.Clear( iDestination, iTarget.rect, Policy(), mNumWait, mWaitList, NewEvent() );
+    }
+
+    // Empty a part of a tiled destination, a whole tile is released.
+    void Empty( FTiledBlock& iDestination, const FTargetPart& iTarget ) {
+        if( iTarget.bWhole ) {
+            iDestination.SetTile( iTarget.tile, nullptr );
+            return;
+        }
+
+        if( IsEmptyTarget( iDestination, iTarget ) )
+            return;
+
+        std::vector< FEvent > extra;
+        FBlock* block = Writable( iDestination, iTarget, false, &extra );
+        const FEvent* waitList = nullptr;
+        const uint32 numWait = WaitFor( extra, &waitList );
+        mContext.Clear( *block, FRectI::FromPositionAndSize( iTarget.rect.Position() - iTarget.tileRect.Position(), iTarget.rect.Size() ), Policy(), numWait, waitList, NewEvent() );
+    }
+
+    // Aggregate the events, the pinned tiles and temporary blocks are
+    // released once all the commands are done.
+    ulError Finish( FEvent* iEvent ) {
+        if( mEvents.empty() ) {
+            ULIS_ASSERT( mPinned.empty() && mTemporaries.empty(), "Tiles pinned without commands" );
+            return  mContext.FinishEventNo_OP( iEvent, ULIS_NO_ERROR );
+        }
+
+        std::vector< std::pair< FTilePool*, FTileElement* > > pinned( std::move( mPinned ) );
+        std::vector< FBlock* > temporaries( std::move( mTemporaries ) );
+        FEvent done(
+            FOnEventComplete(
+                [pinned, temporaries]( const FRectI& ) {
+                    for( auto& pin : pinned )
+                        pin.first->UnpinTile( pin.second );
+                    for( auto temporary : temporaries )
+                        delete  temporary;
+                }
+            )
+        );
+        mContext.Dummy_OP( static_cast< uint32 >( mEvents.size() ), mEvents.data(), &done );
+        if( iEvent )
+            mContext.Dummy_OP( 1, &done, iEvent );
+
+        return  ULIS_NO_ERROR;
+    }
+
+private:
+    FContext& mContext;
+    const FSchedulePolicy& mPolicy;
+    const FSchedulePolicy mPagingPolicy;
+    bool bPaging;
+    const uint32 mNumWait;
+    const FEvent* mWaitList;
+    std::vector< FEvent > mEvents;
+    std::vector< FEvent > mScratch;
+    std::vector< std::pair< FTilePool*, FTileElement* > > mPinned;
+    std::vector< FBlock* > mTemporaries;
+};
+
+/////////////////////////////////////////////////////
+// Generic implementations
+template< typename TSource >
+static
+constexpr bool
+IsTiled()
+{
+    return  std::is_same< TSource, FTiledBlock >::value;
+}
+
+// A whole source tile can be shared by a whole destination tile.
+template< typename TSource, typename TDestination >
+static
+bool
+CanShareTile( const TSource&, const TDestination&, const FTargetPart&, const std::vector< FSourcePart >& )
+{
+    return  false;
+}
+
+template<>
+bool
+CanShareTile( const FTiledBlock& iSource, const FTiledBlock& iDestination, const FTargetPart& iTarget, const std::vector< FSourcePart >& iParts )
+{
+    return  &iSource.TilePool() == &iDestination.TilePool()
+        && iTarget.rect == iTarget.tileRect
+        && iParts.size() == 1
+        && iParts[0].rect == FRectI( 0, 0, iSource.TileSize(), iSource.TileSize() );
+}
+
+template< typename TSource, typename TDestination >
+static
+ulError
+CopySparse(
+      FContext& iContext
+    , const TSource& iSource
+    , TDestination& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    ULIS_ASSERT_RETURN_ERROR(
+          iSource.Format() == iDestination.Format() && iSource.Format() == iContext.Format()
+        , "Formats mismatch."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_FORMATS_MISMATCH )
+    );
+
+    // Sanitize geometry
+    const FRectI src_aim = SourceRoi( iSource, iSourceRect );
+    const FRectI dst_roi = ClipDestination( iDestination, FRectI::FromPositionAndSize( iPosition, src_aim.Size() ) );
+
+    // Check no-op
+    if( IsEmptyRect( src_aim ) || IsEmptyRect( dst_roi ) )
+        return  iContext.FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    const FVec2I shift = src_aim.Position() - iPosition;
+    FTiledOperation op( iContext, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    std::vector< FSourcePart > parts;
+    GatherTargets( iDestination, dst_roi, &targets );
+    for( auto& target : targets ) {
+        GatherSource( iSource, FRectI::FromPositionAndSize( target.rect.Position() + shift, target.rect.Size() ), &parts );
+
+        // Aligned tiles of the same pool are shared.
+        if( CanShareTile( iSource, iDestination, target, parts ) ) {
+            if constexpr( IsTiled< TSource >() && IsTiled< TDestination >() )
+                iDestination.SetTile( target.tile, parts[0].tile );
+            continue;
+        }
+
+        bool allEmpty = true;
+        for( auto& part : parts )
+            allEmpty = allEmpty && part.bEmpty;
+
+        if( allEmpty ) {
+            op.Empty( iDestination, target );
+            continue;
+        }
+
+        std::vector< FEvent > extra;
+        FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+        for( auto& part : parts )
+            op.Fetch( part, iSource, &extra );
+        const FEvent* waitList = nullptr;
+        const uint32 numWait = op.WaitFor( extra, &waitList );
+        for( auto& part : parts ) {
+            const FVec2I position = part.origin - shift - target.tileRect.Position();
+            if( part.bEmpty ) {
+                iContext.Clear( *block, FRectI::FromPositionAndSize( position, part.rect.Size() ), op.Policy(), numWait, waitList, op.NewEvent() );
+            } else {
+                iContext.Copy( *part.block, *block, part.rect, position, op.Policy(), numWait, waitList, op.NewEvent() );
+            }
+        }
+    }
+
+    return  op.Finish( iEvent );
+}
+
+template< typename TSource, typename TDestination >
+static
+ulError
+ConvertFormatSparse(
+      FContext& iContext
+    , const TSource& iSource
+    , TDestination& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    // In case of same format, the faster Copy version can share the tiles.
+    if( iSource.Format() == iDestination.Format() )
+        return  CopySparse( iContext, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+
+    // The tiles of the destination are prepared with the context.
+    ULIS_ASSERT_RETURN_ERROR(
+          iDestination.Format() == iContext.Format()
+        , "Formats mismatch."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_FORMATS_MISMATCH )
+    );
+
+    // Sanitize geometry
+    const FRectI src_aim = SourceRoi( iSource, iSourceRect );
+    const FRectI dst_roi = ClipDestination( iDestination, FRectI::FromPositionAndSize( iPosition, src_aim.Size() ) );
+
+    // Check no-op
+    if( IsEmptyRect( src_aim ) || IsEmptyRect( dst_roi ) )
+        return  iContext.FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    const FVec2I shift = src_aim.Position() - iPosition;
+    FTiledOperation op( iContext, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    std::vector< FSourcePart > parts;
+    GatherTargets( iDestination, dst_roi, &targets );
+    for( auto& target : targets ) {
+        GatherSource( iSource, FRectI::FromPositionAndSize( target.rect.Position() + shift, target.rect.Size() ), &parts );
+        bool allEmpty = true;
+        for( auto& part : parts )
+            allEmpty = allEmpty && part.bEmpty;
+
+        if( allEmpty ) {
+            op.Empty( iDestination, target );
+            continue;
+        }
+
+        std::vector< FEvent > extra;
+        FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+        for( auto& part : parts )
+            op.Fetch( part, iSource, &extra );
+        const FEvent* waitList = nullptr;
+        const uint32 numWait = op.WaitFor( extra, &waitList );
+        for( auto& part : parts ) {
+            const FVec2I position = part.origin - shift - target.tileRect.Position();
+            if( part.bEmpty ) {
+                iContext.Clear( *block, FRectI::FromPositionAndSize( position, part.rect.Size() ), op.Policy(), numWait, waitList, op.NewEvent() );
+            } else {
+                iContext.ConvertFormat( *part.block, *block, part.rect, position, op.Policy(), numWait, waitList, op.NewEvent() );
+            }
+        }
+    }
+
+    return  op.Finish( iEvent );
+}
+
+template< typename TSource, typename TDestination >
+static
+ulError
+BlendSparse(
+      FContext& iContext
+    , const TSource& iSource
+    , TDestination& iBackdrop
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , eBlendMode iBlendingMode
+    , eAlphaMode iAlphaMode
+    , ufloat iOpacity
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    ULIS_ASSERT_RETURN_ERROR(
+          iSource.Format() == iBackdrop.Format() && iSource.Format() == iContext.Format()
+        , "Formats mismatch."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_FORMATS_MISMATCH )
+    );
+
+    // Sanitize geometry
+    const FRectI src_aim = SourceRoi( iSource, iSourceRect );
+    const FRectI dst_roi = ClipDestination( iBackdrop, FRectI::FromPositionAndSize( iPosition, src_aim.Size() ) );
+
+    // Check no-op
+    if( IsEmptyRect( src_aim ) || IsEmptyRect( dst_roi ) )
+        return  iContext.FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    // A transparent source leaves the backdrop untouched, unless the alpha
+    // mode lowers the alpha of the backdrop.
+    const bool skipEmpty = iAlphaMode != Alpha_Top && iAlphaMode != Alpha_Mul && iAlphaMode != Alpha_Min;
+
+    const FVec2I shift = src_aim.Position() - iPosition;
+    FTiledOperation op( iContext, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    std::vector< FSourcePart > parts;
+    GatherTargets( iBackdrop, dst_roi, &targets );
+    for( auto& target : targets ) {
+        GatherSource( iSource, FRectI::FromPositionAndSize( target.rect.Position() + shift, target.rect.Size() ), &parts );
+        bool allEmpty = true;
+        for( auto& part : parts )
+            allEmpty = allEmpty && part.bEmpty;
+
+        if( allEmpty && ( skipEmpty || IsEmptyTarget( iBackdrop, target ) ) )
+            continue;
+
+        std::vector< FEvent > extra;
+        FBlock* block = op.Writable( iBackdrop, target, false, &extra );
+        for( auto& part : parts )
+            op.Fetch( part, iSource, &extra );
+        const FEvent* waitList = nullptr;
+        const uint32 numWait = op.WaitFor( extra, &waitList );
+        for( auto& part : parts ) {
+            if( part.bEmpty && skipEmpty )
+                continue;
+
+            iContext.Blend( *part.block, *block, part.rect, part.origin - shift - target.tileRect.Position(), iBlendingMode, iAlphaMode, iOpacity, op.Policy(), numWait, waitList, op.NewEvent() );
+        }
+    }
+
+    return  op.Finish( iEvent );
+}
+
+template< typename TSource, typename TDestination >
+static
+ulError
+ResizeSparse(
+      FContext& iContext
+    , const TSource& iSource
+    , TDestination& iDestination
+    , const FRectI& iSourceRect
+    , const FRectF& iDestinationRect
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    ULIS_ASSERT_RETURN_ERROR(
+          iSource.Format() == iDestination.Format() && iSource.Format() == iContext.Format()
+        , "Formats mismatch."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_FORMATS_MISMATCH )
+    );
+
+    // Sanitize geometry
+    const FRectI src_roi = SourceRoi( iSource, iSourceRect );
+    const FRectF dst_aim = ClipDestination( iDestination, DestinationAim( iDestination, iDestinationRect ) );
+    const FRectI dst_roi = dst_aim;
+
+    // Check no-op
+    if( IsEmptyRect( src_roi ) || IsEmptyRect( dst_roi ) )
+        return  iContext.FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    // A single pixel of the destination must not read more than a temporary
+    // block can hold.
+    const FVec2F inverseScale = FRectF( src_roi ).Size() / dst_aim.Size();
+    const int maxGather = 1024;
+    ULIS_ASSERT_RETURN_ERROR(
+          !IsTiled< TSource >() || ( inverseScale.x < maxGather / 2 && inverseScale.y < maxGather / 2 )
+        , "Downscale too large for a tiled source."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_BAD_INPUT_DATA )
+    );
+
+    FTiledOperation op( iContext, iPolicy, iNumWait, iWaitList );
+
+    // A FBlock source is read directly, with a single summed area table.
+    const FBlock* sat = nullptr;
+    std::vector< FEvent > satReady;
+    if constexpr( !IsTiled< TSource >() ) {
+        if( iResamplingMethod == Resampling_Area ) {
+            FBlock* table = new FBlock(); // Hollow
+            op.Keep( table );
+            FEvent* alloc = op.NewEvent();
+            iContext.XAllocateBlockData( *table, iSource.Width(), iSource.Height(), FContext::SummedAreaTableMetrics( iSource ), nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ), op.Policy(), iNumWait, iWaitList, alloc );
+            const FEvent allocated = *alloc;
+            FEvent* built = op.NewEvent();
+            iContext.BuildSummedAreaTable( iSource, *table, op.Policy(), 1, &allocated, built );
+            satReady.push_back( *built );
+            sat = table;
+        }
+    }
+
+    // Resampling reads up to two pixels around the mapped position.
+    const int margin = 3;
+
+    // A part of a target, and the part of the source it reads.
+    struct FPiece
+    {
+        FRectI rect;
+        FRectI need;
+        bool bEmpty;
+    };
+    std::vector< FPiece > pieces;
+
+    std::vector< FTargetPart > targets;
+    std::vector< FSourcePart > parts;
+    GatherTargets( iDestination, dst_roi, &targets );
+    for( auto& target : targets ) {
+        // Each tile is resized with the scale of the whole destination.
+        const FRectF aim( dst_aim.x - target.tileRect.x, dst_aim.y - target.tileRect.y, dst_aim.w, dst_aim.h );
+        if constexpr( !IsTiled< TSource >() ) {
+            std::vector< FEvent > extra( satReady );
+            FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+            const FEvent* waitList = nullptr;
+            const uint32 numWait = op.WaitFor( extra, &waitList );
+            const FRectI local = FRectI::FromPositionAndSize( target.rect.Position() - target.tileRect.Position(), target.rect.Size() );
+            iContext.ResizePart( iSource, *block, src_roi, aim, local, iResamplingMethod, iBorderMode, iBorderValue, sat, op.Policy(), numWait, waitList, op.NewEvent() );
+        } else {
+            // Split the target so that the part of the source read by each
+            // piece fits in a temporary block of maxGather pixels.
+            const int64 nx = FMath::Max( int64( 1 ), static_cast< int64 >( std::ceil( target.rect.w * inverseScale.x / ( maxGather - margin * 2 - 2 - inverseScale.x ) ) ) );
+            const int64 ny = FMath::Max( int64( 1 ), static_cast< int64 >( std::ceil( target.rect.h * inverseScale.y / ( maxGather - margin * 2 - 2 - inverseScale.y ) ) ) );
+            pieces.clear();
+            bool allEmpty = true;
+            for( int64 py = 0; py < ny; ++py ) {
+                for( int64 px = 0; px < nx; ++px ) {
+                    const FRectI rect = FRectI::FromMinMax(
+                          static_cast< int >( target.rect.x + target.rect.w * px / nx )
+                        , static_cast< int >( target.rect.y + target.rect.h * py / ny )
+                        , static_cast< int >( target.rect.x + target.rect.w * ( px + 1 ) / nx )
+                        , static_cast< int >( target.rect.y + target.rect.h * ( py + 1 ) / ny )
+                    );
+                    if( IsEmptyRect( rect ) )
+                        continue;
+
+                    const FRectI need = FRectI::FromMinMax(
+                          static_cast< int >( std::floor( ( rect.x - dst_aim.x ) * inverseScale.x + src_roi.x ) ) - margin
+                        , static_cast< int >( std::floor( ( rect.y - dst_aim.y ) * inverseScale.y + src_roi.y ) ) - margin
+                        , static_cast< int >( std::ceil( ( rect.x + rect.w - dst_aim.x ) * inverseScale.x + src_roi.x ) ) + margin
+                        , static_cast< int >( std::ceil( ( rect.y + rect.h - dst_aim.y ) * inverseScale.y + src_roi.y ) ) + margin
+                    ) & src_roi;
+
+                    bool empty = true;
+                    if( !IsEmptyRect( need ) ) {
+                        GatherSource( iSource, need, &parts );
+                        for( auto& part : parts )
+                            empty = empty && part.bEmpty;
+                    }
+                    pieces.push_back( { rect, need, empty } );
+                    allEmpty = allEmpty && empty;
+                }
+            }
+
+            if( allEmpty && iBorderMode == Border_Transparent ) {
+                op.Empty( iDestination, target );
+                continue;
+            }
+
+            std::vector< FEvent > prep;
+            FBlock* block = op.Writable( iDestination, target, target.bWhole, &prep );
+            for( auto& piece : pieces ) {
+                const FRectI local = FRectI::FromPositionAndSize( piece.rect.Position() - target.tileRect.Position(), piece.rect.Size() );
+                if( IsEmptyRect( piece.need ) || ( piece.bEmpty && iBorderMode == Border_Transparent ) ) {
+                    const FEvent* waitList = nullptr;
+                    const uint32 numWait = op.WaitFor( prep, &waitList );
+                    iContext.Clear( *block, local, op.Policy(), numWait, waitList, op.NewEvent() );
+                    continue;
+                }
+
+                // Gather the source, resize it, and free it once it is read.
+                FBlock* temporary = new FBlock( static_cast< uint16 >( piece.need.w ), static_cast< uint16 >( piece.need.h ), iContext.Format() );
+                op.Keep( temporary );
+                std::vector< FEvent > extra( prep );
+                GatherSource( iSource, piece.need, &parts );
+                for( auto& part : parts ) {
+                    std::vector< FEvent > ready;
+                    op.Fetch( part, iSource, &ready );
+                    const FEvent* readyList = nullptr;
+                    const uint32 numReady = op.WaitFor( ready, &readyList );
+                    FEvent* ev = op.NewEvent();
+                    const FVec2I position = part.origin - piece.need.Position();
+                    if( part.bEmpty ) {
+                        iContext.Clear( *temporary, FRectI::FromPositionAndSize( position, part.rect.Size() ), op.Policy(), numReady, readyList, ev );
+                    } else {
+                        iContext.Copy( *part.block, *temporary, part.rect, position, op.Policy(), numReady, readyList, ev );
+                    }
+                    extra.push_back( *ev );
+                }
+
+                const FEvent* waitList = nullptr;
+                const uint32 numWait = op.WaitFor( extra, &waitList );
+                const FRectI src = FRectI::FromPositionAndSize( src_roi.Position() - piece.need.Position(), src_roi.Size() );
+                FEvent* ev = op.NewEvent();
+                iContext.ResizePart( *temporary, *block, src, aim, local, iResamplingMethod, iBorderMode, iBorderValue, nullptr, op.Policy(), numWait, waitList, ev );
+                const FEvent resized = *ev;
+                iContext.XDeallocateBlockData( *temporary, op.Policy(), 1, &resized, op.NewEvent() );
+            }
+        }
+    }
+
+    return  op.Finish( iEvent );
+}
+
+template< typename TSource, typename TDestination >
+static
+ulError
+TransformAffineSparse(
+      FContext& iContext
+    , const TSource& iSource
+    , TDestination& iDestination
+    , const FRectI& iSourceRect
+    , const FMat3F& iTransformMatrix
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    ULIS_ASSERT_RETURN_ERROR(
+          iSource.Format() == iDestination.Format() && iSource.Format() == iContext.Format()
+        , "Formats mismatch."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_FORMATS_MISMATCH )
+    );
+
+    ULIS_ASSERT_RETURN_ERROR(
+          !IsTiled< TSource >() || iBorderMode == Border_Transparent || iBorderMode == Border_Constant
+        , "Border mode not supported with a tiled source."
+        , iContext.FinishEventNo_OP( iEvent, ULIS_ERROR_BAD_INPUT_DATA )
+    );
+
+    // Sanitize geometry
+    const FRectI src_roi = SourceRoi( iSource, iSourceRect );
+    const FRectI dst_aim = FContext::TransformAffineMetrics( src_roi, iTransformMatrix );
+    const FRectI dst_roi = ClipDestination( iDestination, dst_aim );
+
+    // Check no-op
+    if( IsEmptyRect( src_roi ) || IsEmptyRect( dst_roi ) )
+        return  iContext.FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    // Resampling reads up to two pixels around the mapped position.
+    const FMat3F inverse = iTransformMatrix.Inverse();
+    const int margin = 3;
+
+    FTiledOperation op( iContext, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    std::vector< FSourcePart > parts;
+    GatherTargets( iDestination, dst_roi, &targets );
+    for( auto& target : targets ) {
+        const FMat3F toTile = FMat3F::MakeTranslationMatrix( static_cast< float >( -target.tileRect.x ), static_cast< float >( -target.tileRect.y ) ) * iTransformMatrix;
+        if constexpr( !IsTiled< TSource >() ) {
+            // The whole target is written by the transform.
+            std::vector< FEvent > extra;
+            FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+            const FEvent* waitList = nullptr;
+            const uint32 numWait = op.WaitFor( extra, &waitList );
+            iContext.TransformAffine( iSource, *block, src_roi, toTile, iResamplingMethod, iBorderMode, iBorderValue, op.Policy(), numWait, waitList, op.NewEvent() );
+        } else {
+            // Gather the part of the source read for this target.
+            const FRectI read = target.rect.TransformedAffine( inverse );
+            const FRectI need = FRectI( read.x - margin, read.y - margin, read.w + margin * 2, read.h + margin * 2 ) & src_roi;
+            bool allEmpty = true;
+            if( !IsEmptyRect( need ) ) {
+                GatherSource( iSource, need, &parts );
+                for( auto& part : parts )
+                    allEmpty = allEmpty && part.bEmpty;
+            }
+
+            if( allEmpty && ( iBorderMode == Border_Transparent || IsEmptyRect( need ) ) ) {
+                if( iBorderMode == Border_Transparent ) {
+                    op.Empty( iDestination, target );
+                } else {
+                    std::vector< FEvent > extra;
+                    FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+                    const FEvent* waitList = nullptr;
+                    const uint32 numWait = op.WaitFor( extra, &waitList );
+                    iContext.Fill( *block, iBorderValue, FRectI::FromPositionAndSize( target.rect.Position() - target.tileRect.Position(), target.rect.Size() ), op.Policy(), numWait, waitList, op.NewEvent() );
+                }
+                continue;
+            }
+
+            FBlock* temporary = new FBlock( static_cast< uint16 >( need.w ), static_cast< uint16 >( need.h ), iContext.Format() );
+            op.Keep( temporary );
+            std::vector< FEvent > extra;
+            for( auto& part : parts ) {
+                std::vector< FEvent > ready;
+                op.Fetch( part, iSource, &ready );
+                const FEvent* readyList = nullptr;
+                const uint32 numReady = op.WaitFor( ready, &readyList );
+                FEvent* ev = op.NewEvent();
+                const FVec2I position = part.origin - need.Position();
+                if( part.bEmpty ) {
+                    iContext.Clear( *temporary, FRectI::FromPositionAndSize( position, part.rect.Size() ), op.Policy(), numReady, readyList, ev );
+                } else {
+                    iContext.Copy( *part.block, *temporary, part.rect, position, op.Policy(), numReady, readyList, ev );
+                }
+                extra.push_back( *ev );
+            }
+
+            // The pixels of the target that map outside of the source get
+            // the border value, the transform of the gathered part does not
+            // reach all of them.
+            FBlock* block = op.Writable( iDestination, target, target.bWhole, &extra );
+            const FRectI local = FRectI::FromPositionAndSize( target.rect.Position() - target.tileRect.Position(), target.rect.Size() );
+            const FRectI reached = FContext::TransformAffineMetrics( need, iTransformMatrix ) & target.rect;
+            if( reached != target.rect ) {
+                const FEvent* waitList = nullptr;
+                const uint32 numWait = op.WaitFor( extra, &waitList );
+                FEvent* ev = op.NewEvent();
+                if( iBorderMode == Border_Constant )
+                    iContext.Fill( *block, iBorderValue, local, op.Policy(), numWait, waitList, ev );
+                else
+                    iContext.Clear( *block, local, op.Policy(), numWait, waitList, ev );
+                extra.push_back( *ev );
+            }
+
+            const FEvent* waitList = nullptr;
+            const uint32 numWait = op.WaitFor( extra, &waitList );
+            const FMat3F fromTemporary = toTile * FMat3F::MakeTranslationMatrix( static_cast< float >( need.x ), static_cast< float >( need.y ) );
+            iContext.TransformAffine( *temporary, *block, temporary->Rect(), fromTemporary, iResamplingMethod, iBorderMode, iBorderValue, op.Policy(), numWait, waitList, op.NewEvent() );
+        }
+    }
+
+    return  op.Finish( iEvent );
+}
+
+/////////////////////////////////////////////////////
+// Entry points
+ulError
+FContext::Blend(
+      const FTiledBlock& iSource
+    , FTiledBlock& iBackdrop
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , eBlendMode iBlendingMode
+    , eAlphaMode iAlphaMode
+    , ufloat iOpacity
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  BlendSparse( *this, iSource, iBackdrop, iSourceRect, iPosition, iBlendingMode, iAlphaMode, iOpacity, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Blend(
+      const FBlock& iSource
+    , FTiledBlock& iBackdrop
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , eBlendMode iBlendingMode
+    , eAlphaMode iAlphaMode
+    , ufloat iOpacity
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  BlendSparse( *this, iSource, iBackdrop, iSourceRect, iPosition, iBlendingMode, iAlphaMode, iOpacity, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Blend(
+      const FTiledBlock& iSource
+    , FBlock& iBackdrop
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , eBlendMode iBlendingMode
+    , eAlphaMode iAlphaMode
+    , ufloat iOpacity
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  BlendSparse( *this, iSource, iBackdrop, iSourceRect, iPosition, iBlendingMode, iAlphaMode, iOpacity, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Clear(
+      FTiledBlock& iBlock
+    , const FRectI& iRect
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    // Sanitize geometry
+    const FRectI roi = SourceRoi( iBlock, iRect );
+
+    // Check no-op
+    if( IsEmptyRect( roi ) )
+        return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    FTiledOperation op( *this, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    GatherTargets( iBlock, roi, &targets );
+    for( auto& target : targets )
+        op.Empty( iBlock, target );
+
+    return  op.Finish( iEvent );
+}
+
+ulError
+FContext::ConvertFormat(
+      const FTiledBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ConvertFormatSparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::ConvertFormat(
+      const FBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ConvertFormatSparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::ConvertFormat(
+      const FTiledBlock& iSource
+    , FBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ConvertFormatSparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Copy(
+      const FTiledBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  CopySparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Copy(
+      const FBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  CopySparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Copy(
+      const FTiledBlock& iSource
+    , FBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FVec2I& iPosition
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  CopySparse( *this, iSource, iDestination, iSourceRect, iPosition, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Fill(
+      FTiledBlock& iBlock
+    , const ISample& iColor
+    , const FRectI& iRect
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    // Sanitize geometry
+    const FRectI roi = SourceRoi( iBlock, iRect );
+
+    // Check no-op
+    if( IsEmptyRect( roi ) )
+        return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    // Whole tiles share a single filled tile.
+    FTilePool& pool = iBlock.TilePool();
+    FTileElement* filled = nullptr;
+    FTiledOperation op( *this, iPolicy, iNumWait, iWaitList );
+    std::vector< FTargetPart > targets;
+    GatherTargets( iBlock, roi, &targets );
+    for( auto& target : targets ) {
+        if( target.bWhole ) {
+            if( !filled ) {
+                filled = pool.QueryFreshTile();
+                op.Pin( pool, filled );
+                Fill( *( filled->mBlock ), iColor, filled->mBlock->Rect(), op.Policy(), iNumWait, iWaitList, op.NewEvent() );
+            }
+            iBlock.SetTile( target.tile, filled );
+            continue;
+        }
+
+        std::vector< FEvent > extra;
+        FBlock* block = op.Writable( iBlock, target, false, &extra );
+        const FEvent* waitList = nullptr;
+        const uint32 numWait = op.WaitFor( extra, &waitList );
+        Fill( *block, iColor, FRectI::FromPositionAndSize( target.rect.Position() - target.tileRect.Position(), target.rect.Size() ), op.Policy(), numWait, waitList, op.NewEvent() );
+    }
+
+    if( filled )
+        pool.ReleaseTile( filled );
+
+    return  op.Finish( iEvent );
+}
+
+ulError
+FContext::Prefetch(
+      const FTiledBlock& iBlock
+    , const FRectI& iRect
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    // Sanitize geometry
+    const FRectI roi = SourceRoi( iBlock, iRect );
+
+    // Check no-op
+    if( IsEmptyRect( roi ) )
+        return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
+
+    FTiledOperation op( *this, iPolicy, iNumWait, iWaitList );
+    std::vector< FSourcePart > parts;
+    std::vector< FEvent > extra;
+    GatherSource( iBlock, roi, &parts );
+    for( auto& part : parts )
+        op.Fetch( part, iBlock, &extra );
+
+    const FEvent* waitList = nullptr;
+    const uint32 numWait = op.WaitFor( extra, &waitList );
+    Dummy_OP( numWait, waitList, op.NewEvent() );
+    return  op.Finish( iEvent );
+}
+
+ulError
+FContext::Resize(
+      const FTiledBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FRectF& iDestinationRect
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ResizeSparse( *this, iSource, iDestination, iSourceRect, iDestinationRect, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Resize(
+      const FBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FRectF& iDestinationRect
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ResizeSparse( *this, iSource, iDestination, iSourceRect, iDestinationRect, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::Resize(
+      const FTiledBlock& iSource
+    , FBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FRectF& iDestinationRect
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  ResizeSparse( *this, iSource, iDestination, iSourceRect, iDestinationRect, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::TransformAffine(
+      const FTiledBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FMat3F& iTransformMatrix
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  TransformAffineSparse( *this, iSource, iDestination, iSourceRect, iTransformMatrix, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::TransformAffine(
+      const FBlock& iSource
+    , FTiledBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FMat3F& iTransformMatrix
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  TransformAffineSparse( *this, iSource, iDestination, iSourceRect, iTransformMatrix, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::TransformAffine(
+      const FTiledBlock& iSource
+    , FBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FMat3F& iTransformMatrix
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    return  TransformAffineSparse( *this, iSource, iDestination, iSourceRect, iTransformMatrix, iResamplingMethod, iBorderMode, iBorderValue, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ULIS_NAMESPACE_END
+
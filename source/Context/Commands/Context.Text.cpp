@@ -59,7 +59,7 @@ FContext::RasterText(
     int dy = static_cast< int >( iTransform[2].y );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleRasterText
             , new FTextCommandArgs(
@@ -80,6 +80,7 @@ FContext::RasterText(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -117,7 +118,7 @@ FContext::RasterTextAA(
     int dy = static_cast< int >( iTransform[2].y );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleRasterTextAA
             , new FTextCommandArgs(
@@ -138,6 +139,7 @@ FContext::RasterTextAA(
             , iEvent
             , roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -56,7 +56,7 @@ FContext::TransformAffine(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleTransformAffine( iResamplingMethod )
             , new FTransformCommandArgs(
@@ -77,6 +77,7 @@ FContext::TransformAffine(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -115,7 +116,7 @@ FContext::TransformAffineTiled(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleTransformAffineTiled( iResamplingMethod )
             , new FTransformCommandArgs(
@@ -137,6 +138,7 @@ FContext::TransformAffineTiled(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -175,7 +177,7 @@ FContext::TransformPerspective(
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
     // Bake and push command
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->QueryScheduleTransformPerspective( iResamplingMethod )
             , new FTransformCommandArgs(
@@ -196,6 +198,7 @@ FContext::TransformPerspective(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -272,7 +275,7 @@ FContext::TransformBezier(
             }
         )
     );
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
                 mContextualDispatchTable->QueryScheduleTransformBezier( iResamplingMethod )
             , new FTransformBezierCommandArgs(
@@ -294,6 +297,7 @@ FContext::TransformBezier(
             , &event
             , dst_roi
         )
+        , __func__
     );
     Dummy_OP( 1, &event, iEvent );
 
@@ -332,8 +336,33 @@ FContext::Resize(
     if( dst_roi.Area() <= 0.f )
         return  FinishEventNo_OP( iEvent, ULIS_WARNING_NO_OP_GEOMETRY );
 
+    return  ResizePart( iSource, iDestination, src_roi, dst_roi, dst_roi, iResamplingMethod, iBorderMode, iBorderValue, iOptionalSummedAreaTable, iPolicy, iNumWait, iWaitList, iEvent );
+}
+
+ulError
+FContext::ResizePart(
+      const FBlock& iSource
+    , FBlock& iDestination
+    , const FRectI& iSourceRect
+    , const FRectF& iDestinationRect
+    , const FRectI& iDestinationRoi
+    , eResamplingMethod iResamplingMethod
+    , eBorderMode iBorderMode
+    , const ISample& iBorderValue
+    , const FBlock* iOptionalSummedAreaTable
+    , const FSchedulePolicy& iPolicy
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    // The parts of a resize are reported as a resize.
+    const char* name = "Resize";
+    const FRectF src_roi = iSourceRect;
+    const FRectI dst_roi = iDestinationRoi;
+
     // Forward Arguments Baking
-    FVec2F inverseScale = src_roi.Size() / dst_roi.Size();
+    FVec2F inverseScale = src_roi.Size() / iDestinationRect.Size();
 
     // If AREA and SAT is not provided, build it.
     if( iResamplingMethod == Resampling_Area && iOptionalSummedAreaTable == nullptr ) {
@@ -351,7 +380,7 @@ FContext::Resize(
             )
         );
         // Bake and push command
-        mCommandQueue.d->Push(
+        Push(
             new FCommand(
                   mContextualDispatchTable->mScheduleResizeArea
                 , new FResizeCommandArgs(
@@ -363,7 +392,7 @@ FContext::Resize(
                     , iBorderMode
                     , iBorderValue.ToFormat( iDestination.Format() )
                     , inverseScale
-                    , dst_roi.Position()
+                    , iDestinationRect.Position()
                     , sat
                 )
                 , iPolicy
@@ -374,11 +403,12 @@ FContext::Resize(
                 , &resize_event
                 , dst_roi
             )
+            , name
         );
         Dummy_OP( 1, &resize_event, iEvent );
     } else {
         // Bake and push command
-        mCommandQueue.d->Push(
+        Push(
             new FCommand(
                   mContextualDispatchTable->QueryScheduleResize( iResamplingMethod )
                 , new FResizeCommandArgs(
@@ -390,7 +420,7 @@ FContext::Resize(
                     , iBorderMode
                     , iBorderValue.ToFormat( iDestination.Format() )
                     , inverseScale
-                    , dst_roi.Position()
+                    , iDestinationRect.Position()
                     , iOptionalSummedAreaTable // SAT
                 )
                 , iPolicy
@@ -401,6 +431,7 @@ FContext::Resize(
                 , iEvent
                 , dst_roi
             )
+            , name
         );
     }
 
@@ -525,7 +556,7 @@ FContext::XProcessBezierDisplacementField(
     for( int i = 0; i < 4; ++i )
         cargs->points.PushBack( FCubicBezierControlPoint{ iControlPoints[i].point - shift, iControlPoints[i].ctrlCW - shift, iControlPoints[i].ctrlCCW - shift } );
 
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               mContextualDispatchTable->mScheduleProcessBezierDeformField
             , cargs
@@ -537,6 +568,7 @@ FContext::XProcessBezierDisplacementField(
             , iEvent
             , dst_roi
         )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
@@ -16,6 +16,8 @@
 #include "Scheduling/Event.h"
 #include "Scheduling/Event_Private.h"
 #include "Scheduling/InternalEvent.h"
+#include "Scheduling/MetricsTable.h"
+#include "Process/Custom/Generic_OP.h"
 #include "Process/Custom/No_OP.h"
 
 ULIS_NAMESPACE_BEGIN
@@ -33,6 +35,8 @@ FContext::FContext(
 )
     : mCommandQueue( iQueue )
     , mContextualDispatchTable( new  FContextualDispatchTable( iFormat, iPerfIntent ) )
+    , bMetrics( false )
+    , mMetrics( std::make_shared< FMetricsTable >() )
 {
 }
 
@@ -68,6 +72,38 @@ FContext::Format() const
     return  mContextualDispatchTable->mFormat;
 }
 
+void
+FContext::SetMetricsEnabled( bool iEnable )
+{
+    bMetrics = iEnable;
+}
+
+bool
+FContext::MetricsEnabled() const
+{
+    return  bMetrics;
+}
+
+void
+FContext::OperationMetrics( TArray< FOperationMetrics >* oMetrics ) const
+{
+    mMetrics->Get( oMetrics );
+}
+
+void
+FContext::ResetMetrics()
+{
+    mMetrics->Reset();
+}
+
+void
+FContext::Push( FCommand* iCommand, const char* iName )
+{
+    if( bMetrics )
+        iCommand->Event()->CollectMetrics( mMetrics, mContextualDispatchTable->mDispatchPath );
+    mCommandQueue.d->Push( iCommand, iName );
+}
+
 ulError
 FContext::FinishEventNo_OP( FEvent* iEvent, ulError iError )
 {
@@ -84,7 +120,7 @@ FContext::Dummy_OP(
     , FEvent* iEvent
 )
 {
-    mCommandQueue.d->Push(
+    Push(
         new FCommand(
               &ScheduleNo_OP
             , new FNo_OPCommandArgs()
@@ -96,6 +132,33 @@ FContext::Dummy_OP(
             , iEvent
             , FRectI()
         )
+        , __func__
+    );
+
+    return  ULIS_NO_ERROR;
+}
+
+ulError
+FContext::Generic_OP(
+      const std::function< void() >& iInvocation
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    Push(
+        new FCommand(
+              &ScheduleGeneric_OP
+            , new FGeneric_OPCommandArgs( iInvocation )
+            , FSchedulePolicy()
+            , true
+            , true
+            , iNumWait
+            , iWaitList
+            , iEvent
+            , FRectI()
+        )
+        , __func__
     );
 
     return  ULIS_NO_ERROR;
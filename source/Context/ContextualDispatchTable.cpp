@@ -10,6 +10,7 @@
 * @license      Please refer to LICENSE.md
 */
 #include "Context/ContextualDispatchTable.h"
+#include "Scheduling/Dispatcher.h"
 #include "Process/Blend/Blend.h"
 #include "Process/Clear/Clear.h"
 #include "Process/Copy/Copy.h"
@@ -37,6 +38,7 @@ ULIS_NAMESPACE_BEGIN
 FContext::FContextualDispatchTable::FContextualDispatchTable( eFormat iFormat, ePerformanceIntent iPerfIntent )
         : mFormat( iFormat )
         , mPerfIntent( iPerfIntent )
+        , mDispatchPath( QueryDispatchPath( iPerfIntent ) )
 #ifdef ULIS_FEATURE_BLEND_ENABLED
         , mScheduleBlendSeparable(                  TDispatcher< FDispatchedBlendSeparableInvocationSchedulerSelector                   >::Query( iFormat, iPerfIntent ) )
         , mScheduleBlendNonSeparable(               TDispatcher< FDispatchedBlendNonSeparableInvocationSchedulerSelector                >::Query( iFormat, iPerfIntent ) )
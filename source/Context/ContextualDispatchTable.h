@@ -133,6 +133,7 @@ public:
 private:
     const eFormat mFormat;
     const ePerformanceIntent mPerfIntent;
+    const eDispatchPath mDispatchPath;
 
 
 #ifdef ULIS_FEATURE_BLEND_ENABLED
@@ -10,6 +10,7 @@
 * @license      Please refer to LICENSE.md
 */
 #include "Core/Callback.h"
+#include <new>
 
 ULIS_NAMESPACE_BEGIN
 void OnCleanup_FreeMemory( uint8* iData, void* iInfo )
@@ -17,5 +18,10 @@ void OnCleanup_FreeMemory( uint8* iData, void* iInfo )
     delete [] iData;
 }
 
+void OnCleanup_FreeAlignedMemory( uint8* iData, void* iInfo )
+{
+    ::operator delete[]( iData, std::align_val_t( ULIS_SCANLINE_ALIGNMENT ) );
+}
+
 ULIS_NAMESPACE_END
 
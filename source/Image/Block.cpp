@@ -48,6 +48,43 @@ FBlock::FBlock(
     ULIS_ASSERT( mBitmap, "Allocation failed with requested size: " << mBytesTotal << " bytes" );
 }
 
+FBlock::FBlock(
+      uint16 iWidth
+    , uint16 iHeight
+    , eFormat iFormat
+    , eScanlineLayout iLayout
+    , const FColorSpace* iColorSpace
+    , const FOnInvalidBlock& iOnInvalid
+    )
+    : IHasFormat( iFormat )
+    , IHasColorSpace( iColorSpace )
+    , IHasSize2D( FVec2UI16( iWidth, iHeight ) )
+    , mBitmap( nullptr )
+    , mBytesPerScanline( 0 )
+    , mBytesPerPlane( 0 )
+    , mBytesTotal( 0 )
+    , mOnInvalid( iOnInvalid )
+    , mOnCleanup( FOnCleanupData( &OnCleanup_FreeMemory ) )
+{
+    ULIS_ASSERT( iWidth  > 0, "Width must be greater than zero" );
+    ULIS_ASSERT( iHeight > 0, "Height must be greater than zero" );
+    mBytesPerScanline = Width() * FormatMetrics().BPP;
+    if( iLayout == ScanlineLayout_Aligned && !Planar() )
+        mBytesPerScanline = ( ( mBytesPerScanline + ULIS_SCANLINE_ALIGNMENT - 1 ) / ULIS_SCANLINE_ALIGNMENT ) * ULIS_SCANLINE_ALIGNMENT;
+    mBytesPerPlane = Planar() ? Area() * BytesPerSample() : BytesPerSample();
+    mBytesTotal = Height() * mBytesPerScanline;
+
+    ULIS_ASSERT( mBytesTotal != 0, "Cannot allocate a buffer of size 0" );
+
+    if( iLayout == ScanlineLayout_Aligned ) {
+        mBitmap = static_cast< uint8* >( ::operator new[]( mBytesTotal, std::align_val_t( ULIS_SCANLINE_ALIGNMENT ), std::nothrow ) );
+        mOnCleanup = FOnCleanupData( &OnCleanup_FreeAlignedMemory );
+    } else {
+        mBitmap = new  ( std::nothrow )  uint8[ mBytesTotal ];
+    }
+    ULIS_ASSERT( mBitmap, "Allocation failed with requested size: " << mBytesTotal << " bytes" );
+}
+
 FBlock::FBlock(
       uint8* iData
     , uint16 iWidth
@@ -148,6 +185,12 @@ FBlock::BytesPerScanLine() const
     return  mBytesPerScanline;
 }
 
+bool
+FBlock::IsContiguous() const
+{
+    return  mBytesPerScanline == Width() * FormatMetrics().BPP;
+}
+
 uint32
 FBlock::BytesPerPlane() const
 {
@@ -350,14 +393,14 @@ FBlock::ReallocInternalData(
     AssignColorSpace( iColorSpace );
     ReinterpretSize( FVec2UI16( iWidth, iHeight ) );
 
+    mBytesPerScanline = Width() * FormatMetrics().BPP;
+    mBytesPerPlane = Planar() ? Area() * BytesPerSample() : BytesPerSample();
+    mBytesTotal = Height() * mBytesPerScanline;
+
     mBitmap = new  ( std::nothrow )  uint8[ mBytesTotal ];
     ULIS_ASSERT( mBitmap, "Allocation failed with requested size: " << mBytesTotal << " bytes" );
     mOnInvalid = iOnInvalid;
     mOnCleanup = iOnCleanup;
-
-    mBytesPerScanline = Width() * FormatMetrics().BPP;
-    mBytesPerPlane = Planar() ? Area() * BytesPerSample() : BytesPerSample();
-    mBytesTotal = Height() * mBytesPerScanline;
 }
 
 ULIS_NAMESPACE_END
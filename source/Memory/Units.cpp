@@ -76,62 +76,62 @@ Yio_t operator "" _Yio( long double i ) { return  Yio_t( i ); }
 
 // uint64
 // User defined literals - SI - bit - uint64
-bit_t operator "" _bit( uint64 i ) { return  bit_t( ( i ) ); }
-kbit_t operator "" _kbit( uint64 i ) { return  kbit_t( ( i ) ); }
-Mbit_t operator "" _Mbit( uint64 i ) { return  Mbit_t( ( i ) ); }
-Gbit_t operator "" _Gbit( uint64 i ) { return  Gbit_t( ( i ) ); }
-Tbit_t operator "" _Tbit( uint64 i ) { return  Tbit_t( ( i ) ); }
-Pbit_t operator "" _Pbit( uint64 i ) { return  Pbit_t( ( i ) ); }
-Ebit_t operator "" _Ebit( uint64 i ) { return  Ebit_t( ( i ) ); }
-Zbit_t operator "" _Zbit( uint64 i ) { return  Zbit_t( ( i ) ); }
-Ybit_t operator "" _Ybit( uint64 i ) { return  Ybit_t( ( i ) ); }
+bit_t operator "" _bit( unsigned long long i ) { return  bit_t( ( i ) ); }
+kbit_t operator "" _kbit( unsigned long long i ) { return  kbit_t( ( i ) ); }
+Mbit_t operator "" _Mbit( unsigned long long i ) { return  Mbit_t( ( i ) ); }
+Gbit_t operator "" _Gbit( unsigned long long i ) { return  Gbit_t( ( i ) ); }
+Tbit_t operator "" _Tbit( unsigned long long i ) { return  Tbit_t( ( i ) ); }
+Pbit_t operator "" _Pbit( unsigned long long i ) { return  Pbit_t( ( i ) ); }
+Ebit_t operator "" _Ebit( unsigned long long i ) { return  Ebit_t( ( i ) ); }
+Zbit_t operator "" _Zbit( unsigned long long i ) { return  Zbit_t( ( i ) ); }
+Ybit_t operator "" _Ybit( unsigned long long i ) { return  Ybit_t( ( i ) ); }
 // User defined literals - SI - byte - uint64
-B_t operator "" _B( uint64 i ) { return  B_t( ( i ) ); }
-kB_t operator "" _kB( uint64 i ) { return  kB_t( ( i ) ); }
-MB_t operator "" _MB( uint64 i ) { return  MB_t( ( i ) ); }
-GB_t operator "" _GB( uint64 i ) { return  GB_t( ( i ) ); }
-TB_t operator "" _TB( uint64 i ) { return  TB_t( ( i ) ); }
-PB_t operator "" _PB( uint64 i ) { return  PB_t( ( i ) ); }
-EB_t operator "" _EB( uint64 i ) { return  EB_t( ( i ) ); }
-ZB_t operator "" _ZB( uint64 i ) { return  ZB_t( ( i ) ); }
-YB_t operator "" _YB( uint64 i ) { return  YB_t( ( i ) ); }
+B_t operator "" _B( unsigned long long i ) { return  B_t( ( i ) ); }
+kB_t operator "" _kB( unsigned long long i ) { return  kB_t( ( i ) ); }
+MB_t operator "" _MB( unsigned long long i ) { return  MB_t( ( i ) ); }
+GB_t operator "" _GB( unsigned long long i ) { return  GB_t( ( i ) ); }
+TB_t operator "" _TB( unsigned long long i ) { return  TB_t( ( i ) ); }
+PB_t operator "" _PB( unsigned long long i ) { return  PB_t( ( i ) ); }
+EB_t operator "" _EB( unsigned long long i ) { return  EB_t( ( i ) ); }
+ZB_t operator "" _ZB( unsigned long long i ) { return  ZB_t( ( i ) ); }
+YB_t operator "" _YB( unsigned long long i ) { return  YB_t( ( i ) ); }
 // User defined literals - SI - octet - uint64
-o_t operator "" _o( uint64 i ) { return  o_t( ( i ) ); }
-ko_t operator "" _ko( uint64 i ) { return  ko_t( ( i ) ); }
-Mo_t operator "" _Mo( uint64 i ) { return  Mo_t( ( i ) ); }
-Go_t operator "" _Go( uint64 i ) { return  Go_t( ( i ) ); }
-To_t operator "" _To( uint64 i ) { return  To_t( ( i ) ); }
-Po_t operator "" _Po( uint64 i ) { return  Po_t( ( i ) ); }
-Eo_t operator "" _Eo( uint64 i ) { return  Eo_t( ( i ) ); }
-Zo_t operator "" _Zo( uint64 i ) { return  Zo_t( ( i ) ); }
-Yo_t operator "" _Yo( uint64 i ) { return  Yo_t( ( i ) ); }
+o_t operator "" _o( unsigned long long i ) { return  o_t( ( i ) ); }
+ko_t operator "" _ko( unsigned long long i ) { return  ko_t( ( i ) ); }
+Mo_t operator "" _Mo( unsigned long long i ) { return  Mo_t( ( i ) ); }
+Go_t operator "" _Go( unsigned long long i ) { return  Go_t( ( i ) ); }
+To_t operator "" _To( unsigned long long i ) { return  To_t( ( i ) ); }
+Po_t operator "" _Po( unsigned long long i ) { return  Po_t( ( i ) ); }
+Eo_t operator "" _Eo( unsigned long long i ) { return  Eo_t( ( i ) ); }
+Zo_t operator "" _Zo( unsigned long long i ) { return  Zo_t( ( i ) ); }
+Yo_t operator "" _Yo( unsigned long long i ) { return  Yo_t( ( i ) ); }
 // User defined literals - IEC - bit - uint64
-Kibit_t operator "" _Kibit( uint64 i ) { return  Kibit_t( ( i ) ); }
-Mibit_t operator "" _Mibit( uint64 i ) { return  Mibit_t( ( i ) ); }
-Gibit_t operator "" _Gibit( uint64 i ) { return  Gibit_t( ( i ) ); }
-Tibit_t operator "" _Tibit( uint64 i ) { return  Tibit_t( ( i ) ); }
-Pibit_t operator "" _Pibit( uint64 i ) { return  Pibit_t( ( i ) ); }
-Eibit_t operator "" _Eibit( uint64 i ) { return  Eibit_t( ( i ) ); }
-Zibit_t operator "" _Zibit( uint64 i ) { return  Zibit_t( ( i ) ); }
-Yibit_t operator "" _Yibit( uint64 i ) { return  Yibit_t( ( i ) ); }
+Kibit_t operator "" _Kibit( unsigned long long i ) { return  Kibit_t( ( i ) ); }
+Mibit_t operator "" _Mibit( unsigned long long i ) { return  Mibit_t( ( i ) ); }
+Gibit_t operator "" _Gibit( unsigned long long i ) { return  Gibit_t( ( i ) ); }
+Tibit_t operator "" _Tibit( unsigned long long i ) { return  Tibit_t( ( i ) ); }
+Pibit_t operator "" _Pibit( unsigned long long i ) { return  Pibit_t( ( i ) ); }
+Eibit_t operator "" _Eibit( unsigned long long i ) { return  Eibit_t( ( i ) ); }
+Zibit_t operator "" _Zibit( unsigned long long i ) { return  Zibit_t( ( i ) ); }
+Yibit_t operator "" _Yibit( unsigned long long i ) { return  Yibit_t( ( i ) ); }
 // User defined literals - IEC - byte - uint64
-KiB_t operator "" _KiB( uint64 i ) { return  KiB_t( ( i ) ); }
-MiB_t operator "" _MiB( uint64 i ) { return  MiB_t( ( i ) ); }
-GiB_t operator "" _GiB( uint64 i ) { return  GiB_t( ( i ) ); }
-TiB_t operator "" _TiB( uint64 i ) { return  TiB_t( ( i ) ); }
-PiB_t operator "" _PiB( uint64 i ) { return  PiB_t( ( i ) ); }
-EiB_t operator "" _EiB( uint64 i ) { return  EiB_t( ( i ) ); }
-ZiB_t operator "" _ZiB( uint64 i ) { return  ZiB_t( ( i ) ); }
-YiB_t operator "" _YiB( uint64 i ) { return  YiB_t( ( i ) ); }
+KiB_t operator "" _KiB( unsigned long long i ) { return  KiB_t( ( i ) ); }
+MiB_t operator "" _MiB( unsigned long long i ) { return  MiB_t( ( i ) ); }
+GiB_t operator "" _GiB( unsigned long long i ) { return  GiB_t( ( i ) ); }
+TiB_t operator "" _TiB( unsigned long long i ) { return  TiB_t( ( i ) ); }
+PiB_t operator "" _PiB( unsigned long long i ) { return  PiB_t( ( i ) ); }
+EiB_t operator "" _EiB( unsigned long long i ) { return  EiB_t( ( i ) ); }
+ZiB_t operator "" _ZiB( unsigned long long i ) { return  ZiB_t( ( i ) ); }
+YiB_t operator "" _YiB( unsigned long long i ) { return  YiB_t( ( i ) ); }
 // User defined literals - IEC - octet - uint64
-Kio_t operator "" _Kio( uint64 i ) { return  Kio_t( ( i ) ); }
-Mio_t operator "" _Mio( uint64 i ) { return  Mio_t( ( i ) ); }
-Gio_t operator "" _Gio( uint64 i ) { return  Gio_t( ( i ) ); }
-Tio_t operator "" _Tio( uint64 i ) { return  Tio_t( ( i ) ); }
-Pio_t operator "" _Pio( uint64 i ) { return  Pio_t( ( i ) ); }
-Eio_t operator "" _Eio( uint64 i ) { return  Eio_t( ( i ) ); }
-Zio_t operator "" _Zio( uint64 i ) { return  Zio_t( ( i ) ); }
-Yio_t operator "" _Yio( uint64 i ) { return  Yio_t( ( i ) ); }
+Kio_t operator "" _Kio( unsigned long long i ) { return  Kio_t( ( i ) ); }
+Mio_t operator "" _Mio( unsigned long long i ) { return  Mio_t( ( i ) ); }
+Gio_t operator "" _Gio( unsigned long long i ) { return  Gio_t( ( i ) ); }
+Tio_t operator "" _Tio( unsigned long long i ) { return  Tio_t( ( i ) ); }
+Pio_t operator "" _Pio( unsigned long long i ) { return  Pio_t( ( i ) ); }
+Eio_t operator "" _Eio( unsigned long long i ) { return  Eio_t( ( i ) ); }
+Zio_t operator "" _Zio( unsigned long long i ) { return  Zio_t( ( i ) ); }
+Yio_t operator "" _Yio( unsigned long long i ) { return  Yio_t( ( i ) ); }
 
 } // namespace units_literals
 
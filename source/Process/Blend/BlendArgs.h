@@ -69,6 +69,21 @@ public:
         , color( iColor )
         {}
 
+    // Subpixel and tiled blends read around the source rect.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        if( !color )
+            return  2;
+        oAccesses[2] = { color, color->Rect(), false };
+        return  3;
+    }
+
+    // Non separable modes go through a conversion to HSL.
+    ufloat CostPerPixel() const override {
+        return  BlendingModeQualifier( blendingMode ) == BlendQualifier_Separable ? 6.f : 16.f;
+    }
+
     const FVec2F subpixelComponent;
     const FVec2F buspixelComponent;
     const eBlendMode blendingMode;
@@ -39,6 +39,17 @@ public:
         , kernel( iKernel )
         {}
 
+    // Samples around the source rect.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        return  2;
+    }
+
+    ufloat CostPerPixel() const override {
+        return  2.f * static_cast< ufloat >( kernel.Size().x * kernel.Size().y );
+    }
+
     const FKernel& kernel;
 };
 
@@ -63,8 +74,8 @@ InvokeConvolutionMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         memset( sum, 0, fmt.SPP * sizeof( float ) );
         for( int i = 0; i < maxx; ++i ) {
@@ -110,8 +121,8 @@ InvokeConvolutionMaxMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         memset( sum, 0, fmt.SPP * sizeof( float ) );
         for( int i = 0; i < maxx; ++i ) {
@@ -157,8 +168,8 @@ InvokeConvolutionMinMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         for( int i = 0; i < fmt.SPP; ++i )
             sum[i] = ULIS_FLOAT_MAX;
@@ -209,8 +220,8 @@ InvokeConvolutionPremultMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         memset( sum, 0, fmt.SPP * sizeof( float ) );
         for( int i = 0; i < maxx; ++i ) {
@@ -263,8 +274,8 @@ InvokeConvolutionPremultMaxMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         memset( sum, 0, fmt.SPP * sizeof( float ) );
         for( int i = 0; i < maxx; ++i ) {
@@ -317,8 +328,8 @@ InvokeConvolutionPremultMinMT_MEM_Generic(
 
     // Gather x y
     const int y = jargs->line + cargs->srcRect.y;
-    const int x1 = cargs->srcRect.x;
-    const int x2 = cargs->dstRect.w + x1;
+    const int x1 = cargs->srcRect.x + jargs->x;
+    const int x2 = static_cast< int >( jargs->size / fmt.BPP ) + x1;
     for( int x = x1; x < x2; ++x ) {
         for( int i = 0; i < fmt.SPP; ++i )
             sum[i] = ULIS_FLOAT_MAX;
@@ -353,12 +364,12 @@ InvokeConvolutionPremultMinMT_MEM_Generic(
 
 /////////////////////////////////////////////////////
 // Dispatch / Schedule
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMT_MEM_Generic< T > )
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionMaxMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMaxMT_MEM_Generic< T > )
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionMinMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMinMT_MEM_Generic< T > )
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionPremultMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMT_MEM_Generic< T > )
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionPremultMaxMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMaxMT_MEM_Generic< T > )
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL( ScheduleConvolutionPremultMinMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMinMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionMaxMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMaxMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionMinMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionMinMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionPremultMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionPremultMaxMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMaxMT_MEM_Generic< T > )
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( ScheduleConvolutionPremultMinMT_MEM_Generic, FDualBufferJobArgs, FConvolutionCommandArgs, &InvokeConvolutionPremultMinMT_MEM_Generic< T > )
 ULIS_DECLARE_DISPATCHER( FDispatchedConvolutionInvocationSchedulerSelector )
 ULIS_DECLARE_DISPATCHER( FDispatchedConvolutionMaxInvocationSchedulerSelector )
 ULIS_DECLARE_DISPATCHER( FDispatchedConvolutionMinInvocationSchedulerSelector )
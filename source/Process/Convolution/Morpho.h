@@ -39,6 +39,17 @@ public:
         , kernel( iKernel )
         {}
 
+    // Samples around the source rect.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        return  2;
+    }
+
+    ufloat CostPerPixel() const override {
+        return  static_cast< ufloat >( kernel.Size().x * kernel.Size().y );
+    }
+
     const FStructuringElement& kernel;
 };
 
@@ -12,6 +12,7 @@
 #include "Process/Copy/Copy.h"
 #include "Image/Block.h"
 #include "Scheduling/DualBufferArgs.h"
+#include "Scheduling/SimpleBufferArgs.h"
 #include "Scheduling/RangeBasedPolicyScheduler.h"
 #if defined( ULIS_COMPILETIME_SSE_SUPPORT ) || defined( ULIS_COMPILETIME_AVX_SUPPORT )
 #include <immintrin.h>
@@ -30,6 +31,20 @@ void InvokeCopyMT_AVX(
 {
     const __m256i* ULIS_RESTRICT src    = reinterpret_cast< const __m256i* >( jargs->src );
     __m256i* ULIS_RESTRICT dst          = reinterpret_cast< __m256i* >( jargs->dst );
+
+    // Aligned scanlines: whole aligned vectors, the end of the span spills in
+    // the padding of the destination and the source is read within its data.
+    const int64 padded = SpanInPadding( cargs->dst, jargs->dst, jargs->size, 32 );
+    if( padded % 32 == 0
+        && reinterpret_cast< uintptr_t >( jargs->dst ) % 32 == 0
+        && reinterpret_cast< uintptr_t >( jargs->src ) % 32 == 0
+        && jargs->src + padded <= cargs->src.Bits() + cargs->src.BytesTotal() )
+    {
+        for( int64 index = 0; index < padded; index += 32 )
+            _mm256_store_si256( dst++, _mm256_load_si256( src++ ) );
+        return;
+    }
+
     int64 index = 0;
     for( index = 0; index < jargs->size - 32; index += 32 )
     {
@@ -53,6 +68,20 @@ void InvokeCopyMT_SSE(
 {
     const __m128i* ULIS_RESTRICT src    = reinterpret_cast< const __m128i* >( jargs->src );
     __m128i* ULIS_RESTRICT dst          = reinterpret_cast< __m128i* >( jargs->dst );
+
+    // Aligned scanlines: whole aligned vectors, the end of the span spills in
+    // the padding of the destination and the source is read within its data.
+    const int64 padded = SpanInPadding( cargs->dst, jargs->dst, jargs->size, 16 );
+    if( padded % 16 == 0
+        && reinterpret_cast< uintptr_t >( jargs->dst ) % 16 == 0
+        && reinterpret_cast< uintptr_t >( jargs->src ) % 16 == 0
+        && jargs->src + padded <= cargs->src.Bits() + cargs->src.BytesTotal() )
+    {
+        for( int64 index = 0; index < padded; index += 16 )
+            _mm_store_si128( dst++, _mm_load_si128( src++ ) );
+        return;
+    }
+
     int64 index = 0;
     for( index = 0; index < jargs->size - 16; index += 16 )
     {
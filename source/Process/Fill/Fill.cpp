@@ -28,6 +28,16 @@ InvokeFillMT_AVX(
 {
     __m256i src = _mm256_lddqu_si256( reinterpret_cast< const __m256i* >( cargs->buffer ) );
     __m256i* ULIS_RESTRICT dst = reinterpret_cast< __m256i* >( jargs->dst );
+
+    // Aligned scanlines: whole aligned vectors, the end of the span spills in
+    // the padding.
+    const int64 padded = SpanInPadding( cargs->dst, jargs->dst, jargs->size, 32 );
+    if( padded % 32 == 0 && reinterpret_cast< uintptr_t >( jargs->dst ) % 32 == 0 ) {
+        for( int64 index = 0; index < padded; index += 32 )
+            _mm256_store_si256( dst++, src );
+        return;
+    }
+
     int64 index = 0;
     for( index = 0; index < jargs->size - 32; index += 32 ) {
         _mm256_storeu_si256( dst, src );
@@ -49,6 +59,16 @@ InvokeFillMT_SSE(
 {
     __m128i src = _mm_lddqu_si128( reinterpret_cast< const __m128i* >( cargs->buffer ) );
     __m128i* ULIS_RESTRICT dst = reinterpret_cast< __m128i* >( jargs->dst );
+
+    // Aligned scanlines: whole aligned vectors, the end of the span spills in
+    // the padding.
+    const int64 padded = SpanInPadding( cargs->dst, jargs->dst, jargs->size, 16 );
+    if( padded % 16 == 0 && reinterpret_cast< uintptr_t >( jargs->dst ) % 16 == 0 ) {
+        for( int64 index = 0; index < padded; index += 16 )
+            _mm_store_si128( dst++, src );
+        return;
+    }
+
     int64 index = 0;
     for( index = 0; index < jargs->size - 16; index += 16 ) {
         _mm_storeu_si128( dst, src );
@@ -87,13 +107,14 @@ ScheduleFillMT_AVX(
     , bool iForceMonoChunk
 )
 {
-    const FFillCommandArgs* cargs = dynamic_cast< const FFillCommandArgs* >( iCommand->Args() );
+    const FFillCommandArgs* cargs = static_cast< const FFillCommandArgs* >( iCommand->Args() );
     const uint8 bpp = cargs->dst.BytesPerPixel();
     const uint32 bps = cargs->dst.BytesPerScanLine();
 
-    if( bpp <= 32 && bps >= 32 ) {
+    // The pattern is only repeated seamlessly if it holds whole pixels.
+    if( 32 % bpp == 0 && bps >= 32 ) {
         ScheduleSimpleBufferJobs< FSimpleBufferJobArgs, FFillCommandArgs, &InvokeFillMT_AVX >( iCommand, iPolicy, iContiguous, iForceMonoChunk, BuildSimpleBufferJob_Scanlines, BuildSimpleBufferJob_Chunks );
-    } else if( bpp <= 16 && bps >= 16 ) {
+    } else if( 16 % bpp == 0 && bps >= 16 ) {
         ScheduleSimpleBufferJobs< FSimpleBufferJobArgs, FFillCommandArgs, &InvokeFillMT_SSE >( iCommand, iPolicy, iContiguous, iForceMonoChunk, BuildSimpleBufferJob_Scanlines, BuildSimpleBufferJob_Chunks );
     } else {
         ScheduleSimpleBufferJobs< FSimpleBufferJobArgs, FFillCommandArgs, &InvokeFillMT_MEM >( iCommand, iPolicy, iContiguous, iForceMonoChunk, BuildSimpleBufferJob_Scanlines, BuildSimpleBufferJob_Chunks );
@@ -110,10 +131,10 @@ ScheduleFillMT_SSE(
     , bool iForceMonoChunk
 )
 {
-    const FFillCommandArgs* cargs = dynamic_cast< const FFillCommandArgs* >( iCommand->Args() );
+    const FFillCommandArgs* cargs = static_cast< const FFillCommandArgs* >( iCommand->Args() );
     const uint8 bpp = cargs->dst.BytesPerPixel();
     const uint32 bps = cargs->dst.BytesPerScanLine();
-    if( bpp <= 16 && bps >= 16 ) {
+    if( 16 % bpp == 0 && bps >= 16 ) {
         ScheduleSimpleBufferJobs< FSimpleBufferJobArgs, FFillCommandArgs, &InvokeFillMT_SSE >( iCommand, iPolicy, iContiguous, iForceMonoChunk, BuildSimpleBufferJob_Scanlines, BuildSimpleBufferJob_Chunks );
     } else {
         ScheduleSimpleBufferJobs< FSimpleBufferJobArgs, FFillCommandArgs, &InvokeFillMT_MEM >( iCommand, iPolicy, iContiguous, iForceMonoChunk, BuildSimpleBufferJob_Scanlines, BuildSimpleBufferJob_Chunks );
@@ -75,7 +75,8 @@ InvokeFillPreserveAlphaMT_MEM_Generic(
     const uint8* src = cargs->color.Bits();
     const FFormatMetrics& fmt = cargs->dst.Format();
     T* ULIS_RESTRICT dst = reinterpret_cast< T* >( jargs->dst );
-    for( uint32 i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         const T alpha = dst[ fmt.AID ];
         memcpy( dst, src, fmt.BPP );
         dst[ fmt.AID ] = alpha;
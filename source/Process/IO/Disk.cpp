@@ -13,6 +13,7 @@
 #include "Image/Block.h"
 
 #include <fstream>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -28,6 +29,31 @@ namespace fs = std::filesystem;
 #endif
 
 ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+// FDiskIOCommandArgs
+uint64
+FDiskIOCommandArgs::Footprint() const
+{
+    if( !load )
+        return  FSimpleBufferCommandArgs::Footprint();
+
+    int width, height, channels;
+    FILE* file = fopen( path.c_str(), "rb" );
+    if( !file )
+        return  0;
+
+    uint64 depth = 1;
+    if( stbi_is_16_bit_from_file( file ) )
+        depth = 2;
+    else if( stbi_is_hdr_from_file( file ) )
+        depth = 4;
+    const bool valid = stbi_info_from_file( file, &width, &height, &channels ) != 0;
+    fseek( file, 0, SEEK_END );
+    const uint64 size = static_cast< uint64 >( ftell( file ) );
+    fclose( file );
+    return  valid ? size + static_cast< uint64 >( width ) * height * channels * depth : size;
+}
+
 //--------------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------- MEM
 void
@@ -101,10 +127,22 @@ InvokeSaveToFile_MEM(
     int w = cargs->dst.Width();
     int h = cargs->dst.Height();
     int c = cargs->dst.SamplesPerPixel();
+    int bps = static_cast< int >( cargs->dst.BytesPerScanLine() );
     const uint8* dat = cargs->dst.Bits();
 
+    // Only png takes a stride, the scanlines of padded blocks are packed for
+    // the other formats.
+    std::vector< uint8 > packed;
+    if( !cargs->dst.IsContiguous() && cargs->fileFormat != FileFormat_png ) {
+        const uint64 size = static_cast< uint64 >( w ) * cargs->dst.BytesPerPixel();
+        packed.resize( size * h );
+        for( int y = 0; y < h; ++y )
+            memcpy( packed.data() + y * size, cargs->dst.ScanlineBits( y ), size );
+        dat = packed.data();
+    }
+
     switch( cargs->fileFormat ) {
-        case FileFormat_png: stbi_write_png( cargs->path.c_str(), w, h, c, dat, 0               );  break; // stride: 0
+        case FileFormat_png: stbi_write_png( cargs->path.c_str(), w, h, c, dat, bps             );  break;
         case FileFormat_bmp: stbi_write_bmp( cargs->path.c_str(), w, h, c, dat                  );  break;
         case FileFormat_tga: stbi_write_tga( cargs->path.c_str(), w, h, c, dat                  );  break;
         case FileFormat_jpg: stbi_write_jpg( cargs->path.c_str(), w, h, c, dat, cargs->quality  );  break; // Quality: 0 - 100;
@@ -35,16 +35,22 @@ public:
         , const std::string& iPath
         , const eFileFormat iFileFormat = eFileFormat::FileFormat_png
         , int iQuality = 100
+        , bool iLoad = false
     )
         : FSimpleBufferCommandArgs( iBlock, iRect )
         , path( iPath )
         , fileFormat( iFileFormat )
         , quality( iQuality )
+        , load( iLoad )
     {}
 
+    /*! A load needs the file and the decoded image, read from its header. */
+    uint64 Footprint() const override;
+
     const std::string path;
     const eFileFormat fileFormat;
     const int quality;
+    const bool load;
 };
 
 /////////////////////////////////////////////////////
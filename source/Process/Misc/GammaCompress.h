@@ -31,7 +31,8 @@ InvokeApplysRGB2LinearMT_MEM_Generic(
 {
     T* dst = reinterpret_cast< T* >( jargs->dst );
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
-    for( int i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         for( int j = 0; j < fmt.NCC; ++j ) {
             uint8 r = fmt.IDT[j];
             *( dst + r ) = sel_srgb2linearT< T >( *( dst + r ) );
@@ -49,7 +50,8 @@ InvokeApplyLinear2sRGBMT_MEM_Generic(
 {
     T* dst = reinterpret_cast< T* >( jargs->dst );
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
-    for( int i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         for( int j = 0; j < fmt.NCC; ++j ) {
             uint8 r = fmt.IDT[j];
             *( dst + r ) = sel_linear2srgbT< T >( *( dst + r ) );
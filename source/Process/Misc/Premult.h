@@ -30,7 +30,8 @@ InvokePremultMT_MEM_Generic(
 {
     T* dst = reinterpret_cast< T* >( jargs->dst );
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
-    for( int i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         T alpha = fmt.HEA ? *( dst + fmt.AID ) : MaxType< T >();
         for( int j = 0; j < fmt.NCC; ++j ) {
             uint8 r = fmt.IDT[j];
@@ -49,7 +50,8 @@ InvokeUnpremultMT_MEM_Generic(
 {
     T* dst = reinterpret_cast< T* >( jargs->dst );
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
-    for( int i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         T alpha = fmt.HEA ? *( dst + fmt.AID ) : MaxType< T >();
         for( int j = 0; j < fmt.NCC; ++j ) {
             uint8 r = fmt.IDT[j];
@@ -31,7 +31,8 @@ InvokeSanitizeZeroAlphaMT_MEM_Generic(
     T* dst = reinterpret_cast< T* >( jargs->dst );
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
     const T zero = MinType< T >();
-    for( int i = 0; i < jargs->size; ++i ) {
+    const int64 length = jargs->size / fmt.BPP;
+    for( int64 i = 0; i < length; ++i ) {
         const T alpha = fmt.HEA ? *( dst + fmt.AID ) : MaxType< T >();
         for( int j = 0; j < fmt.NCC; ++j ) {
             uint8 r = fmt.IDT[j];
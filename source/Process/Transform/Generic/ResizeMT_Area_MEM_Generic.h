@@ -27,8 +27,9 @@ InvokeResizeMT_Area_MEM_Generic(
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
     FVec2F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line );
-    FVec2F point_in_src( cargs->inverseScale * ( point_in_dst - cargs->shift ) + FVec2F( cargs->srcRect.x, cargs->srcRect.y ) );
+    const FVec2F origin_in_src( cargs->inverseScale * ( point_in_dst - cargs->shift ) + FVec2F( cargs->srcRect.x, cargs->srcRect.y ) );
     FVec2F src_dx( cargs->inverseScale * FVec2F( 1.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
     FVec2F coverage( FVec2F( 1.f, 1.f ) * cargs->inverseScale );
     float coverage_area = coverage.x * coverage.y;
 
@@ -54,7 +55,7 @@ InvokeResizeMT_Area_MEM_Generic(
     float t[4];
     float u[4];
 
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         // order: left top right bot
         fpos[0] = point_in_src.x - 1.f;
         fpos[1] = point_in_src.y - 1.f;
@@ -90,7 +91,8 @@ InvokeResizeMT_Area_MEM_Generic(
         }
 
         dst += fmt.BPP;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 
     delete [] c00;
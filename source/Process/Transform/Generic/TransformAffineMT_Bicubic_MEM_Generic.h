@@ -26,8 +26,9 @@ InvokeTransformAffineMT_Bicubic_MEM_Generic(
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
     FVec3F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line, 1.f );
-    FVec2F point_in_src( cargs->inverseMatrix * point_in_dst );
+    const FVec2F origin_in_src( cargs->inverseMatrix * point_in_dst );
     FVec2F src_dx( cargs->inverseMatrix * FVec3F( 1.f, 0.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
 
     uint8* p00 = new uint8[ fmt.BPP * 4 ];      uint8* p01 = new uint8[ fmt.BPP * 4 ];
     uint8* p10 = p00 + fmt.BPP;                 uint8* p11 = p01 + fmt.BPP;
@@ -46,7 +47,7 @@ InvokeTransformAffineMT_Bicubic_MEM_Generic(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         const int   src_x   = static_cast< int >( floor( point_in_src.x ) );
         const int   src_y   = static_cast< int >( floor( point_in_src.y ) );
         const float tx      = point_in_src.x - src_x;
@@ -65,7 +66,8 @@ InvokeTransformAffineMT_Bicubic_MEM_Generic(
         SampleBicubicV< T >( dst, hh0, hh1, hh2, hh3, fmt, ty );
 
         dst += fmt.BPP;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 
     delete [] p00;
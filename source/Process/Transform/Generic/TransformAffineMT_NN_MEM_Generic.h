@@ -26,14 +26,15 @@ InvokeTransformAffineMT_NN_MEM_Generic(
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
     FVec3F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line, 1.f );
-    FVec2F point_in_src( cargs->inverseMatrix * point_in_dst );
+    const FVec2F origin_in_src( cargs->inverseMatrix * point_in_dst );
     FVec2F src_dx( cargs->inverseMatrix * FVec3F( 1.f, 0.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
 
     const int minx = cargs->srcRect.x;
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    const int len = cargs->dstRect.w;
+    const int len = jargs->w;
     for( int x = 0; x < len; ++x ) {
         int src_x = static_cast< int >( point_in_src.x );
         int src_y = static_cast< int >( point_in_src.y );
@@ -41,7 +42,8 @@ InvokeTransformAffineMT_NN_MEM_Generic(
             memcpy( dst, cargs->src.PixelBits( src_x, src_y ), bytesPerPixel );
 
         dst += bytesPerPixel;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 }
 
@@ -26,8 +26,9 @@ InvokeTransformAffineTiledMT_Bilinear_MEM_Generic(
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
     FVec3F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line, 1.f );
-    FVec2F point_in_src( cargs->inverseMatrix * point_in_dst );
+    const FVec2F origin_in_src( cargs->inverseMatrix * point_in_dst );
     FVec2F src_dx( cargs->inverseMatrix * FVec3F( 1.f, 0.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
     uint8* c00 = new uint8[ fmt.BPP * 4 ];
     uint8* c10 = c00 + fmt.BPP;
     uint8* c11 = c10 + fmt.BPP;
@@ -39,7 +40,7 @@ InvokeTransformAffineTiledMT_Bilinear_MEM_Generic(
     //const int miny = cargs->srcRect.y;
     //const int maxx = minx + cargs->srcRect.w;
     //const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         const float modx = FMath::PyModulo( point_in_src.x, static_cast< float >( cargs->srcRect.w ) );
         const float mody = FMath::PyModulo( point_in_src.y, static_cast< float >( cargs->srcRect.h ) );
         const int   left    = static_cast< int >( modx );
@@ -62,7 +63,8 @@ InvokeTransformAffineTiledMT_Bilinear_MEM_Generic(
         SampleBilinear< T >( dst, hh0, hh1, fmt, ty, uy );
 
         dst += fmt.BPP;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 
     delete [] c00;
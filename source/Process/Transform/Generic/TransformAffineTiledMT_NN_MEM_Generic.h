@@ -26,20 +26,22 @@ InvokeTransformAffineTiledMT_NN_MEM_Generic(
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
     FVec3F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line, 1.f );
-    FVec2F point_in_src( cargs->inverseMatrix * point_in_dst );
+    const FVec2F origin_in_src( cargs->inverseMatrix * point_in_dst );
     FVec2F src_dx( cargs->inverseMatrix * FVec3F( 1.f, 0.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
 
     //const int minx = cargs->srcRect.x;
     //const int miny = cargs->srcRect.y;
     //const int maxx = minx + cargs->srcRect.w;
     //const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         int src_x = FMath::PyModulo( static_cast< int >( point_in_src.x ), cargs->srcRect.w );
         int src_y = FMath::PyModulo( static_cast< int >( point_in_src.y ), cargs->srcRect.h );
         memcpy( dst, cargs->src.PixelBits( src_x, src_y ), fmt.BPP );
 
         dst += fmt.BPP;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 }
 
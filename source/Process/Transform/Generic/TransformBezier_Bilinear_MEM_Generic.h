@@ -23,8 +23,8 @@ InvokeTransformBezierMT_Bilinear_MEM_Generic(
 {
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
     uint8* ULIS_RESTRICT dst = jargs->dst;
-    const float* field = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) );
-    const uint8* mask  = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) );
+    const float* field = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) ) + jargs->x * 2;
+    const uint8* mask  = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) ) + jargs->x;
     const int rangex = cargs->srcRect.w - 1;
     const int rangey = cargs->srcRect.h - 1;
 
@@ -38,7 +38,7 @@ InvokeTransformBezierMT_Bilinear_MEM_Generic(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         if( *mask & 0xFF ) {
             float srcxf = field[0] * rangex;
             float srcyf = field[1] * rangey;
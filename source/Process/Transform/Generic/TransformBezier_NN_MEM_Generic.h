@@ -24,11 +24,11 @@ InvokeTransformBezierMT_NN_MEM_Generic(
 {
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
     uint8* ULIS_RESTRICT dst = jargs->dst;
-    const float* field = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) );
-    const uint8* mask  = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) );
+    const float* field = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) ) + jargs->x * 2;
+    const uint8* mask  = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) ) + jargs->x;
     const int rangex = cargs->srcRect.w - 1;
     const int rangey = cargs->srcRect.h - 1;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         if( *mask & 0xFF ) {
             int src_x = static_cast< int >( field[0] * rangex );
             int src_y = static_cast< int >( field[1] * rangey );
@@ -25,7 +25,7 @@ InvokeTransformPerspectiveMT_Bilinear_MEM_Generic(
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
-    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
+    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x + jargs->x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
     uint8* c00 = new uint8[ fmt.BPP * 4 ];
     uint8* c10 = c00 + fmt.BPP;
     uint8* c11 = c10 + fmt.BPP;
@@ -37,7 +37,7 @@ InvokeTransformPerspectiveMT_Bilinear_MEM_Generic(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         FVec2F pointInSrc = cargs->inverseMatrix.ApplyHomography( pointInDst );
         const int   left    = static_cast< int >( floor( pointInSrc.x ) );
         const int   top     = static_cast< int >( floor( pointInSrc.y ) );
@@ -25,13 +25,13 @@ InvokeTransformPerspectiveMT_NN_MEM_Generic(
     const FFormatMetrics& fmt = cargs->dst.FormatMetrics();
     uint8* ULIS_RESTRICT dst = jargs->dst;
 
-    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
+    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x + jargs->x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
 
     const int minx = cargs->srcRect.x;
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         FVec2F pointInSrc = cargs->inverseMatrix.ApplyHomography( pointInDst );
         int src_x = static_cast< int >( pointInSrc.x );
         int src_y = static_cast< int >( pointInSrc.y );
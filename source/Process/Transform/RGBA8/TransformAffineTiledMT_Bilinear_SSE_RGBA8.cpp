@@ -30,8 +30,9 @@ InvokeTransformAffineTiledMT_Bilinear_SSE_RGBA8(
     _idt.insert( fmt.AID, 4 );
 
     FVec3F point_in_dst( cargs->dstRect.x, cargs->dstRect.y + jargs->line, 1.f );
-    FVec2F point_in_src( cargs->inverseMatrix * point_in_dst );
+    const FVec2F origin_in_src( cargs->inverseMatrix * point_in_dst );
     FVec2F src_dx( cargs->inverseMatrix * FVec3F( 1.f, 0.f, 0.f ) );
+    FVec2F point_in_src( origin_in_src + static_cast< float >( jargs->x ) * src_dx );
 
     Vec4f c00, c10, c11, c01, hh0, hh1, res, alp;
 
@@ -39,7 +40,7 @@ InvokeTransformAffineTiledMT_Bilinear_SSE_RGBA8(
     //const int miny = cargs->srcRect.y;
     //const int maxx = minx + cargs->srcRect.w;
     //const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         const float modx = FMath::PyModulo( point_in_src.x, static_cast< float >( cargs->srcRect.w ) );
         const float mody = FMath::PyModulo( point_in_src.y, static_cast< float >( cargs->srcRect.h ) );
         const int   left    = static_cast< int >( modx );
@@ -79,7 +80,8 @@ InvokeTransformAffineTiledMT_Bilinear_SSE_RGBA8(
         *( uint32* )dst = static_cast< uint32 >( _mm_cvtsi128_si32( _pack ) );
 
         dst += fmt.BPP;
-        point_in_src += src_dx;
+        // From the row origin, so that spans and tiles sample the exact same points.
+        point_in_src = origin_in_src + static_cast< float >( jargs->x + x + 1 ) * src_dx;
     }
 }
 
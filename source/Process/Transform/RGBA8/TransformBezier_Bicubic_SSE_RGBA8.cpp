@@ -29,8 +29,8 @@ InvokeTransformBezierMT_Bicubic_SSE_RGBA8(
     Vec4i _idt( 0, 1, 2, 3 );
     _idt.insert( fmt.AID, 4 );
 
-    const float*            field   = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) );
-    const uint8*            mask    = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) );
+    const float*            field   = reinterpret_cast< const float* >( cargs->field.ScanlineBits( jargs->line ) ) + jargs->x * 2;
+    const uint8*            mask    = reinterpret_cast< const uint8* >( cargs->mask.ScanlineBits( jargs->line ) ) + jargs->x;
     const int rangex = cargs->srcRect.w - 1;
     const int rangey = cargs->srcRect.h - 1;
 
@@ -45,7 +45,7 @@ InvokeTransformBezierMT_Bicubic_SSE_RGBA8(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         if( *mask & 0xFF ) {
             float srcxf = field[0] * rangex;
             float srcyf = field[1] * rangey;
@@ -29,7 +29,7 @@ InvokeTransformPerspectiveMT_Bicubic_SSE_RGBA8(
     Vec4i _idt( 0, 1, 2, 3 );
     _idt.insert( fmt.AID, 4 );
 
-    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
+    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x + jargs->x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
 
     Vec4f p00, p10, p20, p30;
     Vec4f p01, p11, p21, p31;
@@ -42,7 +42,7 @@ InvokeTransformPerspectiveMT_Bicubic_SSE_RGBA8(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         FVec2F pointInSrc = cargs->inverseMatrix.ApplyHomography( pointInDst );
         const int   src_x   = static_cast< int >( floor( pointInSrc.x ) );
         const int   src_y   = static_cast< int >( floor( pointInSrc.y ) );
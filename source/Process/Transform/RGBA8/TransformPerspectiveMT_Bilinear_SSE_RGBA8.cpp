@@ -29,7 +29,7 @@ InvokeTransformPerspectiveMT_Bilinear_SSE_RGBA8(
     Vec4i _idt( 0, 1, 2, 3 );
     _idt.insert( fmt.AID, 4 );
 
-    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
+    FVec2F pointInDst( static_cast< float >( cargs->dstRect.x + jargs->x ), static_cast< float >( cargs->dstRect.y + jargs->line ) );
 
     Vec4f c00, c10, c11, c01, hh0, hh1, res, alp;
 
@@ -37,7 +37,7 @@ InvokeTransformPerspectiveMT_Bilinear_SSE_RGBA8(
     const int miny = cargs->srcRect.y;
     const int maxx = minx + cargs->srcRect.w;
     const int maxy = miny + cargs->srcRect.h;
-    for( int x = 0; x < cargs->dstRect.w; ++x ) {
+    for( int x = 0; x < jargs->w; ++x ) {
         FVec2F pointInSrc = cargs->inverseMatrix.ApplyHomography( pointInDst );
         const int   left    = static_cast< int >( floor( pointInSrc.x ) );
         const int   top     = static_cast< int >( floor( pointInSrc.y ) );
@@ -22,6 +22,20 @@
 #include "Scheduling/DualBufferArgs.h"
 
 ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+// Resampling cost
+// Rough single core cost of one destination pixel, in nanoseconds, for the
+// ScheduleMode_Auto cost model.
+static inline ufloat ResamplingCostPerPixel( eResamplingMethod iResamplingMethod ) {
+    switch( iResamplingMethod ) {
+        case Resampling_NearestNeighbour:   return  4.f;
+        case Resampling_Bilinear:           return  12.f;
+        case Resampling_Bicubic:            return  40.f;
+        case Resampling_Area:               return  20.f;
+    }
+    return  1.f;
+}
+
 /////////////////////////////////////////////////////
 // FTransformCommandArgs
 class FTransformCommandArgs final
@@ -56,6 +70,17 @@ public:
         , tiled( iTiled )
     {}
 
+    // Samples around the source rect.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        return  2;
+    }
+
+    ufloat CostPerPixel() const override {
+        return  ResamplingCostPerPixel( resamplingMethod );
+    }
+
     eResamplingMethod resamplingMethod;
     eBorderMode borderMode;
     FColor borderValue;
@@ -101,6 +126,20 @@ public:
         , tiled( iTiled )
     {}
 
+    // Samples around the source rect, and reads the whole SAT if any.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        if( !optionalSAT )
+            return  2;
+        oAccesses[2] = { optionalSAT, optionalSAT->Rect(), false };
+        return  3;
+    }
+
+    ufloat CostPerPixel() const override {
+        return  ResamplingCostPerPixel( resamplingMethod );
+    }
+
     eResamplingMethod resamplingMethod;
     eBorderMode borderMode;
     FColor borderValue;
@@ -144,6 +183,19 @@ public:
         , borderValue( iBorderValue )
     {}
 
+    // Samples around the source rect, through the field and mask.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, src.Rect(), false };
+        oAccesses[2] = { &field, field.Rect(), false };
+        oAccesses[3] = { &mask, mask.Rect(), false };
+        return  4;
+    }
+
+    ufloat CostPerPixel() const override {
+        return  ResamplingCostPerPixel( resamplingMethod );
+    }
+
     const FBlock& field;
     const FBlock& mask;
     eResamplingMethod resamplingMethod;
@@ -183,6 +235,13 @@ public:
         , plotSize( iPlotSize )
     {}
 
+    // Plots anywhere in the field and mask.
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        oAccesses[0] = { &dst, dst.Rect(), true };
+        oAccesses[1] = { &mask, mask.Rect(), true };
+        return  2;
+    }
+
     FBlock& mask;
     eResamplingMethod resamplingMethod;
     eBorderMode borderMode;
@@ -204,6 +263,8 @@ public:
     const uint8* ULIS_RESTRICT src;
     uint8* ULIS_RESTRICT dst;
     uint32 line;
+    uint32 x; // First pixel of the span in dstRect.
+    uint32 w; // Number of pixels of the span.
 };
 
 /////////////////////////////////////////////////////
@@ -228,6 +289,29 @@ BuildTransformJob_Scanlines(
     oJargs.src                              = nullptr;
     oJargs.dst                              = dst + ( ( iCargs->dstRect.y + iIndex ) * dst_bps ) + bdp_decal_x;
     oJargs.line                             = static_cast< uint32 >( iIndex );
+    oJargs.x                                = 0;
+    oJargs.w                                = static_cast< uint32 >( iCargs->dstRect.w );
+}
+
+static
+void
+BuildTransformJob_Tiles(
+      const FTransformCommandArgs* iCargs
+    , const int64 iX
+    , const int64 iWidth
+    , const int64 iLine
+    , FTransformJobArgs& oJargs
+)
+{
+    const FFormatMetrics& fmt               = iCargs->src.FormatMetrics();
+    uint8* const ULIS_RESTRICT dst          = iCargs->dst.Bits();
+    const uint32 dst_bps                    = static_cast< uint32 >( iCargs->dst.BytesPerScanLine() );
+    const uint32 bdp_decal_x                = static_cast< uint32 >( iCargs->dstRect.x + iX ) * fmt.BPP;
+    oJargs.src                              = nullptr;
+    oJargs.dst                              = dst + ( ( iCargs->dstRect.y + iLine ) * dst_bps ) + bdp_decal_x;
+    oJargs.line                             = static_cast< uint32 >( iLine );
+    oJargs.x                                = static_cast< uint32 >( iX );
+    oJargs.w                                = static_cast< uint32 >( iWidth );
 }
 
 static
@@ -264,6 +348,29 @@ BuildResizeJob_Scanlines(
     oJargs.src                              = nullptr;
     oJargs.dst                              = dst + ( ( iCargs->dstRect.y + iIndex ) * dst_bps ) + bdp_decal_x;
     oJargs.line                             = static_cast< uint32 >( iIndex );
+    oJargs.x                                = 0;
+    oJargs.w                                = static_cast< uint32 >( iCargs->dstRect.w );
+}
+
+static
+void
+BuildResizeJob_Tiles(
+      const FResizeCommandArgs* iCargs
+    , const int64 iX
+    , const int64 iWidth
+    , const int64 iLine
+    , FTransformJobArgs& oJargs
+)
+{
+    const FFormatMetrics& fmt               = iCargs->src.FormatMetrics();
+    uint8* const ULIS_RESTRICT dst          = iCargs->dst.Bits();
+    const uint32 dst_bps                    = static_cast< uint32 >( iCargs->dst.BytesPerScanLine() );
+    const uint32 bdp_decal_x                = static_cast< uint32 >( iCargs->dstRect.x + iX ) * fmt.BPP;
+    oJargs.src                              = nullptr;
+    oJargs.dst                              = dst + ( ( iCargs->dstRect.y + iLine ) * dst_bps ) + bdp_decal_x;
+    oJargs.line                             = static_cast< uint32 >( iLine );
+    oJargs.x                                = static_cast< uint32 >( iX );
+    oJargs.w                                = static_cast< uint32 >( iWidth );
 }
 
 static
@@ -301,6 +408,8 @@ BuildBezierJob_Scanlines(
     oJargs.src                              = nullptr;
     oJargs.dst                              = dst + ( ( iCargs->dstRect.y + iIndex ) * dst_bps ) + bdp_decal_x;
     oJargs.line                             = static_cast< uint32 >( iIndex );
+    oJargs.x                                = 0;
+    oJargs.w                                = static_cast< uint32 >( iCargs->dstRect.w );
 }
 
 static
@@ -319,42 +428,46 @@ BuildBezierJob_Chunks(
 
 /////////////////////////////////////////////////////
 // Schedulers
-#define ULIS_DEFINE_TRANSFORM_COMMAND_GENERIC( iName )          \
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM(      \
-    Schedule ## iName                                           \
-    , FTransformJobArgs                                         \
-    , FTransformCommandArgs                                     \
-    , &Invoke ## iName < T >                                    \
-    , &BuildTransformJob_Scanlines                              \
-    , &BuildTransformJob_Chunks                                 \
+#define ULIS_DEFINE_TRANSFORM_COMMAND_GENERIC( iName )              \
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(    \
+    Schedule ## iName                                               \
+    , FTransformJobArgs                                             \
+    , FTransformCommandArgs                                         \
+    , &Invoke ## iName < T >                                        \
+    , &BuildTransformJob_Scanlines                                  \
+    , &BuildTransformJob_Chunks                                     \
+    , &BuildTransformJob_Tiles                                      \
 )
-#define ULIS_DEFINE_TRANSFORM_COMMAND_SPECIALIZATION( iName )   \
-ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM(              \
-    Schedule ## iName                                           \
-    , FTransformJobArgs                                         \
-    , FTransformCommandArgs                                     \
-    , &Invoke ## iName                                          \
-    , &BuildTransformJob_Scanlines                              \
-    , &BuildTransformJob_Chunks                                 \
+#define ULIS_DEFINE_TRANSFORM_COMMAND_SPECIALIZATION( iName )    \
+ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(         \
+    Schedule ## iName                                            \
+    , FTransformJobArgs                                          \
+    , FTransformCommandArgs                                      \
+    , &Invoke ## iName                                           \
+    , &BuildTransformJob_Scanlines                               \
+    , &BuildTransformJob_Chunks                                  \
+    , &BuildTransformJob_Tiles                                   \
 )
 
-#define ULIS_DEFINE_RESIZE_COMMAND_GENERIC( iName )         \
-ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM(  \
-    Schedule ## iName                                       \
-    , FTransformJobArgs                                     \
-    , FResizeCommandArgs                                    \
-    , &Invoke ## iName < T >                                \
-    , &BuildResizeJob_Scanlines                             \
-    , &BuildResizeJob_Chunks                                \
+#define ULIS_DEFINE_RESIZE_COMMAND_GENERIC( iName )                 \
+ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(    \
+    Schedule ## iName                                               \
+    , FTransformJobArgs                                             \
+    , FResizeCommandArgs                                            \
+    , &Invoke ## iName < T >                                        \
+    , &BuildResizeJob_Scanlines                                     \
+    , &BuildResizeJob_Chunks                                        \
+    , &BuildResizeJob_Tiles                                         \
 )
-#define ULIS_DEFINE_RESIZE_COMMAND_SPECIALIZATION( iName )  \
-ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM(          \
-    Schedule ## iName                                       \
-    , FTransformJobArgs                                     \
-    , FResizeCommandArgs                                    \
-    , &Invoke ## iName                                      \
-    , &BuildResizeJob_Scanlines                             \
-    , &BuildResizeJob_Chunks                                \
+#define ULIS_DEFINE_RESIZE_COMMAND_SPECIALIZATION( iName )    \
+ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(      \
+    Schedule ## iName                                         \
+    , FTransformJobArgs                                       \
+    , FResizeCommandArgs                                      \
+    , &Invoke ## iName                                        \
+    , &BuildResizeJob_Scanlines                               \
+    , &BuildResizeJob_Chunks                                  \
+    , &BuildResizeJob_Tiles                                   \
 )
 
 #define ULIS_DEFINE_BEZIER_COMMAND_GENERIC( iName )         \
@@ -14,17 +14,47 @@
 #include "Scheduling/Event_Private.h"
 #include "Scheduling/InternalEvent.h"
 #include "Scheduling/Job.h"
+#include "Scheduling/ScheduleCostModel.h"
+#include "Image/Block.h"
+#include "Math/Math.h"
+#include "System/CPUInfo/CPUInfo.h"
 #include "System/ThreadPool/ThreadPool.h"
+#include "System/ThreadPool/ThreadPool_Private.h"
 
 ULIS_NAMESPACE_BEGIN
+namespace {
+/////////////////////////////////////////////////////
+// FFusedJobArgs
+// A band of a fused chain: the jobs [first, last) of every member.
+class FFusedJobArgs final
+    : public IJobArgs
+{
+public:
+    ~FFusedJobArgs() override {}
+    FFusedJobArgs( const FCommand* iGroup, uint64 iFirst, uint64 iLast )
+        : group( iGroup )
+        , first( iFirst )
+        , last( iLast )
+    {}
+
+    const FCommand* group;
+    uint64 first;
+    uint64 last;
+};
+} // namespace
 
 FCommand::~FCommand()
 {
     if( mArgs )
         delete  mArgs;
 
-    for( uint64 i = 0; i < mJobs.Size(); ++i )
-        delete  mJobs[i];
+    ResetJobs();
+    ResetFusedJobs();
+
+    // The commands of the chain complete with this one, their events are
+    // notified by the event of this command.
+    for( uint64 i = 0; i < mFused.Size(); ++i )
+        delete  mFused[i];
 }
 
 FCommand::FCommand(
@@ -37,15 +67,33 @@ FCommand::FCommand(
     , const FEvent* iWaitList
     , FEvent* iEvent
     , const FRectI& iEventGeometry
+    , bool iPointWise
 )
     : mArgs( iArgs )
     , mEvent( nullptr )
-    , mJobs( TArray< const FJob* >() )
+    , mJobStorage( nullptr )
+    , mJobStorageSize( 0 )
+    , mJobs( nullptr )
+    , mNumJobs( 0 )
+    , mJobArgs( nullptr )
+    , mNumJobArgs( 0 )
+    , mDestroyJobArgs( nullptr )
     , mSched( iSched )
     , mPolicy( iPolicy )
     , mContiguous( iContiguous )
     , mForceMonoChunk( iForceMonoChunk )
     , mScheduled( false )
+    , mPointWise( iPointWise )
+    , mPriority( CommandQueuePriority_Normal )
+    , mNextPushed( nullptr )
+    , mName( "Command" )
+    , mFused()
+    , mFusedStorage( nullptr )
+    , mFusedStorageSize( 0 )
+    , mFusedJobs( nullptr )
+    , mNumFusedJobs( 0 )
+    , mRecorded( false )
+    , mRecordedBits()
 {
     // Bind Event
     if( iEvent ) {
@@ -69,22 +117,10 @@ FCommand::Args() const
     return  mArgs;
 }
 
-void
-FCommand::ReserveJobs( uint64 iNum )
-{
-    mJobs.Reserve( iNum );
-}
-
-void
-FCommand::AddJob( const FJob* iJob )
-{
-    mJobs.EmplaceBack( iJob );
-}
-
 uint64
 FCommand::NumJobs() const
 {
-    return  mJobs.Size();
+    return  mFused.Size() ? mNumFusedJobs : mNumJobs;
 }
 
 bool
@@ -103,7 +139,10 @@ void
 FCommand::ProcessAsyncScheduling()
 {
     if( !mScheduled ) {
-        mSched( this, mPolicy, mContiguous, mForceMonoChunk );
+        if( mFused.Size() )
+            ScheduleFused();
+        else
+            mSched( this, mPolicy, mContiguous, mForceMonoChunk );
         mEvent->PostBindAsync();
         mScheduled = true;
     }
@@ -115,10 +154,294 @@ FCommand::Event() const
     return  mEvent;
 }
 
-const TArray< const FJob* >&
+uint32
+FCommand::NumWorkers() const
+{
+    FThreadPool_Private* pool = mEvent->Pool();
+    return  pool ? pool->GetNumWorkers() : FCPUInfo::MaxWorkers();
+}
+
+const FJob*
 FCommand::Jobs() const
 {
-    return  mJobs;
+    return  mFused.Size() ? mFusedJobs : mJobs;
+}
+
+bool
+FCommand::PointWise() const
+{
+    return  mPointWise;
+}
+
+bool
+FCommand::RunsInline() const
+{
+    if( mPolicy.RunPolicy() == eScheduleRunPolicy::ScheduleRun_Inline )
+        return  true;
+    return  mPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Auto && FScheduleCostModel::RunInline( this );
+}
+
+void
+FCommand::SetPriority( eCommandQueuePriority iPriority )
+{
+    mPriority = iPriority;
+}
+
+eCommandQueuePriority
+FCommand::Priority() const
+{
+    return  mPriority;
+}
+
+void
+FCommand::SetNextPushed( const FCommand* iCommand )
+{
+    mNextPushed = iCommand;
+}
+
+const FCommand*
+FCommand::NextPushed() const
+{
+    return  mNextPushed;
+}
+
+void
+FCommand::SetName( const char* iName )
+{
+    mName = iName;
+}
+
+const char*
+FCommand::Name() const
+{
+    return  mName;
+}
+
+void
+FCommand::Fuse( FCommand* iCommand )
+{
+    ULIS_ASSERT( mPointWise && iCommand->mPointWise, "Only point-wise commands can be fused" );
+    ULIS_ASSERT( !iCommand->mFused.Size(), "Cannot fuse a chain into another one" );
+
+    // Jobs built by a sync policy are rebuilt by scanlines when the chain
+    // is scheduled.
+    if( mScheduled ) {
+        ResetJobs();
+        mScheduled = false;
+    }
+
+    // Dependencies of the fused command that are not part of the chain
+    // become dependencies of the whole chain.
+    const TArray< FSharedInternalEvent >& waitList = iCommand->mEvent->WaitList();
+    for( uint64 i = 0; i < waitList.Size(); ++i )
+        if( !FusedWith( waitList[i].get() ) )
+            mEvent->AddImplicitWait( waitList[i] );
+
+    mEvent->AddFusedEvent( iCommand->mEvent );
+    mFused.PushBack( iCommand );
+}
+
+bool
+FCommand::FusedWith( const FInternalEvent* iEvent ) const
+{
+    if( mEvent.get() == iEvent )
+        return  true;
+
+    for( uint64 i = 0; i < mFused.Size(); ++i )
+        if( mFused[i]->mEvent.get() == iEvent )
+            return  true;
+
+    return  false;
+}
+
+const TArray< FCommand* >&
+FCommand::FusedCommands() const
+{
+    return  mFused;
+}
+
+void
+FCommand::Record()
+{
+    mRecorded = true;
+    ProcessAsyncScheduling();
+    SnapshotBits();
+}
+
+bool
+FCommand::Recorded() const
+{
+    return  mRecorded;
+}
+
+void
+FCommand::Rearm( uint32 iNumWait, const FEvent* iWaitList )
+{
+    ULIS_ASSERT( mRecorded, "Only recorded commands can be submitted again" );
+
+    // Jobs point in the storage of the blocks, they are rebuilt if it moved,
+    // for instance after LoadFromData() on the same FBlock.
+    if( SnapshotBits() ) {
+        if( mFused.Size() )
+            ResetFusedJobs();
+        else
+            ResetJobs();
+        mScheduled = false;
+    }
+
+    FSharedInternalEvent previous = mEvent;
+    mEvent = FInternalEvent::MakeShared();
+    mEvent->InheritMetrics( *previous );
+    mEvent->Bind( this, iNumWait, iWaitList, FRectI() );
+    for( uint64 i = 0; i < mFused.Size(); ++i ) {
+        FCommand* member = mFused[i];
+        previous = member->mEvent;
+        member->mEvent = FInternalEvent::MakeShared();
+        member->mEvent->InheritMetrics( *previous );
+        member->mEvent->Bind( member, 0, nullptr, FRectI() );
+        mEvent->AddFusedEvent( member->mEvent );
+    }
+    ProcessAsyncScheduling();
+}
+
+bool
+FCommand::SnapshotBits()
+{
+    // Commands with unknown accesses cannot tell, they keep their jobs.
+    bool moved = false;
+    uint64 k = 0;
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    for( uint64 i = 0; i <= mFused.Size(); ++i ) {
+        const FCommand* member = i ? mFused[ i - 1 ] : this;
+        const uint32 numAccesses = member->mArgs->Accesses( accesses );
+        for( uint32 j = 0; j < numAccesses; ++j, ++k ) {
+            const uint8* bits = accesses[j].block->Bits();
+            if( k == mRecordedBits.Size() ) {
+                mRecordedBits.PushBack( bits );
+            } else if( mRecordedBits[k] != bits ) {
+                mRecordedBits[k] = bits;
+                moved = true;
+            }
+        }
+    }
+    return  moved;
+}
+
+void
+FCommand::ResetFusedJobs()
+{
+    if( !mFusedStorage )
+        return;
+
+    FFusedJobArgs* bands = reinterpret_cast< FFusedJobArgs* >( mFusedJobs + mNumFusedJobs );
+    for( uint64 i = 0; i < mNumFusedJobs; ++i ) {
+        mFusedJobs[i].~FJob();
+        bands[i].~FFusedJobArgs();
+    }
+    FSchedulingMemoryPool::Free( mFusedStorage, mFusedStorageSize );
+    mFusedStorage = nullptr;
+    mFusedStorageSize = 0;
+    mFusedJobs = nullptr;
+    mNumFusedJobs = 0;
+}
+
+void
+FCommand::ResetJobs()
+{
+    for( uint64 i = 0; i < mNumJobs; ++i )
+        mJobs[i].~FJob();
+
+    if( mDestroyJobArgs )
+        mDestroyJobArgs( mJobArgs, mNumJobArgs );
+
+    FSchedulingMemoryPool::Free( mJobStorage, mJobStorageSize );
+    mJobStorage = nullptr;
+    mJobStorageSize = 0;
+    mJobs = nullptr;
+    mNumJobs = 0;
+    mJobArgs = nullptr;
+    mNumJobArgs = 0;
+    mDestroyJobArgs = nullptr;
+}
+
+void
+FCommand::ScheduleFused()
+{
+    // Every member is built with one job per scanline of the shared
+    // destination region, then scanlines are grouped in bands that fit in
+    // the L1 cache.
+    const uint64 numMembers = mFused.Size() + 1;
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    mArgs->Accesses( accesses );
+    const uint64 numLines = static_cast< uint64 >( FMath::Max( accesses[0].rect.h, 0 ) );
+    const uint64 lineBytes = static_cast< uint64 >( FMath::Max( accesses[0].rect.w, 1 ) ) * accesses[0].block->BytesPerPixel();
+
+    bool aligned = true;
+    for( uint64 i = 0; i < numMembers; ++i ) {
+        FCommand* member = i ? mFused[ i - 1 ] : this;
+        member->ResetJobs();
+        member->mSched( member, FSchedulePolicy::MultiScanlines, false, false );
+        member->mScheduled = true;
+        aligned = aligned && member->mNumJobs == numLines;
+    }
+
+    // Schedulers that do not split by scanlines run the whole chain in a
+    // single band.
+    uint64 bandLines = aligned ? FMath::Max( uint64( FCPUInfo::L1CacheSize() ) / lineBytes, uint64( 1 ) ) : UINT64_MAX;
+    uint64 numBands = aligned ? FMath::Max( ( numLines + bandLines - 1 ) / bandLines, uint64( 1 ) ) : 1;
+
+    // Layout: [ jobs ][ band args ]
+    static_assert( sizeof( FJob ) % alignof( FFusedJobArgs ) == 0, "Bad fused jobs layout" );
+    mFusedStorageSize = numBands * ( sizeof( FJob ) + sizeof( FFusedJobArgs ) );
+    mFusedStorage = static_cast< uint8* >( FSchedulingMemoryPool::Malloc( mFusedStorageSize ) );
+    mFusedJobs = reinterpret_cast< FJob* >( mFusedStorage );
+    FFusedJobArgs* bands = reinterpret_cast< FFusedJobArgs* >( mFusedJobs + numBands );
+    for( uint64 i = 0; i < numBands; ++i ) {
+        const uint64 first = aligned ? i * bandLines : 0;
+        const uint64 last = aligned ? FMath::Min( first + bandLines, numLines ) : UINT64_MAX;
+        new  ( bands + i )  FFusedJobArgs( this, first, last );
+        new  ( mFusedJobs + i )  FJob( 1, &FCommand::InvokeFusedBand, bands + i, static_cast< uint32 >( sizeof( FFusedJobArgs ) ), this );
+    }
+    mNumFusedJobs = numBands;
+}
+
+//static
+void
+FCommand::InvokeFusedBand( const IJobArgs* iJobArgs, const ICommandArgs* iCommandArgs )
+{
+    const FFusedJobArgs* band = static_cast< const FFusedJobArgs* >( iJobArgs );
+    const FCommand* group = band->group;
+    const uint64 numMembers = group->mFused.Size() + 1;
+    for( uint64 i = 0; i < numMembers; ++i ) {
+        const FCommand* member = i ? group->mFused[ i - 1 ] : group;
+        const uint64 last = FMath::Min( band->last, member->mNumJobs );
+        for( uint64 j = band->first; j < last; ++j )
+            member->mJobs[j].Execute();
+    }
+}
+
+uint8*
+FCommand::AllocateJobStorage( uint64 iNumJobs, uint64 iNumArgs, uint64 iArgsSize, uint64 iArgsAlignment, fpDestroyJobArgs iDestroyJobArgs )
+{
+    ULIS_ASSERT( !mJobStorage, "Jobs storage already allocated" );
+
+    // Layout: [ jobs ][ pad ][ job args ]
+    const uint64 argsOffset = ( ( iNumJobs * sizeof( FJob ) + iArgsAlignment - 1 ) / iArgsAlignment ) * iArgsAlignment;
+    mJobStorageSize = argsOffset + iNumArgs * iArgsSize;
+    mJobStorage = static_cast< uint8* >( FSchedulingMemoryPool::Malloc( mJobStorageSize ) );
+    mJobs = reinterpret_cast< FJob* >( mJobStorage );
+    mJobArgs = mJobStorage + argsOffset;
+    mNumJobArgs = iNumArgs;
+    mDestroyJobArgs = iDestroyJobArgs;
+    return  mJobArgs;
+}
+
+void
+FCommand::EmplaceJob( uint32 iNumTasks, fpTask iTask, const IJobArgs* iArgs, uint32 iArgsStride )
+{
+    ULIS_ASSERT( reinterpret_cast< uint8* >( mJobs + mNumJobs ) + sizeof( FJob ) <= mJobArgs, "Jobs storage overflow" );
+    new  ( mJobs + mNumJobs )  FJob( iNumTasks, iTask, iArgs, iArgsStride, this );
+    ++mNumJobs;
 }
 
 ULIS_NAMESPACE_END
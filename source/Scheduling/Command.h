@@ -12,15 +12,20 @@
 #pragma once
 #include "Core/Core.h"
 #include "Memory/Array.h"
+#include "Scheduling/CommandQueue.h"
 #include "Scheduling/ScheduleArgs.h"
 #include "Scheduling/SchedulePolicy.h"
 #include "Scheduling/Event.h"
 #include "Scheduling/InternalEvent.h"
+#include "Scheduling/SchedulingMemoryPool.h"
+#include <new>
 
 ULIS_NAMESPACE_BEGIN
 class FCommand;
 class FJob;
 typedef void (*fpCommandScheduler)( FCommand*, const FSchedulePolicy&, bool, bool );
+typedef void (*fpTask)( const IJobArgs*, const ICommandArgs* );
+typedef void (*fpDestroyJobArgs)( uint8*, uint64 );
 
 /////////////////////////////////////////////////////
 /// @class      FCommand
@@ -32,9 +37,28 @@ typedef void (*fpCommandScheduler)( FCommand*, const FSchedulePolicy&, bool, boo
 ///             scheduling information is stored in a FSchedulePolicy, and
 ///             which operation arguments are stored in a ICommandArgs child class.
 ///
+///             The jobs of a command and the arguments of their tasks are
+///             stored inline in a single buffer owned by the command. This
+///             buffer, the command itself and its ICommandArgs come from the
+///             FSchedulingMemoryPool, and are recycled when the command
+///             completes.
+///
+///             Point-wise commands, where each pixel of the destination only
+///             depends on the same pixel of the inputs, can absorb the
+///             point-wise commands that follow them on the same destination.
+///             The fused chain is scheduled as a single command, which jobs
+///             run every member of the chain on a band of scanlines before
+///             moving to the next band, so that the band stays in cache
+///             instead of streaming the whole block once per command.
+///
 ///             \sa FCommandQueue
+///             \sa FJob
+///             \sa FSchedulingMemoryPool
 class FCommand {
 public:
+    ULIS_DECLARE_SCHEDULING_POOL_ALLOCATION
+
+
     /*! Destructor */
     ~FCommand();
 
@@ -49,6 +73,7 @@ public:
         , const FEvent* iWaitList
         , FEvent* iEvent
         , const FRectI& iEventGeometry
+        , bool iPointWise = false
     );
 
     /*! explicitly deleted default constructor. */
@@ -69,11 +94,29 @@ public:
     /*! Get the args */
     const ICommandArgs* Args() const;
 
-    /*! Reserve some space for jobs */
-    void ReserveJobs( uint64 iNum );
+    /*!
+        Allocate the storage for iNumJobs jobs and iNumArgs default
+        constructed job args, and return the first job args.
+        This can only be done once per command.
+    */
+    template< typename TJobArgs >
+    TJobArgs* ReserveJobs( uint64 iNumJobs, uint64 iNumArgs ) {
+        static_assert( alignof( TJobArgs ) <= alignof( std::max_align_t ), "Overaligned job args are not supported" );
+        uint8* storage = AllocateJobStorage( iNumJobs, iNumArgs, sizeof( TJobArgs ), alignof( TJobArgs ), &DestroyJobArgs< TJobArgs > );
+        TJobArgs* args = reinterpret_cast< TJobArgs* >( storage );
+        for( uint64 i = 0; i < iNumArgs; ++i )
+            new  ( args + i )  TJobArgs();
+        return  args;
+    }
 
-    /*! Add a job */
-    void AddJob( const FJob* iJob );
+    /*!
+        Add a job in the reserved storage, running iNumTasks tasks which args
+        are contiguous from iArgs.
+    */
+    template< typename TJobArgs >
+    void AddJob( uint32 iNumTasks, fpTask iTask, const TJobArgs* iArgs ) {
+        EmplaceJob( iNumTasks, iTask, iArgs, static_cast< uint32 >( sizeof( TJobArgs ) ) );
+    }
 
     /*! Query num jobs */
     uint64 NumJobs() const;
@@ -95,17 +138,116 @@ public:
 
     FSharedInternalEvent Event() const;
 
-    const TArray< const FJob* >& Jobs() const;
+    /*!
+        Get the number of workers of the pool the command is submitted to,
+        or the number of workers the system can run in parallel if it is not
+        submitted yet.
+    */
+    uint32 NumWorkers() const;
+
+    /*! Get the jobs, they are contiguous in memory. */
+    const FJob* Jobs() const;
+
+    /*! Check whether the command is point-wise. */
+    bool PointWise() const;
+
+    /*!
+        Check whether the command should run inline, on the thread that
+        flushes its queue, from its policy and its estimated cost.
+    */
+    bool RunsInline() const;
+
+    /*! Set the priority class of the queue the command is pushed to. */
+    void SetPriority( eCommandQueuePriority iPriority );
+
+    /*! Get the priority class of the command. */
+    eCommandQueuePriority Priority() const;
+
+    /*! Link the command to another one, in the pushed list of a queue. */
+    void SetNextPushed( const FCommand* iCommand );
+
+    /*! Get the command linked to this one in the pushed list of a queue. */
+    const FCommand* NextPushed() const;
+
+    /*! Set the name of the operation, a string literal that outlives the command. */
+    void SetName( const char* iName );
+
+    /*! Get the name of the operation. */
+    const char* Name() const;
+
+    /*!
+        Append iCommand to the chain of commands fused with this one.
+        The fused command is owned by this one, it is never scheduled on its
+        own and its event finishes along with the chain. Both commands must be
+        point-wise and write the same region, and neither can be flushed yet.
+    */
+    void Fuse( FCommand* iCommand );
+
+    /*! Check whether iEvent is the event of a command of the chain. */
+    bool FusedWith( const FInternalEvent* iEvent ) const;
+
+    /*! Get the commands fused with this one, in chain order. */
+    const TArray< FCommand* >& FusedCommands() const;
+
+    /*!
+        Keep the command alive after it runs, so that it can be submitted
+        again, and build its jobs right away. The command then belongs to a
+        FCommandList.
+    */
+    void Record();
+
+    /*! Check whether the command belongs to a FCommandList. */
+    bool Recorded() const;
+
+    /*!
+        Bind fresh events to a recorded command and to its fused commands,
+        for a new submission. The jobs are kept, unless the storage of a
+        block accessed by the chain moved since they were built.
+    */
+    void Rearm( uint32 iNumWait, const FEvent* iWaitList );
+
+private:
+    void ResetJobs();
+    void ResetFusedJobs();
+    bool SnapshotBits();
+    void ScheduleFused();
+    static void InvokeFusedBand( const IJobArgs* iJobArgs, const ICommandArgs* iCommandArgs );
+    uint8* AllocateJobStorage( uint64 iNumJobs, uint64 iNumArgs, uint64 iArgsSize, uint64 iArgsAlignment, fpDestroyJobArgs iDestroyJobArgs );
+    void EmplaceJob( uint32 iNumTasks, fpTask iTask, const IJobArgs* iArgs, uint32 iArgsStride );
+
+    template< typename TJobArgs >
+    static void DestroyJobArgs( uint8* iArgs, uint64 iNumArgs ) {
+        TJobArgs* args = reinterpret_cast< TJobArgs* >( iArgs );
+        for( uint64 i = 0; i < iNumArgs; ++i )
+            args[i].~TJobArgs();
+    }
 
 private:
     const ICommandArgs* mArgs;
     FSharedInternalEvent mEvent;
-    TArray< const FJob* > mJobs;
+    uint8* mJobStorage;
+    uint64 mJobStorageSize;
+    FJob* mJobs;
+    uint64 mNumJobs;
+    uint8* mJobArgs;
+    uint64 mNumJobArgs;
+    fpDestroyJobArgs mDestroyJobArgs;
     fpCommandScheduler mSched;
     FSchedulePolicy mPolicy;
     bool mContiguous;
     bool mForceMonoChunk;
     bool mScheduled;
+    bool mPointWise;
+    eCommandQueuePriority mPriority;
+    const FCommand* mNextPushed;
+    const char* mName;
+    TArray< FCommand* > mFused;
+    uint8* mFusedStorage;
+    uint64 mFusedStorageSize;
+    FJob* mFusedJobs;
+    uint64 mNumFusedJobs;
+    bool mRecorded;
+    TArray< const uint8* > mRecordedBits;
 };
 
 ULIS_NAMESPACE_END
@@ -0,0 +1,39 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandList.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FCommandList class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/CommandList.h"
+#include "Scheduling/CommandList_Private.h"
+
+ULIS_NAMESPACE_BEGIN
+FCommandList::~FCommandList()
+{
+    delete  d;
+}
+
+FCommandList::FCommandList()
+    : d( new  FCommandList_Private() )
+{
+}
+
+uint64
+FCommandList::Size() const
+{
+    return  d->Size();
+}
+
+bool
+FCommandList::IsEmpty() const
+{
+    return  d->Size() == 0;
+}
+
+ULIS_NAMESPACE_END
+
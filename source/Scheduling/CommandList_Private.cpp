@@ -0,0 +1,153 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandList_Private.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FCommandList_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/CommandList_Private.h"
+#include "Scheduling/InternalEvent.h"
+#include <algorithm>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+FCommandList_Private::~FCommandList_Private()
+{
+    Clear();
+}
+
+FCommandList_Private::FCommandList_Private()
+    : mCommands()
+    , mFirstPredecessor()
+    , mPredecessors()
+    , mNumSubmissions( 0 )
+{
+}
+
+uint64
+FCommandList_Private::Size() const
+{
+    return  mCommands.Size();
+}
+
+void
+FCommandList_Private::Clear()
+{
+    PrepareSubmission();
+    for( uint64 i = 0; i < mCommands.Size(); ++i )
+        delete  mCommands[i];
+
+    mCommands.Clear();
+    mFirstPredecessor.Clear();
+    mPredecessors.Clear();
+    mNumSubmissions = 0;
+}
+
+void
+FCommandList_Private::Push( FCommand* iCommand )
+{
+    mCommands.PushBack( iCommand );
+}
+
+void
+FCommandList_Private::EndRecording()
+{
+    const uint64 size = mCommands.Size();
+    for( uint64 i = 0; i < size; ++i )
+        mCommands[i]->Record();
+
+    // Gather the edges between recorded commands, as pairs of successor
+    // and predecessor. A command can only wait for the ones recorded before.
+    std::vector< std::pair< uint64, uint64 > > edges;
+    TArray< FSharedInternalEvent > dependents;
+    for( uint64 i = 0; i < size; ++i ) {
+        const FCommand* cmd = mCommands[i];
+        const TArray< FCommand* >& fused = cmd->FusedCommands();
+        dependents.Clear();
+        cmd->Event()->Dependents( &dependents );
+        for( uint64 j = 0; j < fused.Size(); ++j )
+            fused[j]->Event()->Dependents( &dependents );
+
+        for( uint64 j = 0; j < dependents.Size(); ++j ) {
+            for( uint64 k = i + 1; k < size; ++k ) {
+                if( mCommands[k]->FusedWith( dependents[j].get() ) ) {
+                    edges.emplace_back( k, i );
+                    break;
+                }
+            }
+        }
+    }
+
+    // Keep only the edges that are not implied by others, so that each
+    // submission registers as few dependencies as possible: hazard tracking
+    // alone makes a command wait for every earlier one it overlaps. Commands
+    // are in topological order, and the predecessors of each command are
+    // visited from the latest, so that a predecessor is redundant if it is
+    // reached through one already kept. reach holds, for each command, the
+    // bitset of all the commands it waits for, directly or not.
+    std::sort( edges.begin(), edges.end(), []( const std::pair< uint64, uint64 >& iA, const std::pair< uint64, uint64 >& iB ) {
+        return  iA.first != iB.first ? iA.first < iB.first : iA.second > iB.second;
+    } );
+    const uint64 words = ( size + 63 ) / 64;
+    std::vector< uint64 > reach( size * words, 0 );
+    mFirstPredecessor.Clear();
+    mFirstPredecessor.Resize( size + 1 );
+    mPredecessors.Clear();
+    uint64 e = 0;
+    for( uint64 k = 0; k < size; ++k ) {
+        mFirstPredecessor[k] = mPredecessors.Size();
+        uint64* cover = reach.data() + k * words;
+        for( ; e < edges.size() && edges[e].first == k; ++e ) {
+            const uint64 p = edges[e].second;
+            if( cover[ p / 64 ] & ( uint64( 1 ) << ( p % 64 ) ) )
+                continue;
+
+            mPredecessors.PushBack( p );
+            const uint64* reachP = reach.data() + p * words;
+            for( uint64 w = 0; w < words; ++w )
+                cover[w] |= reachP[w];
+            cover[ p / 64 ] |= uint64( 1 ) << ( p % 64 );
+        }
+    }
+    mFirstPredecessor[ size ] = mPredecessors.Size();
+}
+
+void
+FCommandList_Private::PrepareSubmission()
+{
+    // The events bound while recording are never submitted, only the ones
+    // of a previous submission are waited for.
+    if( mNumSubmissions ) {
+        for( uint64 i = 0; i < mCommands.Size(); ++i ) {
+            FSharedInternalEvent evt = mCommands[i]->Event();
+            ULIS_ASSERT( evt->Pool(), "A command list cannot be submitted again before its previous submission is flushed" );
+            evt->Wait();
+        }
+    }
+    ++mNumSubmissions;
+}
+
+FCommand*
+FCommandList_Private::Command( uint64 iIndex ) const
+{
+    return  mCommands[ iIndex ];
+}
+
+uint64
+FCommandList_Private::NumPredecessors( uint64 iIndex ) const
+{
+    return  mFirstPredecessor[ iIndex + 1 ] - mFirstPredecessor[ iIndex ];
+}
+
+uint64
+FCommandList_Private::Predecessor( uint64 iIndex, uint64 iPred ) const
+{
+    return  mPredecessors[ mFirstPredecessor[ iIndex ] + iPred ];
+}
+
+ULIS_NAMESPACE_END
+
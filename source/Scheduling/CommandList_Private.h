@@ -0,0 +1,77 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandList_Private.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FCommandList_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Memory/Array.h"
+#include "Scheduling/CommandList.h"
+#include "Scheduling/Command.h"
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FCommandList_Private
+/// @brief      The FCommandList_Private class stores the recorded commands of
+///             a FCommandList, and the dependencies between them.
+/// @details    Dependencies are stored by index, the predecessors of each
+///             command are contiguous in a single array. They are gathered
+///             once when the recording ends, from the dependents registered
+///             on the events bound while recording.
+///
+///             \sa FCommandList
+///             \sa FCommandQueue_Private
+class FCommandList_Private
+{
+public:
+    /*! Destructor */
+    ~FCommandList_Private();
+
+    /*! Constructor */
+    FCommandList_Private();
+
+    /*! Get the number of recorded commands. */
+    uint64 Size() const;
+
+    /*! Delete the recorded commands, once they are complete. */
+    void Clear();
+
+    /*! Append a recorded command, the list takes ownership. */
+    void Push( FCommand* iCommand );
+
+    /*!
+        Build the jobs of the recorded commands and gather the dependencies
+        between them.
+    */
+    void EndRecording();
+
+    /*!
+        Wait for the previous submission of the list to complete, if any,
+        before a new one.
+    */
+    void PrepareSubmission();
+
+    /*! Get the recorded command at iIndex. */
+    FCommand* Command( uint64 iIndex ) const;
+
+    /*! Get the number of commands the command at iIndex waits for. */
+    uint64 NumPredecessors( uint64 iIndex ) const;
+
+    /*! Get the index of the iPred-th command the command at iIndex waits for. */
+    uint64 Predecessor( uint64 iIndex, uint64 iPred ) const;
+
+private:
+    TArray< FCommand* > mCommands;
+    TArray< uint64 > mFirstPredecessor;
+    TArray< uint64 > mPredecessors;
+    uint64 mNumSubmissions;
+};
+
+ULIS_NAMESPACE_END
+
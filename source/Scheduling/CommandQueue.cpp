@@ -11,6 +11,10 @@
 */
 #include "Scheduling/CommandQueue.h"
 #include "Scheduling/CommandQueue_Private.h"
+#include "Scheduling/CommandList.h"
+#include "Scheduling/CommandList_Private.h"
+#include "Math/Math.h"
+#include "System/MemoryInfo/MemoryInfo.h"
 
 ULIS_NAMESPACE_BEGIN
 FCommandQueue::~FCommandQueue()
@@ -18,8 +22,8 @@ FCommandQueue::~FCommandQueue()
     delete  d;
 }
 
-FCommandQueue::FCommandQueue( FThreadPool& iPool )
-    : d( new  FCommandQueue_Private( iPool ) )
+FCommandQueue::FCommandQueue( FThreadPool& iPool, eCommandQueuePriority iPriority )
+    : d( new  FCommandQueue_Private( iPool, iPriority ) )
 {
 }
 
@@ -41,5 +45,92 @@ FCommandQueue::Fence()
     d->Fence();
 }
 
+void
+FCommandQueue::SetHazardTracking( bool iEnable )
+{
+    d->SetHazardTracking( iEnable );
+}
+
+bool
+FCommandQueue::HazardTracking() const
+{
+    return  d->HazardTracking();
+}
+
+void
+FCommandQueue::SetCommandFusion( bool iEnable )
+{
+    d->SetCommandFusion( iEnable );
+}
+
+bool
+FCommandQueue::CommandFusion() const
+{
+    return  d->CommandFusion();
+}
+
+eCommandQueuePriority
+FCommandQueue::Priority() const
+{
+    return  d->Priority();
+}
+
+void
+FCommandQueue::SetMemoryBudget( uint64 iBytes )
+{
+    d->SetMemoryBudget( iBytes );
+}
+
+uint64
+FCommandQueue::MemoryBudget() const
+{
+    return  d->MemoryBudget();
+}
+
+uint64
+FCommandQueue::MemoryInFlight() const
+{
+    return  d->MemoryInFlight();
+}
+
+//static
+uint64
+FCommandQueue::AvailableMemoryBudget( ufloat iFraction )
+{
+    const uint64 total = FMemoryInfo::TotalRAM();
+    const uint64 used = FMemoryInfo::TotalRAMCurrentlyUsed();
+    const uint64 available = total > used ? total - used : 0;
+    return  static_cast< uint64 >( available * static_cast< udouble >( FMath::Clamp( iFraction, 0.f, 1.f ) ) );
+}
+
+void
+FCommandQueue::BeginRecording( FCommandList& oList )
+{
+    d->BeginRecording( oList.d );
+}
+
+void
+FCommandQueue::EndRecording()
+{
+    d->EndRecording();
+}
+
+bool
+FCommandQueue::Recording() const
+{
+    return  d->Recording();
+}
+
+void
+FCommandQueue::Submit(
+      const FCommandList& iList
+    , uint32 iNumWait
+    , const FEvent* iWaitList
+    , FEvent* iEvent
+)
+{
+    d->Submit( iList.d, iNumWait, iWaitList, iEvent );
+}
+
 ULIS_NAMESPACE_END
 
@@ -10,32 +10,81 @@
 * @license      Please refer to LICENSE.md
 */
 #include "Scheduling/CommandQueue_Private.h"
+#include "Scheduling/CommandList_Private.h"
+#include "Process/Custom/No_OP.h"
 #include "System/ThreadPool/ThreadPool.h"
 #include "System/ThreadPool/ThreadPool_Private.h"
 
 ULIS_NAMESPACE_BEGIN
 FCommandQueue_Private::~FCommandQueue_Private()
 {
-    // Cleanse unprocessed commands
-    while( !mQueue.IsEmpty() )
+    // Cleanse unprocessed commands, recorded ones belong to their list.
+    const FCommand* cmd = mPushed.exchange( nullptr );
+    while( cmd )
     {
-        const FCommand* cmd = mQueue.Front();
-        delete  cmd;
-        mQueue.Pop();
+        const FCommand* next = cmd->NextPushed();
+        if( !cmd->Recorded() )
+            delete  cmd;
+        cmd = next;
     }
 }
 
-FCommandQueue_Private::FCommandQueue_Private( FThreadPool& iPool )
+FCommandQueue_Private::FCommandQueue_Private( FThreadPool& iPool, eCommandQueuePriority iPriority )
     : mPool( iPool )
-    , mQueue( tQueue() )
+    , mPriority( iPriority )
+    , mCompletion( std::make_shared< FCompletionCounter >() )
+    , mPushed( nullptr )
+    , bHazardTracking( false )
+    , bCommandFusion( false )
+    , mFusionLeader( nullptr )
+    , mRecording( nullptr )
+    , mStashedAccesses()
+    , bInlineCandidates( false )
+    , mMemoryBudget( 0 )
 {
 }
 
 void
 FCommandQueue_Private::Flush()
 {
-    mPool.d->ScheduleCommands( mQueue );
-    mQueue.Clear();
+    // Flushed commands may start anytime, the next ones cannot join them.
+    const FCommand* last = nullptr;
+    {
+        std::lock_guard< std::mutex > lock( mTrackingMutex );
+        mFusionLeader = nullptr;
+        last = mPushed.exchange( nullptr, std::memory_order_acquire );
+    }
+    const bool inlineCandidates = bInlineCandidates.exchange( false, std::memory_order_relaxed );
+
+    // Back in push order.
+    const FCommand* first = nullptr;
+    uint32 size = 0;
+    while( last ) {
+        const FCommand* prev = last->NextPushed();
+        const_cast< FCommand* >( last )->SetNextPushed( first );
+        first = last;
+        last = prev;
+        ++size;
+    }
+    mCompletion->Add( size );
+
+    // Tiny commands which dependencies are all finished run right here,
+    // rather than through the scheduler thread and a worker. The commands
+    // before them are submitted first, so that they do not wait behind them.
+    // The others are submitted in order, the ones that wait for an inline
+    // command are released when it finishes.
+    tQueue scheduled;
+    for( const FCommand* cmd = first; cmd; ) {
+        const FCommand* next = cmd->NextPushed();
+        if( inlineCandidates && cmd->RunsInline() && cmd->Event()->SubmitInline( mPool.d ) ) {
+            mPool.d->ScheduleCommands( scheduled );
+            mPool.d->RunCommand( cmd );
+        } else {
+            scheduled.Push( cmd );
+        }
+        cmd = next;
+    }
+    mPool.d->ScheduleCommands( scheduled );
 }
 
 void
@@ -48,15 +97,344 @@ FCommandQueue_Private::Finish()
 void
 FCommandQueue_Private::Fence()
 {
-    mPool.WaitForCompletion();
+    mCompletion->Wait( mPool.WaitSpinCount() );
+
+    // Everything issued is complete, other threads may have pushed since.
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    if( !mRecording )
+        PruneTrackedAccesses();
 }
 
 void
-FCommandQueue_Private::Push( const FCommand* iCommand )
+FCommandQueue_Private::Push( const FCommand* iCommand, const char* iName )
 {
     ULIS_ASSERT( iCommand, "Error: no input command" );
+    const_cast< FCommand* >( iCommand )->SetName( iName );
     iCommand->Event()->NotifyQueued();
-    mQueue.Push( iCommand );
+    const_cast< FCommand* >( iCommand )->SetPriority( mPriority );
+
+    // Backpressure, the commands in flight must make room first. The ones
+    // still in the queue are flushed so that they can finish at all.
+    // Recorded commands do not run now, they are not accounted.
+    const uint64 budget = mMemoryBudget.load( std::memory_order_relaxed );
+    const uint64 footprint = budget && !mRecording ? iCommand->Args()->Footprint() : 0;
+    if( footprint && !mCompletion->TryReserve( footprint, budget ) ) {
+        Flush();
+        mCompletion->Reserve( footprint, budget );
+    }
+
+    // Lock-free path, the command does not depend on the previous ones.
+    if( !bHazardTracking && !bCommandFusion && !mRecording ) {
+        iCommand->Event()->SetCompletionCounter( mCompletion, footprint );
+        Enqueue( iCommand );
+        return;
+    }
+
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    FCommand* leader = bCommandFusion ? FusionLeader( iCommand ) : nullptr;
+    if( bHazardTracking )
+        TrackHazards( iCommand, leader );
+
+    if( leader ) {
+        leader->Event()->AddFootprint( footprint );
+        leader->Fuse( const_cast< FCommand* >( iCommand ) );
+        return;
+    }
+
+    if( mRecording ) {
+        mRecording->Push( const_cast< FCommand* >( iCommand ) );
+    } else {
+        iCommand->Event()->SetCompletionCounter( mCompletion, footprint );
+        Enqueue( iCommand );
+    }
+    mFusionLeader = iCommand->PointWise() ? const_cast< FCommand* >( iCommand ) : nullptr;
+}
+
+void
+FCommandQueue_Private::Enqueue( const FCommand* iCommand )
+{
+    // The flag is raised before the command is published, a Flush() that
+    // takes the command sees it.
+    if( iCommand->RunsInline() )
+        bInlineCandidates.store( true, std::memory_order_relaxed );
+
+    const FCommand* last = mPushed.load( std::memory_order_relaxed );
+    do {
+        const_cast< FCommand* >( iCommand )->SetNextPushed( last );
+    } while( !mPushed.compare_exchange_weak( last, iCommand, std::memory_order_release, std::memory_order_relaxed ) );
+}
+
+void
+FCommandQueue_Private::SetHazardTracking( bool iEnable )
+{
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    bHazardTracking = iEnable;
+    if( !bHazardTracking )
+        mTrackedAccesses.Clear();
+}
+
+bool
+FCommandQueue_Private::HazardTracking() const
+{
+    return  bHazardTracking;
+}
+
+void
+FCommandQueue_Private::SetCommandFusion( bool iEnable )
+{
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    bCommandFusion = iEnable;
+    if( !bCommandFusion )
+        mFusionLeader = nullptr;
+}
+
+bool
+FCommandQueue_Private::CommandFusion() const
+{
+    return  bCommandFusion;
+}
+
+eCommandQueuePriority
+FCommandQueue_Private::Priority() const
+{
+    return  mPriority;
+}
+
+void
+FCommandQueue_Private::SetMemoryBudget( uint64 iBytes )
+{
+    mMemoryBudget = iBytes;
+}
+
+uint64
+FCommandQueue_Private::MemoryBudget() const
+{
+    return  mMemoryBudget;
+}
+
+uint64
+FCommandQueue_Private::MemoryInFlight() const
+{
+    return  mCompletion->Footprint();
+}
+
+void
+FCommandQueue_Private::BeginRecording( FCommandList_Private* iList )
+{
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    ULIS_ASSERT( !mRecording, "The queue is already recording" );
+    iList->Clear();
+    mRecording = iList;
+    mFusionLeader = nullptr;
+
+    // Recorded commands do not run now, they are tracked apart from the
+    // commands of the queue.
+    for( uint64 i = 0; i < mTrackedAccesses.Size(); ++i )
+        mStashedAccesses.PushBack( mTrackedAccesses[i] );
+    mTrackedAccesses.Clear();
+}
+
+void
+FCommandQueue_Private::EndRecording()
+{
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    ULIS_ASSERT( mRecording, "The queue is not recording" );
+    mRecording->EndRecording();
+    mRecording = nullptr;
+    mFusionLeader = nullptr;
+
+    mTrackedAccesses.Clear();
+    if( bHazardTracking )
+        for( uint64 i = 0; i < mStashedAccesses.Size(); ++i )
+            mTrackedAccesses.PushBack( mStashedAccesses[i] );
+    mStashedAccesses.Clear();
+}
+
+bool
+FCommandQueue_Private::Recording() const
+{
+    return  mRecording != nullptr;
+}
+
+void
+FCommandQueue_Private::Submit( FCommandList_Private* iList, uint32 iNumWait, const FEvent* iWaitList, FEvent* iEvent )
+{
+    ULIS_ASSERT( !mRecording, "Cannot submit a command list while recording" );
+    iList->PrepareSubmission();
+    std::lock_guard< std::mutex > lock( mTrackingMutex );
+    mFusionLeader = nullptr;
+
+    // Commands are armed in recording order, so that their predecessors
+    // are always armed first. Hazards are only checked against the commands
+    // tracked before the submission, the order within the list is the
+    // recorded one.
+    const uint64 size = iList->Size();
+    if( bHazardTracking )
+        PruneTrackedAccesses();
+    const uint64 numTracked = mTrackedAccesses.Size();
+    for( uint64 i = 0; i < size; ++i ) {
+        FCommand* cmd = iList->Command( i );
+        const uint64 numPredecessors = iList->NumPredecessors( i );
+        if( numPredecessors )
+            cmd->Rearm( 0, nullptr );
+        else
+            cmd->Rearm( iNumWait, iWaitList );
+
+        FSharedInternalEvent evt = cmd->Event();
+        evt->NotifyQueued();
+        cmd->SetPriority( mPriority );
+        for( uint64 j = 0; j < numPredecessors; ++j )
+            evt->AddImplicitWait( iList->Command( iList->Predecessor( i, j ) )->Event() );
+
+        if( numTracked ) {
+            WaitForHazards( cmd, nullptr, numTracked );
+            const TArray< FCommand* >& fused = cmd->FusedCommands();
+            for( uint64 j = 0; j < fused.Size(); ++j )
+                WaitForHazards( fused[j], cmd, numTracked );
+        }
+    }
+
+    for( uint64 i = 0; i < size; ++i ) {
+        FCommand* cmd = iList->Command( i );
+        if( bHazardTracking ) {
+            TrackAccesses( cmd );
+            const TArray< FCommand* >& fused = cmd->FusedCommands();
+            for( uint64 j = 0; j < fused.Size(); ++j )
+                TrackAccesses( fused[j] );
+        }
+
+        cmd->Event()->SetCompletionCounter( mCompletion );
+        Enqueue( cmd );
+    }
+
+    // The event of the submission completes with the whole list. The no-op
+    // is queued directly, it is not a barrier for hazard tracking.
+    if( iEvent ) {
+        FCommand* done = new FCommand( &ScheduleNo_OP, new FNo_OPCommandArgs(), FSchedulePolicy(), true, true, 0, nullptr, iEvent, FRectI() );
+        done->SetName( "Submit" );
+        FSharedInternalEvent evt = done->Event();
+        evt->NotifyQueued();
+        done->SetPriority( mPriority );
+        for( uint64 i = 0; i < size; ++i )
+            evt->AddImplicitWait( iList->Command( i )->Event() );
+        evt->SetCompletionCounter( mCompletion );
+        Enqueue( done );
+    }
+}
+
+FCommand*
+FCommandQueue_Private::FusionLeader( const FCommand* iCommand ) const
+{
+    if( !mFusionLeader || !iCommand->PointWise() )
+        return  nullptr;
+
+    FCommandAccess leader[ ICommandArgs::MaxAccesses ];
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const uint32 numLeader = mFusionLeader->Args()->Accesses( leader );
+    const uint32 numAccesses = iCommand->Args()->Accesses( accesses );
+    if(    numLeader == 0
+        || numAccesses == 0
+        || !leader[0].write
+        || !accesses[0].write
+        || leader[0].block != accesses[0].block
+        || leader[0].rect != accesses[0].rect
+    )
+        return  nullptr;
+
+    // The destination is the only write of the chain, it can be read back
+    // as long as each pixel only reads itself.
+    for( uint32 j = 1; j < numAccesses; ++j )
+        if( accesses[j].write || ( accesses[j].block == accesses[0].block && accesses[j].rect != accesses[0].rect ) )
+            return  nullptr;
+
+    return  mFusionLeader;
+}
+
+void
+FCommandQueue_Private::TrackHazards( const FCommand* iCommand, FCommand* iLeader )
+{
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const uint32 numAccesses = iCommand->Args()->Accesses( accesses );
+    FSharedInternalEvent evt = iCommand->Event();
+
+    PruneTrackedAccesses();
+    WaitForHazards( iCommand, iLeader, mTrackedAccesses.Size() );
+
+    // Unknown accesses, the command is a barrier for all the next ones.
+    if( numAccesses == 0 ) {
+        mTrackedAccesses.Clear();
+        mTrackedAccesses.PushBack( { nullptr, FRectI(), true, evt } );
+        return;
+    }
+
+    // Accesses fully covered by a write of this command are now ordered
+    // before it, anything that conflicts with them conflicts with the write.
+    for( uint32 j = 0; j < numAccesses; ++j ) {
+        if( !accesses[j].write )
+            continue;
+
+        for( uint64 i = mTrackedAccesses.Size(); i > 0; --i ) {
+            const FTrackedAccess& tracked = mTrackedAccesses[ i - 1 ];
+            if( tracked.block == accesses[j].block && ( tracked.rect & accesses[j].rect ) == tracked.rect )
+                mTrackedAccesses.Erase( i - 1 );
+        }
+    }
+
+    for( uint32 j = 0; j < numAccesses; ++j )
+        mTrackedAccesses.PushBack( { accesses[j].block, accesses[j].rect, accesses[j].write, evt } );
+}
+
+void
+FCommandQueue_Private::PruneTrackedAccesses()
+{
+    // Forget about completed commands.
+    for( uint64 i = mTrackedAccesses.Size(); i > 0; --i )
+        if( mTrackedAccesses[ i - 1 ].event->IsDone() )
+            mTrackedAccesses.Erase( i - 1 );
+}
+
+void
+FCommandQueue_Private::WaitForHazards( const FCommand* iCommand, FCommand* iLeader, uint64 iNumTracked )
+{
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const uint32 numAccesses = iCommand->Args()->Accesses( accesses );
+    FSharedInternalEvent waiter = iLeader ? iLeader->Event() : iCommand->Event();
+
+    // Wait for conflicting commands: read after write, write after read and
+    // write after write on overlapping regions of the same block. Accesses of
+    // a command are contiguous, so that a command is only waited once.
+    const FInternalEvent* last = nullptr;
+    for( uint64 i = 0; i < iNumTracked; ++i )
+    {
+        const FTrackedAccess& tracked = mTrackedAccesses[i];
+        if( tracked.event.get() == last || ( iLeader && iLeader->FusedWith( tracked.event.get() ) ) )
+            continue;
+
+        bool hazard = numAccesses == 0 || tracked.block == nullptr;
+        for( uint32 j = 0; j < numAccesses && !hazard; ++j )
+            hazard =   accesses[j].block == tracked.block
+                    && ( accesses[j].write || tracked.write )
+                    && ( accesses[j].rect & tracked.rect ).Area() > 0;
+
+        if( hazard ) {
+            waiter->AddImplicitWait( tracked.event );
+            last = tracked.event.get();
+        }
+    }
+}
+
+void
+FCommandQueue_Private::TrackAccesses( const FCommand* iCommand )
+{
+    // Unlike TrackHazards(), nothing is assumed about the order of iCommand,
+    // the accesses it covers are kept.
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const uint32 numAccesses = iCommand->Args()->Accesses( accesses );
+    if( numAccesses == 0 )
+        mTrackedAccesses.PushBack( { nullptr, FRectI(), true, iCommand->Event() } );
+
+    for( uint32 j = 0; j < numAccesses; ++j )
+        mTrackedAccesses.PushBack( { accesses[j].block, accesses[j].rect, accesses[j].write, iCommand->Event() } );
 }
 
 ULIS_NAMESPACE_END
@@ -11,17 +11,47 @@
 */
 #pragma once
 #include "Core/Core.h"
+#include "Memory/Array.h"
 #include "Memory/Queue.h"
 #include "Scheduling/CommandQueue.h"
 #include "Scheduling/Command.h"
+#include "Scheduling/CompletionCounter.h"
+#include <atomic>
+#include <mutex>
 
 ULIS_NAMESPACE_BEGIN
+class FCommandList_Private;
+
 /////////////////////////////////////////////////////
 /// @class      FCommandQueue_Private
 /// @brief      The FCommandQueue_Private class provides a way to enqueue tasks for being
 ///             processed asynchronously in coordination with a FThreadPool
-/// @details    The FCommandQueue_Private stores a TQueue of FCommand and schedules the
-///             commands on the FThreadPool.
+/// @details    The FCommandQueue_Private stores the pushed FCommand in an
+///             intrusive list and schedules the commands on the FThreadPool.
+///
+///             Pushed commands are linked from the last one to the first,
+///             through FCommand::NextPushed(), and mPushed points to the last
+///             one. Any thread can push a command with a compare and swap on
+///             mPushed, without lock, the order of the pushes of each thread
+///             is kept. Flush() takes the whole list with a single exchange,
+///             reverses it, and hands it to the pool as one batch.
+///
+///             Hazard tracking, fusion and recording depend on the commands
+///             pushed before, their state is guarded by mTrackingMutex. When
+///             either is enabled pushes go through that lock instead, it is
+///             also taken by Flush() to cut the fusion chain.
+///
+///             With a memory budget, Push() reserves the footprint of the
+///             command in mCompletion before it takes any lock, so that it
+///             can flush the queue and wait there. The event of the command
+///             gives the footprint back when it finishes, a fused command
+///             adds its footprint to the event of its leader.
+///
+///             Commands that run inline, see FCommand::RunsInline(), are run
+///             by Flush() on the calling thread when their dependencies are
+///             already finished. bInlineCandidates tells whether the queue
+///             holds any, so that other flushes submit the whole queue at
+///             once.
 ///
 ///             \sa FCommand
 ///             \sa FThreadPool
@@ -29,12 +59,23 @@ class FCommandQueue_Private
 {
     typedef TQueue< const FCommand* > tQueue;
 
+    /*!
+        An access of a pushed command that may still be running.
+        A null block stands for a command with unknown accesses.
+    */
+    struct FTrackedAccess {
+        const FBlock* block;
+        FRectI rect;
+        bool write;
+        FSharedInternalEvent event;
+    };
+
 public:
     /*! Destructor */
     ~FCommandQueue_Private();
 
     /*! Constructor */
-    FCommandQueue_Private( FThreadPool& iPool );
+    FCommandQueue_Private( FThreadPool& iPool, eCommandQueuePriority iPriority );
 
     /*!
         Issue all commands and return immediately.
@@ -53,12 +94,118 @@ public:
 
     /*!
         Push, insert a new command at the end of the queue.
+        iName is the name of the operation, a string literal, for traces.
+    */
+    void Push( const FCommand* iCommand, const char* iName );
+
+    /*!
+        Enable or disable the automatic hazard tracking.
+    */
+    void SetHazardTracking( bool iEnable );
+
+    /*!
+        Check whether the automatic hazard tracking is enabled.
+    */
+    bool HazardTracking() const;
+
+    /*!
+        Enable or disable the fusion of point-wise commands.
+    */
+    void SetCommandFusion( bool iEnable );
+
+    /*!
+        Check whether the fusion of point-wise commands is enabled.
+    */
+    bool CommandFusion() const;
+
+    /*!
+        Get the priority class of the queue.
+    */
+    eCommandQueuePriority Priority() const;
+
+    /*!
+        Set the memory budget of the commands in flight, zero disables it.
+    */
+    void SetMemoryBudget( uint64 iBytes );
+
+    /*!
+        Get the memory budget of the commands in flight.
+    */
+    uint64 MemoryBudget() const;
+
+    /*!
+        Get the footprint of the commands in flight.
+    */
+    uint64 MemoryInFlight() const;
+
+    /*!
+        Start recording the pushed commands in iList.
+    */
+    void BeginRecording( FCommandList_Private* iList );
+
+    /*!
+        Stop recording, and build the jobs of the recorded commands.
+    */
+    void EndRecording();
+
+    /*!
+        Check whether the queue is recording.
+    */
+    bool Recording() const;
+
+    /*!
+        Queue the recorded commands of iList again.
+    */
+    void Submit( FCommandList_Private* iList, uint32 iNumWait, const FEvent* iWaitList, FEvent* iEvent );
+
+private:
+    /*!
+        Make iCommand wait for the tracked commands it conflicts with, then
+        track its own accesses. If iCommand is fused in the chain of
+        iLeader, the chain waits instead.
+    */
+    void TrackHazards( const FCommand* iCommand, FCommand* iLeader );
+
+    /*!
+        Forget about the tracked accesses of completed commands.
+    */
+    void PruneTrackedAccesses();
+
+    /*!
+        Append iCommand to the pushed list, from any thread.
+    */
+    void Enqueue( const FCommand* iCommand );
+
+    /*!
+        Make iCommand, or the chain of iLeader, wait for the first
+        iNumTracked tracked accesses it conflicts with.
+    */
+    void WaitForHazards( const FCommand* iCommand, FCommand* iLeader, uint64 iNumTracked );
+
+    /*!
+        Track the accesses of iCommand, without dropping any other.
+    */
+    void TrackAccesses( const FCommand* iCommand );
+
+    /*!
+        Get the pending command iCommand can be fused with, if any.
     */
-    void Push( const FCommand* iCommand );
+    FCommand* FusionLeader( const FCommand* iCommand ) const;
 
 private:
     FThreadPool& mPool;
-    tQueue mQueue;
+    eCommandQueuePriority mPriority;
+    FSharedCompletionCounter mCompletion;
+    std::atomic< const FCommand* > mPushed;
+    bool bHazardTracking;
+    TArray< FTrackedAccess > mTrackedAccesses;
+    bool bCommandFusion;
+    FCommand* mFusionLeader;
+    FCommandList_Private* mRecording;
+    TArray< FTrackedAccess > mStashedAccesses;
+    std::atomic_bool bInlineCandidates;
+    std::atomic_uint64_t mMemoryBudget;
+    std::mutex mTrackingMutex;
 };
 
 ULIS_NAMESPACE_END
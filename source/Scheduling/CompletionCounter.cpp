@@ -0,0 +1,91 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CompletionCounter.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FCompletionCounter class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/CompletionCounter.h"
+#include "Scheduling/SchedulingTrace_Private.h"
+#include <thread>
+
+ULIS_NAMESPACE_BEGIN
+FCompletionCounter::FCompletionCounter()
+    : mNumPending( 0 )
+    , mFootprint( 0 )
+{
+}
+
+void
+FCompletionCounter::Add( uint32 iNum )
+{
+    mNumPending.fetch_add( iNum );
+}
+
+void
+FCompletionCounter::Release( uint64 iFootprint )
+{
+    // The mutex is taken so that the notification cannot slip between the
+    // predicate check and the wait in Wait() or Reserve().
+    if( iFootprint )
+        mFootprint.fetch_sub( iFootprint );
+    if( --mNumPending == 0 || iFootprint ) {
+        std::lock_guard< std::mutex > lock( mMutex );
+        cvDone.notify_all();
+    }
+}
+
+void
+FCompletionCounter::Wait( uint32 iSpinCount ) const
+{
+    for( uint32 i = 0; i < iSpinCount; ++i ) {
+        if( mNumPending == 0 )
+            return;
+        std::this_thread::yield();
+    }
+
+    const uint64 start = FSchedulingTrace_Private::Enabled() ? FSchedulingTrace_Private::Now() : 0;
+    std::unique_lock< std::mutex > lock( mMutex );
+    cvDone.wait( lock, [ this ](){ return mNumPending == 0; } );
+    lock.unlock();
+    if( start )
+        FSchedulingTrace_Private::RecordWait( "FCommandQueue::Fence", start, FSchedulingTrace_Private::Now() );
+}
+
+bool
+FCompletionCounter::TryReserve( uint64 iFootprint, uint64 iBudget )
+{
+    uint64 footprint = mFootprint.load();
+    do {
+        if( footprint != 0 && footprint + iFootprint > iBudget )
+            return  false;
+    } while( !mFootprint.compare_exchange_weak( footprint, footprint + iFootprint ) );
+    return  true;
+}
+
+void
+FCompletionCounter::Reserve( uint64 iFootprint, uint64 iBudget )
+{
+    if( TryReserve( iFootprint, iBudget ) )
+        return;
+
+    const uint64 start = FSchedulingTrace_Private::Enabled() ? FSchedulingTrace_Private::Now() : 0;
+    std::unique_lock< std::mutex > lock( mMutex );
+    cvDone.wait( lock, [ this, iFootprint, iBudget ](){ return TryReserve( iFootprint, iBudget ); } );
+    lock.unlock();
+    if( start )
+        FSchedulingTrace_Private::RecordWait( "FCommandQueue::Push", start, FSchedulingTrace_Private::Now() );
+}
+
+uint64
+FCompletionCounter::Footprint() const
+{
+    return  mFootprint;
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,79 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CompletionCounter.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FCompletionCounter class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+ULIS_NAMESPACE_BEGIN
+class FCompletionCounter;
+typedef std::shared_ptr< FCompletionCounter > FSharedCompletionCounter;
+
+/////////////////////////////////////////////////////
+/// @class      FCompletionCounter
+/// @brief      The FCompletionCounter class counts the commands of a
+///             FCommandQueue that are issued and not finished yet.
+/// @details    The queue adds the commands it flushes, and the event of
+///             each of these commands releases one when it finishes, after
+///             its callback and the events of its fused commands. Events hold
+///             a shared reference on the counter, so that the queue can be
+///             destroyed before its commands finish.
+///
+///             Wait() parks until the count drops to zero, after an optional
+///             bounded spin.
+///
+///             The counter also sums the memory footprint of the commands of
+///             the queue that are pushed and not finished yet, for its memory
+///             budget. Reserve() parks until a footprint fits in the budget,
+///             or until nothing else is in flight, so that a command larger
+///             than the budget still runs, alone.
+///
+///             \sa FCommandQueue
+///             \sa FInternalEvent
+class FCompletionCounter
+{
+public:
+    /*! Constructor */
+    FCompletionCounter();
+
+    /*! Count iNum more pending commands. */
+    void Add( uint32 iNum );
+
+    /*!
+        Release one pending command and its footprint, wake up the waiters
+        on the last one, or on any footprint.
+    */
+    void Release( uint64 iFootprint = 0 );
+
+    /*! Wait until there is no pending command left. */
+    void Wait( uint32 iSpinCount = 0 ) const;
+
+    /*! Reserve iFootprint bytes if they fit in iBudget, without waiting. */
+    bool TryReserve( uint64 iFootprint, uint64 iBudget );
+
+    /*! Wait until iFootprint bytes fit in iBudget, and reserve them. */
+    void Reserve( uint64 iFootprint, uint64 iBudget );
+
+    /*! Get the footprint of the commands in flight. */
+    uint64 Footprint() const;
+
+private:
+    std::atomic_uint32_t mNumPending;
+    std::atomic_uint64_t mFootprint;
+    mutable std::mutex mMutex;
+    mutable std::condition_variable cvDone;
+};
+
+ULIS_NAMESPACE_END
+
@@ -13,10 +13,26 @@
 #include "Core/Core.h"
 #include "Scheduling/SpecializationCondition.h"
 #include "Scheduling/Command.h"
+#include "Scheduling/CommandMetrics.h"
 #include "Scheduling/Job.h"
 #include "System/CPUInfo/CPUInfo.h"
 
 ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+// QueryDispatchPath
+// The instruction set TDispatcher selects for iPerfIntent on this host.
+static ULIS_FORCEINLINE eDispatchPath QueryDispatchPath( ePerformanceIntent iPerfIntent ) {
+    #ifdef ULIS_COMPILETIME_AVX_SUPPORT
+        if( FCPUInfo::HasHardwareAVX2() && bool( iPerfIntent & ePerformanceIntent::PerformanceIntent_AVX ) )
+            return  DispatchPath_AVX;
+    #endif
+    #ifdef ULIS_COMPILETIME_SSE_SUPPORT
+        if( FCPUInfo::HasHardwareSSE42() && bool( iPerfIntent & ePerformanceIntent::PerformanceIntent_SSE ) )
+            return  DispatchPath_SSE;
+    #endif
+    return  DispatchPath_MEM;
+}
+
 /////////////////////////////////////////////////////
 // TDispatcher
 template< typename IMP >
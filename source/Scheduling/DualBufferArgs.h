@@ -40,6 +40,12 @@ public:
         , srcRect( iSrcRect )
     {}
 
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        FSimpleBufferCommandArgs::Accesses( oAccesses );
+        oAccesses[1] = { &src, srcRect, false };
+        return  2;
+    }
+
     const FBlock& src;
     const FRectI srcRect;
 };
@@ -60,6 +66,7 @@ public:
     uint8* ULIS_RESTRICT dst;
     int64 size;
     uint32 line;
+    uint32 x; // First pixel of the span in dstRect, for tiles.
 };
 
 /////////////////////////////////////////////////////
@@ -85,6 +92,7 @@ BuildDualBufferJob_Scanlines(
     oJargs.dst                              = dst + ( iCargs->dstRect.y + iIndex ) * dst_bps;
     oJargs.size                             = size;
     oJargs.line                             = static_cast< uint32 >( iIndex );
+    oJargs.x                                = 0;
 }
 
 static
@@ -101,10 +109,34 @@ BuildDualBufferJob_Chunks(
     const uint8* const ULIS_RESTRICT src    = iCargs->src.Bits();
     uint8* const ULIS_RESTRICT dst          = iCargs->dst.Bits();
     const int64 btt                         = static_cast< int64 >( iCargs->src.BytesTotal() );
-    oJargs.src                              = src + iIndex;
-    oJargs.dst                              = dst + iIndex;
+    oJargs.src                              = src + iOffset;
+    oJargs.dst                              = dst + iOffset;
     oJargs.size                             = FMath::Min( iOffset + iSize, btt ) - iOffset;
     oJargs.line                             = ULIS_UINT16_MAX; // N/A for chunks
+    oJargs.x                                = 0;
+}
+
+static
+void
+BuildDualBufferJob_Tiles(
+      const FDualBufferCommandArgs* iCargs
+    , const int64 iX
+    , const int64 iWidth
+    , const int64 iLine
+    , FDualBufferJobArgs& oJargs
+)
+{
+    const FFormatMetrics& src_fmt           = iCargs->src.FormatMetrics();
+    const FFormatMetrics& dst_fmt           = iCargs->dst.FormatMetrics();
+    const uint8* const ULIS_RESTRICT src    = iCargs->src.Bits() + static_cast< uint64 >( iCargs->srcRect.x + iX ) * src_fmt.BPP;
+    uint8* const ULIS_RESTRICT dst          = iCargs->dst.Bits() + static_cast< uint64 >( iCargs->dstRect.x + iX ) * dst_fmt.BPP;
+    const int64 src_bps                     = static_cast< int64 >( iCargs->src.BytesPerScanLine() );
+    const int64 dst_bps                     = static_cast< int64 >( iCargs->dst.BytesPerScanLine() );
+    oJargs.src                              = src + ( iCargs->srcRect.y + iLine ) * src_bps;
+    oJargs.dst                              = dst + ( iCargs->dstRect.y + iLine ) * dst_bps;
+    oJargs.size                             = iWidth * src_fmt.BPP;
+    oJargs.line                             = static_cast< uint32 >( iLine );
+    oJargs.x                                = static_cast< uint32 >( iX );
 }
 
 template<
@@ -116,6 +148,7 @@ template<
         )
     , typename TDelegateBuildJobScanlines
     , typename TDelegateBuildJobChunks
+    , typename TDelegateBuildJobTiles = std::nullptr_t
 >
 void
 ScheduleDualBufferJobs(
@@ -125,9 +158,10 @@ ScheduleDualBufferJobs(
     , bool iForceMonoChunk
     , TDelegateBuildJobScanlines iDelegateBuildJobScanlines
     , TDelegateBuildJobChunks iDelegateBuildJobChunks
+    , TDelegateBuildJobTiles iDelegateBuildJobTiles = nullptr
 )
 {
-    const FDualBufferCommandArgs* cargs = dynamic_cast< const FDualBufferCommandArgs* >( iCommand->Args() );
+    const FDualBufferCommandArgs* cargs = static_cast< const FDualBufferCommandArgs* >( iCommand->Args() );
     RangeBasedSchedulingBuildJobs<
           TJobArgs
         , TCommandArgs
@@ -138,14 +172,15 @@ ScheduleDualBufferJobs(
         , iPolicy
         , static_cast< int64 >( cargs->src.BytesTotal() )
         , cargs->dstRect.h
-        , iContiguous
+        , iContiguous && cargs->src.IsContiguous() && cargs->dst.IsContiguous()
         , iForceMonoChunk
         , iDelegateBuildJobScanlines
         , iDelegateBuildJobChunks
+        , iDelegateBuildJobTiles
     );
 }
 
-#define ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks )    \
+#define ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks, iDelegateBuildJobTiles ) \
 void                                                                                                                                                                    \
 iName(                                                                                                                                                                  \
       FCommand* iCommand                                                                                                                                                \
@@ -166,9 +201,21 @@ iName(
         , iForceMonoChunk                                                                                                                                               \
         , iDelegateBuildJobScanlines                                                                                                                                    \
         , iDelegateBuildJobChunks                                                                                                                                       \
+        , iDelegateBuildJobTiles                                                                                                                                        \
     );                                                                                                                                                                  \
 }
 
+#define ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks )    \
+    ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(                                                                                                            \
+          iName                                                                                                                                                         \
+        , iJobArgs                                                                                                                                                      \
+        , iCommandArgs                                                                                                                                                  \
+        , iDelegateInvocation                                                                                                                                           \
+        , iDelegateBuildJobScanlines                                                                                                                                    \
+        , iDelegateBuildJobChunks                                                                                                                                       \
+        , nullptr                                                                                                                                                       \
+    )
+
 #define ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL( iName, iJobArgs, iCommandArgs, iDelegateInvocation )    \
     ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM(                                                      \
           iName                                                                                             \
@@ -179,6 +226,23 @@ iName(
         , BuildDualBufferJob_Chunks                                                                         \
     )
 
+#define ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( iName, iJobArgs, iCommandArgs, iDelegateInvocation )  \
+    ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM(                                                    \
+          iName                                                                                                 \
+        , iJobArgs                                                                                              \
+        , iCommandArgs                                                                                          \
+        , iDelegateInvocation                                                                                   \
+        , BuildDualBufferJob_Scanlines                                                                          \
+        , BuildDualBufferJob_Chunks                                                                             \
+        , BuildDualBufferJob_Tiles                                                                              \
+    )
+
+#define ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks, iDelegateBuildJobTiles )     \
+    template< typename T > ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks, iDelegateBuildJobTiles )
+
+#define ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( iName, iJobArgs, iCommandArgs, iDelegateInvocation )      \
+    template< typename T > ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_TILED( iName, iJobArgs, iCommandArgs, iDelegateInvocation )
+
 #define ULIS_DEFINE_GENERIC_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks )            \
     template< typename T > ULIS_DEFINE_COMMAND_SCHEDULER_FORWARD_DUAL_CUSTOM( iName, iJobArgs, iCommandArgs, iDelegateInvocation, iDelegateBuildJobScanlines, iDelegateBuildJobChunks )
 
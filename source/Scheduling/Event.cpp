@@ -51,6 +51,18 @@ FEvent::Wait() const
     d->Wait();
 }
 
+bool
+FEvent::Cancel()
+{
+    return  d->Cancel();
+}
+
+bool
+FEvent::Metrics( FCommandMetrics* oMetrics ) const
+{
+    return  d->Metrics( oMetrics );
+}
+
 //static
 FEvent
 FEvent::NoOP()
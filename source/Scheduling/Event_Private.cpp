@@ -34,5 +34,17 @@ FEvent_Private::Wait() const
     m->Wait();
 }
 
+bool
+FEvent_Private::Cancel()
+{
+    return  m->Cancel();
+}
+
+bool
+FEvent_Private::Metrics( FCommandMetrics* oMetrics ) const
+{
+    return  m->Metrics( oMetrics );
+}
+
 ULIS_NAMESPACE_END
 
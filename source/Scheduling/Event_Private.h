@@ -43,6 +43,8 @@ public:
     FEvent_Private( const FOnEventComplete& iOnEventComplete = FOnEventComplete() );
     eEventStatus Status() const;
     void Wait() const;
+    bool Cancel();
+    bool Metrics( FCommandMetrics* oMetrics ) const;
 
 private:
     FSharedInternalEvent m;
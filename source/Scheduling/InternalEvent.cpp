@@ -10,9 +10,15 @@
 * @license      Please refer to LICENSE.md
 */
 #include "Scheduling/InternalEvent.h"
+#include "Scheduling/SchedulingMemoryPool.h"
 #include "Scheduling/Event.h"
 #include "Scheduling/Event_Private.h"
 #include "Scheduling/Command.h"
+#include "Scheduling/SchedulingTrace_Private.h"
+#include "Scheduling/ScheduleArgs.h"
+#include "Image/Block.h"
+#include "System/ThreadPool/ThreadPool_Private.h"
+#include <thread>
 
 ULIS_NAMESPACE_BEGIN
 FInternalEvent::~FInternalEvent()
@@ -23,11 +29,28 @@ FInternalEvent::FInternalEvent(
     const FOnEventComplete& iOnEventComplete
 )
     : mWaitList( TArray< FSharedInternalEvent >() )
+    , mDependents( TArray< FWeakInternalEvent >() )
+    , mFusedEvents( TArray< FSharedInternalEvent >() )
+    , mFootprint( 0 )
+    , mNumWaitRemaining( 1 )
+    , mPool( nullptr )
     , mCommand( nullptr )
     , mStatus( eEventStatus::EventStatus_Idle )
     , mNumJobsRemaining( UINT64_MAX )
+    , bCancelled( false )
+    , bFused( false )
     , mGeometry( FRectI() )
     , mOnEventComplete( iOnEventComplete )
+    , mTraceName( nullptr )
+    , mTraceId( 0 )
+    , mQueuedTime( 0 )
+    , mScheduledTime( 0 )
+    , mReadyTime( 0 )
+    , bMetrics( false )
+    , mMetricsTable( nullptr )
+    , mCpuTime( 0 )
+    , mNumJobsRun( 0 )
+    , mMetrics( FCommandMetrics { 0, 0, 0, 0, 0, 0, DispatchPath_MEM } )
 {
 }
 
@@ -37,15 +60,27 @@ FInternalEvent::MakeShared(
     const FOnEventComplete& iOnEventComplete
 )
 {
-    return  std::make_shared< FInternalEvent >( iOnEventComplete );
+    return  std::allocate_shared< FInternalEvent >( TSchedulingAllocator< FInternalEvent >(), iOnEventComplete );
 }
 
 void
 FInternalEvent::BuildWaitList( uint32 iNumWait, const FEvent* iWaitList )
 {
+    // mNumWaitRemaining starts at one, this extra count is released on
+    // Submit, so that the command cannot be considered ready before it is
+    // actually flushed to a pool. It is incremented before registration in
+    // order not to reach zero early if a dependency finishes meanwhile.
+    FSharedInternalEvent self = shared_from_this();
     mWaitList.Reserve( iNumWait );
-    for( uint32 i = 0; i < iNumWait; ++i )
+    for( uint32 i = 0; i < iNumWait; ++i ) {
         mWaitList.PushBack( iWaitList[i].d->m );
+        ++mNumWaitRemaining;
+        if( !( mWaitList.Back()->AddDependent( self ) ) ) {
+            --mNumWaitRemaining;
+            if( mWaitList.Back()->Status() == eEventStatus::EventStatus_Cancelled )
+                bCancelled = true;
+        }
+    }
 
 #ifdef ULIS_ASSERT_ENABLED
     CheckCyclicSelfReference();
@@ -62,7 +97,7 @@ bool
 FInternalEvent::ReadyForProcessing() const
 {
     for( uint32 i = 0; i < mWaitList.Size(); ++i )
-        if( mWaitList[i]->Status() != eEventStatus::EventStatus_Finished )
+        if( !mWaitList[i]->IsDone() )
             return  false;
 
     return  true;
@@ -107,6 +142,13 @@ FInternalEvent::Status() const
     return  mStatus;
 }
 
+bool
+FInternalEvent::IsDone() const
+{
+    const eEventStatus status = mStatus;
+    return  status == eEventStatus::EventStatus_Finished || status == eEventStatus::EventStatus_Cancelled;
+}
+
 void
 FInternalEvent::Bind( FCommand* iCommand, uint32 iNumWait, const FEvent* iWaitList, const FRectI& iGeometry )
 {
@@ -117,6 +159,45 @@ FInternalEvent::Bind( FCommand* iCommand, uint32 iNumWait, const FEvent* iWaitLi
     mGeometry = iGeometry;
 }
 
+void
+FInternalEvent::AddImplicitWait( const FSharedInternalEvent& iEvent )
+{
+    // Only valid until the event is submitted, while the submit guard holds
+    // mNumWaitRemaining above zero. Unlike the wait list, no reference is
+    // kept on iEvent, so that long chains of implicit dependencies do not
+    // keep every finished event alive.
+    ++mNumWaitRemaining;
+    if( !( iEvent->AddDependent( shared_from_this() ) ) )
+        --mNumWaitRemaining;
+}
+
+const TArray< FSharedInternalEvent >&
+FInternalEvent::WaitList() const
+{
+    return  mWaitList;
+}
+
+void
+FInternalEvent::AddFusedEvent( const FSharedInternalEvent& iEvent )
+{
+    // The command of iEvent runs as part of the command of this event.
+    iEvent->bFused = true;
+    mFusedEvents.PushBack( iEvent );
+}
+
+void
+FInternalEvent::SetCompletionCounter( const FSharedCompletionCounter& iCounter, uint64 iFootprint )
+{
+    mCompletionCounter = iCounter;
+    mFootprint = iFootprint;
+}
+
+void
+FInternalEvent::AddFootprint( uint64 iFootprint )
+{
+    mFootprint += iFootprint;
+}
+
 void
 FInternalEvent::PostBindAsync()
 {
@@ -126,9 +207,10 @@ FInternalEvent::PostBindAsync()
 bool
 FInternalEvent::NotifyOneJobFinished()
 {
-    --mNumJobsRemaining;
-    if( mNumJobsRemaining == 0 ) {
-        delete  mCommand;
+    // Workers may notify concurrently, only the last one sees zero.
+    if( --mNumJobsRemaining == 0 ) {
+        if( !mCommand->Recorded() )
+            delete  mCommand;
         NotifyAllJobsFinished();
         return  true;
     }
@@ -138,22 +220,264 @@ FInternalEvent::NotifyOneJobFinished()
 void
 FInternalEvent::NotifyAllJobsFinished()
 {
-    SetStatus( eEventStatus::EventStatus_Finished );
+    // Metrics are complete before waiters can see the event done.
+    const uint64 now = mQueuedTime ? FSchedulingTrace_Private::Now() : 0;
+    if( bMetrics ) {
+        mMetrics.wallTime = now - mQueuedTime;
+        mMetrics.cpuTime = mCpuTime;
+        mMetrics.numJobs = mNumJobsRun;
+    }
+
+    // The status is decided under the lock, so that Cancel() either
+    // happens before or sees the event done.
+    std::unique_lock< std::mutex > lock( mDependentsMutex );
+    const bool cancelled = bCancelled;
+    SetStatus( cancelled ? eEventStatus::EventStatus_Cancelled : eEventStatus::EventStatus_Finished );
+    TArray< FWeakInternalEvent > dependents( std::move( mDependents ) );
+    lock.unlock();
+    cvFinished.notify_all();
+
     mOnEventComplete.ExecuteIfBound( mGeometry );
+
+    // A command queued before the trace started is not recorded.
+    if( mTraceId && FSchedulingTrace_Private::Enabled() )
+        FSchedulingTrace_Private::RecordCommand( mTraceName, mTraceId, mQueuedTime, mScheduledTime ? mScheduledTime : now, now );
+
+    if( bMetrics && mMetricsTable && !cancelled )
+        mMetricsTable->Add( mTraceName, mMetrics );
+
+    // Commands that wait for a cancelled command explicitly are cancelled
+    // too, the ones that only wait for it because of hazard tracking are not.
+    for( uint64 i = 0; i < dependents.Size(); ++i ) {
+        FSharedInternalEvent dependent = dependents[i].lock();
+        if( !dependent )
+            continue;
+        if( cancelled && dependent->WaitsFor( this ) )
+            dependent->Cancel();
+        dependent->NotifyOneDependencyFinished();
+    }
+
+    // Events of fused commands finish right after, in chain order.
+    TArray< FSharedInternalEvent > fused( std::move( mFusedEvents ) );
+    for( uint64 i = 0; i < fused.Size(); ++i ) {
+        fused[i]->bCancelled = cancelled;
+        fused[i]->mScheduledTime = mScheduledTime;
+        fused[i]->NotifyAllJobsFinished();
+    }
+
+    // Last, the whole chain is done.
+    if( mCompletionCounter )
+        mCompletionCounter->Release( mFootprint );
+}
+
+bool
+FInternalEvent::AddDependent( const FSharedInternalEvent& iEvent )
+{
+    std::lock_guard< std::mutex > lock( mDependentsMutex );
+    if( IsDone() )
+        return  false;
+
+    mDependents.PushBack( iEvent );
+    return  true;
+}
+
+void
+FInternalEvent::Dependents( TArray< FSharedInternalEvent >* oDependents ) const
+{
+    std::lock_guard< std::mutex > lock( mDependentsMutex );
+    for( uint64 i = 0; i < mDependents.Size(); ++i ) {
+        FSharedInternalEvent dependent = mDependents[i].lock();
+        if( dependent )
+            oDependents->PushBack( dependent );
+    }
+}
+
+void
+FInternalEvent::NotifyOneDependencyFinished()
+{
+    if( --mNumWaitRemaining == 0 )
+        mPool.load()->ScheduleReadyCommand( mCommand );
+}
+
+void
+FInternalEvent::Submit( FThreadPool_Private* iPool )
+{
+    ULIS_ASSERT( IsBound(), "Cannot submit an event that is not bound to a command" );
+    mPool = iPool;
+    NotifyOneDependencyFinished();
+}
+
+bool
+FInternalEvent::SubmitInline( FThreadPool_Private* iPool )
+{
+    // Only the submission is left when all dependencies are finished, the
+    // caller then runs the command instead of the pool. Otherwise nothing
+    // changes, the command is submitted later on.
+    ULIS_ASSERT( IsBound(), "Cannot submit an event that is not bound to a command" );
+    mPool = iPool;
+    uint32 expected = 1;
+    return  mNumWaitRemaining.compare_exchange_strong( expected, 0 );
+}
+
+FThreadPool_Private*
+FInternalEvent::Pool() const
+{
+    return  mPool;
 }
 
 void
 FInternalEvent::NotifyQueued()
 {
     SetStatus( eEventStatus::EventStatus_Queued );
+    const bool trace = FSchedulingTrace_Private::Enabled();
+    if( !trace && !bMetrics )
+        return;
+
+    mTraceName = mCommand->Name();
+    mQueuedTime = FSchedulingTrace_Private::Now();
+    if( trace )
+        mTraceId = FSchedulingTrace_Private::NewId();
+
+    // Sizes of the regions declared for hazard tracking.
+    if( bMetrics ) {
+        FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+        const uint32 numAccesses = mCommand->Args()->Accesses( accesses );
+        for( uint32 i = 0; i < numAccesses; ++i ) {
+            const uint64 area = static_cast< uint64 >( accesses[i].rect.Area() );
+            const uint64 bytes = area * accesses[i].block->BytesPerPixel();
+            if( accesses[i].write ) {
+                mMetrics.bytesWritten += bytes;
+                mMetrics.pixels += area;
+            } else {
+                mMetrics.bytesRead += bytes;
+            }
+        }
+    }
+}
+
+void
+FInternalEvent::NotifyScheduled()
+{
+    if( mQueuedTime )
+        mScheduledTime = FSchedulingTrace_Private::Now();
+}
+
+void
+FInternalEvent::NotifyReady( uint64 iTime )
+{
+    mReadyTime.store( iTime, std::memory_order_relaxed );
+}
+
+uint64
+FInternalEvent::TakeReadyTime()
+{
+    // Only the first job to start gets it, the others only read a zero.
+    if( mReadyTime.load( std::memory_order_relaxed ) == 0 )
+        return  0;
+    return  mReadyTime.exchange( 0, std::memory_order_relaxed );
+}
+
+uint64
+FInternalEvent::TraceId() const
+{
+    return  mTraceId;
+}
+
+void
+FInternalEvent::CollectMetrics( const FSharedMetricsTable& iTable, eDispatchPath iDispatchPath )
+{
+    bMetrics = true;
+    mMetricsTable = iTable;
+    mMetrics.dispatchPath = iDispatchPath;
+}
+
+void
+FInternalEvent::InheritMetrics( const FInternalEvent& iEvent )
+{
+    if( iEvent.bMetrics )
+        CollectMetrics( iEvent.mMetricsTable, iEvent.mMetrics.dispatchPath );
+}
+
+bool
+FInternalEvent::CollectsMetrics() const
+{
+    return  bMetrics;
+}
+
+void
+FInternalEvent::AddJobTime( uint64 iTime )
+{
+    mCpuTime.fetch_add( iTime, std::memory_order_relaxed );
+    mNumJobsRun.fetch_add( 1, std::memory_order_relaxed );
+}
+
+bool
+FInternalEvent::Metrics( FCommandMetrics* oMetrics ) const
+{
+    if( !bMetrics || !IsDone() )
+        return  false;
+
+    *oMetrics = mMetrics;
+    return  true;
 }
 
 void
 FInternalEvent::Wait() const
 {
-    while( mStatus != eEventStatus::EventStatus_Finished )
-    {
+    // Optional bounded spin, for short waits where parking the thread would
+    // cost more than the wait itself.
+    FThreadPool_Private* pool = mPool;
+    const uint32 spin = pool ? pool->WaitSpinCount() : 0;
+    for( uint32 i = 0; i < spin; ++i ) {
+        if( IsDone() )
+            return;
+        std::this_thread::yield();
     }
+
+    // Then park until notified by NotifyAllJobsFinished.
+    const uint64 start = FSchedulingTrace_Private::Enabled() ? FSchedulingTrace_Private::Now() : 0;
+    std::unique_lock< std::mutex > lock( mDependentsMutex );
+    cvFinished.wait( lock, [ this ](){ return IsDone(); } );
+    lock.unlock();
+    if( start )
+        FSchedulingTrace_Private::RecordWait( "FEvent::Wait", start, FSchedulingTrace_Private::Now() );
+}
+
+bool
+FInternalEvent::Cancel()
+{
+    // Commands of a fused chain run as one, with the first command.
+    std::lock_guard< std::mutex > lock( mDependentsMutex );
+    if( bFused || IsDone() )
+        return  false;
+
+    bCancelled = true;
+    return  true;
+}
+
+bool
+FInternalEvent::CancelRequested() const
+{
+    return  bCancelled;
+}
+
+void
+FInternalEvent::Discard()
+{
+    // Finish without running any job.
+    if( !mCommand->Recorded() )
+        delete  mCommand;
+    NotifyAllJobsFinished();
+}
+
+bool
+FInternalEvent::WaitsFor( const FInternalEvent* iEvent ) const
+{
+    for( uint64 i = 0; i < mWaitList.Size(); ++i )
+        if( mWaitList[i].get() == iEvent )
+            return  true;
+
+    return  false;
 }
 
 ULIS_NAMESPACE_END
@@ -14,13 +14,20 @@
 #include "Core/Callback.h"
 #include "Memory/Array.h"
 #include "Scheduling/Event.h"
+#include "Scheduling/CompletionCounter.h"
+#include "Scheduling/MetricsTable.h"
 #include "Math/Geometry/Rectangle.h"
 #include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 ULIS_NAMESPACE_BEGIN
 class FInternalEvent;
 class FCommand;
+class FThreadPool_Private;
 typedef std::shared_ptr< FInternalEvent > FSharedInternalEvent;
+typedef std::weak_ptr< FInternalEvent > FWeakInternalEvent;
 
 /////////////////////////////////////////////////////
 /// @class      FInternalEvent
@@ -33,12 +40,40 @@ typedef std::shared_ptr< FInternalEvent > FSharedInternalEvent;
 ///             in conjunction with FThreadPool, FSchedulePolicy, FCommandQueue
 ///             and FContext.
 ///
+///             Dependencies are resolved by notification rather than polling:
+///             when bound, the event registers itself as a dependent of each
+///             unfinished event in its wait list, and counts them. When an
+///             event finishes, it notifies its dependents, and the one whose
+///             count drops to zero hands its command to the pool it was
+///             submitted to.
+///
+///             The event of a flushed command also releases the
+///             FCompletionCounter of its FCommandQueue when it finishes, so
+///             that the queue can wait for its own commands only, along with
+///             the memory footprint the queue reserved for the command.
+///
+///             Cancellation only raises bCancelled: the pool drops the jobs
+///             of a cancelled command when it pops them, instead of
+///             searching them in the queues of the workers, and drops the
+///             command itself with Discard() if it is not scheduled yet.
+///
+///             While the FSchedulingTrace runs, the event keeps the times its
+///             command is queued and scheduled, and records its lifetime
+///             when it finishes. The name of the command is kept as well,
+///             since the command may be deleted before.
+///
+///             When its FContext collects metrics, the event also sums the
+///             execution time of the jobs of its command, and fills its
+///             FCommandMetrics right before it finishes, so that they are
+///             complete as soon as waiters see the event done.
+///
 ///             \sa FContext
 ///             \sa FSchedulePolicy
 ///             \sa FThreadPool
 ///             \sa FCPUInfo
 ///             \sa FCommandQueue
 class FInternalEvent
+    : public std::enable_shared_from_this< FInternalEvent >
 {
     friend class FEvent;
 
@@ -56,25 +91,70 @@ public:
     bool ReadyForScheduling() const;
     void CheckCyclicSelfReference() const;
     eEventStatus Status() const;
+    bool IsDone() const;
     void Bind( FCommand* iCommand, uint32 iNumWait, const FEvent* iWaitList, const FRectI& iGeometry );
+    void AddImplicitWait( const FSharedInternalEvent& iEvent );
+    const TArray< FSharedInternalEvent >& WaitList() const;
+    void Dependents( TArray< FSharedInternalEvent >* oDependents ) const;
+    void AddFusedEvent( const FSharedInternalEvent& iEvent );
+    void SetCompletionCounter( const FSharedCompletionCounter& iCounter, uint64 iFootprint = 0 );
+    void AddFootprint( uint64 iFootprint );
     void PostBindAsync();
     bool NotifyOneJobFinished();
     void NotifyAllJobsFinished();
     void NotifyQueued();
+    void NotifyScheduled();
+    void NotifyReady( uint64 iTime );
+    uint64 TakeReadyTime();
+    uint64 TraceId() const;
+    void CollectMetrics( const FSharedMetricsTable& iTable, eDispatchPath iDispatchPath );
+    void InheritMetrics( const FInternalEvent& iEvent );
+    bool CollectsMetrics() const;
+    void AddJobTime( uint64 iTime );
+    bool Metrics( FCommandMetrics* oMetrics ) const;
+    void Submit( FThreadPool_Private* iPool );
+    bool SubmitInline( FThreadPool_Private* iPool );
+    FThreadPool_Private* Pool() const;
     void Wait() const;
+    bool Cancel();
+    bool CancelRequested() const;
+    void Discard();
 
 private:
     void SetStatus( eEventStatus iStatus );
     void BuildWaitList( uint32 iNumWait, const FEvent* iWaitList );
     void CheckCyclicSelfReference_imp( const FInternalEvent* iPin ) const;
+    bool AddDependent( const FSharedInternalEvent& iEvent );
+    bool WaitsFor( const FInternalEvent* iEvent ) const;
+    void NotifyOneDependencyFinished();
 
 private:
     TArray< FSharedInternalEvent > mWaitList;
+    TArray< FWeakInternalEvent > mDependents;
+    TArray< FSharedInternalEvent > mFusedEvents;
+    FSharedCompletionCounter mCompletionCounter;
+    uint64 mFootprint;
+    std::atomic_uint32_t mNumWaitRemaining;
+    std::atomic< FThreadPool_Private* > mPool;
+    mutable std::mutex mDependentsMutex;
+    mutable std::condition_variable cvFinished;
     FCommand* mCommand;
     std::atomic< eEventStatus > mStatus;
-    uint64 mNumJobsRemaining;
+    std::atomic_uint64_t mNumJobsRemaining;
+    std::atomic_bool bCancelled;
+    bool bFused;
     FRectI mGeometry;
     FOnEventComplete mOnEventComplete;
+    const char* mTraceName;
+    uint64 mTraceId;
+    uint64 mQueuedTime;
+    uint64 mScheduledTime;
+    std::atomic_uint64_t mReadyTime;
+    bool bMetrics;
+    FSharedMetricsTable mMetricsTable;
+    std::atomic_uint64_t mCpuTime;
+    std::atomic_uint64_t mNumJobsRun;
+    FCommandMetrics mMetrics;
 };
 
 ULIS_NAMESPACE_END
@@ -15,25 +15,21 @@ ULIS_NAMESPACE_BEGIN
 
 FJob::~FJob()
 {
-    // Cleanup assumes args were allocated as a raw buffer,
-    // and IJobArgs object were constructed in place.
-    // This requires to call the destructors manually,
-    // and delete the buffer through its original type.
-    for( uint32 i = 0; i < mNumTasks; ++i )
-        delete  mArgs[i];
-
-    delete [] mArgs;
+    // Args are owned by the job storage of the parent command.
 }
 
 FJob::FJob(
       uint32 iNumTasks
     , fpTask iTask
-    , IJobArgs** iArgs
+    , const IJobArgs* iArgs
+    , uint32 iArgsStride
     , const FCommand* iParent
 )
     : mNumTasks( iNumTasks )
+    , mArgsStride( iArgsStride )
     , mTask( iTask )
     , mArgs( iArgs )
+    , mCommandArgs( iParent->Args() )
     , mParent( iParent )
 {
 }
@@ -41,8 +37,9 @@ FJob::FJob(
 void
 FJob::Execute() const
 {
+    const uint8* args = reinterpret_cast< const uint8* >( mArgs );
     for( uint32 i = 0; i < mNumTasks; ++i )
-        mTask( mArgs[i], mParent->Args() );
+        mTask( reinterpret_cast< const IJobArgs* >( args + i * static_cast< uint64 >( mArgsStride ) ), mCommandArgs );
 }
 
 const FCommand*
@@ -18,18 +18,17 @@
 
 ULIS_NAMESPACE_BEGIN
 class FJob;
-typedef void (*fpTask)( const IJobArgs*, const ICommandArgs* );
 
 /////////////////////////////////////////////////////
 // ResolveScheduledJobInvocation
+// The task of a job is instanciated with the exact args types its command was
+// built with, the downcasts are static and RTTI is only checked in debug.
 template< typename T, typename U, void (*TDelegateInvoke)( const T*, const U* ) >
 static ULIS_FORCEINLINE void ResolveScheduledJobInvocation( const IJobArgs* iJobArgs, const ICommandArgs* iCommandArgs )
 {
-    const T* job_args = dynamic_cast< const T* >( iJobArgs );
-    const U* cmd_args = dynamic_cast< const U* >( iCommandArgs );
-    ULIS_ASSERT( job_args, "Bad cast" );
-    ULIS_ASSERT( cmd_args, "Bad cast" );
-    TDelegateInvoke( job_args, cmd_args );
+    ULIS_ASSERT( dynamic_cast< const T* >( iJobArgs ), "Bad cast" );
+    ULIS_ASSERT( dynamic_cast< const U* >( iCommandArgs ), "Bad cast" );
+    TDelegateInvoke( static_cast< const T* >( iJobArgs ), static_cast< const U* >( iCommandArgs ) );
 }
 
 /////////////////////////////////////////////////////
@@ -41,6 +40,12 @@ static ULIS_FORCEINLINE void ResolveScheduledJobInvocation( const IJobArgs* iJob
 /// @details    The FJob is used by FCommandQueue and FThreadPool and stores
 ///             information about a job and its parent command which status is
 ///
+///             Jobs and the arguments of their tasks do not own any memory,
+///             they live in the job storage of their parent command. The
+///             arguments of the tasks of a job are contiguous, iArgsStride
+///             bytes apart.
+///
+///             \sa FCommand
 ///             \sa FCommandQueue
 ///             \sa FThreadPool
 class FJob {
@@ -52,7 +57,8 @@ public:
     FJob(
           uint32 iNumTasks
         , fpTask iTask
-        , IJobArgs** iArgs
+        , const IJobArgs* iArgs
+        , uint32 iArgsStride
         , const FCommand* iParent
     );
 
@@ -79,8 +85,10 @@ public:
 
 private:
     uint32 mNumTasks;
+    uint32 mArgsStride;
     fpTask mTask;
-    IJobArgs** mArgs;
+    const IJobArgs* mArgs;
+    const ICommandArgs* mCommandArgs;
     const FCommand* mParent;
 };
 
@@ -0,0 +1,57 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         MetricsTable.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FMetricsTable class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/MetricsTable.h"
+#include <cstring>
+
+ULIS_NAMESPACE_BEGIN
+void
+FMetricsTable::Add( const char* iOperation, const FCommandMetrics& iMetrics )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    FOperationMetrics* entry = nullptr;
+    for( uint64 i = 0; i < mOperations.Size() && !entry; ++i )
+        if( mOperations[i].operation == iOperation || strcmp( mOperations[i].operation, iOperation ) == 0 )
+            entry = &mOperations[i];
+
+    if( !entry ) {
+        mOperations.PushBack( FOperationMetrics { iOperation, 0, 0, 0, 0, 0, 0, 0, iMetrics.dispatchPath } );
+        entry = &mOperations.Back();
+    }
+
+    ++entry->numCommands;
+    entry->wallTime += iMetrics.wallTime;
+    entry->cpuTime += iMetrics.cpuTime;
+    entry->numJobs += iMetrics.numJobs;
+    entry->bytesRead += iMetrics.bytesRead;
+    entry->bytesWritten += iMetrics.bytesWritten;
+    entry->pixels += iMetrics.pixels;
+}
+
+void
+FMetricsTable::Get( TArray< FOperationMetrics >* oMetrics ) const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    oMetrics->Clear();
+    oMetrics->Reserve( mOperations.Size() );
+    for( uint64 i = 0; i < mOperations.Size(); ++i )
+        oMetrics->PushBack( mOperations[i] );
+}
+
+void
+FMetricsTable::Reset()
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mOperations.Clear();
+}
+
+ULIS_NAMESPACE_END
+
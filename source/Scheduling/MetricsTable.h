@@ -0,0 +1,55 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         MetricsTable.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FMetricsTable class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "Memory/Array.h"
+#include "Scheduling/CommandMetrics.h"
+#include <memory>
+#include <mutex>
+
+ULIS_NAMESPACE_BEGIN
+class FMetricsTable;
+typedef std::shared_ptr< FMetricsTable > FSharedMetricsTable;
+
+/////////////////////////////////////////////////////
+/// @class      FMetricsTable
+/// @brief      The FMetricsTable class sums the FCommandMetrics of the
+///             commands of a FContext, per operation.
+/// @details    Events add the metrics of their command when it finishes, on
+///             the worker that finishes it. Events hold a shared reference on
+///             the table, so that the context can be destroyed before its
+///             commands finish.
+///
+///             There are a few tens of operations at most, they are searched
+///             linearly, by name pointer first.
+///
+///             \sa FContext
+///             \sa FInternalEvent
+class FMetricsTable
+{
+public:
+    /*! Add the metrics of a finished command of iOperation. */
+    void Add( const char* iOperation, const FCommandMetrics& iMetrics );
+
+    /*! Get a copy of the sums, one per operation, in order of first use. */
+    void Get( TArray< FOperationMetrics >* oMetrics ) const;
+
+    /*! Forget all sums. */
+    void Reset();
+
+private:
+    mutable std::mutex mMutex;
+    TArray< FOperationMetrics > mOperations;
+};
+
+ULIS_NAMESPACE_END
+
@@ -11,6 +11,9 @@
 */
 #pragma once
 #include "Core/Core.h"
+#include "Scheduling/ScheduleCostModel.h"
+#include <cstddef>
+#include <type_traits>
 
 ULIS_NAMESPACE_BEGIN
 /////////////////////////////////////////////////////
@@ -29,29 +32,28 @@ static
 void
 RangeBasedSchedulingDelegateBuildJobs_Scanlines(
       FCommand* iCommand
+    , const int64 iNumScanlines
     , const int64 iNumJobs
-    , const int64 iNumTasksPerJob
     , TDelegateBuildJobScanlines iDelegateBuildJobScanlines
 )
 {
-    ULIS_ASSERT( iNumJobs == 1 || iNumTasksPerJob == 1, "Logic error, one of these values should equal 1" );
-    iCommand->ReserveJobs( iNumJobs );
-    const TCommandArgs* cargs  = dynamic_cast< const TCommandArgs* >( iCommand->Args() );
+    // Scanlines are spread evenly, each job runs one task per scanline of
+    // its contiguous range.
+    ULIS_ASSERT( iNumJobs <= FMath::Max( iNumScanlines, int64( 1 ) ), "Bad number of jobs" );
+    const TCommandArgs* cargs  = static_cast< const TCommandArgs* >( iCommand->Args() );
+    TJobArgs* jargs = iCommand->ReserveJobs< TJobArgs >( iNumJobs, iNumScanlines );
     for( int64 i = 0; i < iNumJobs; ++i )
     {
-        IJobArgs** jargs = new IJobArgs*[ iNumTasksPerJob ];
-        for( int j = 0; j < iNumTasksPerJob; ++j ) {
-            TJobArgs* largs = new TJobArgs();
-            jargs[ j ] = largs;
-            iDelegateBuildJobScanlines( cargs, iNumJobs, iNumTasksPerJob, i + j, *largs );
-        }
-        FJob* job = new FJob(
-              static_cast< uint32 >( iNumTasksPerJob )
+        const int64 beg = ( iNumScanlines * i ) / iNumJobs;
+        const int64 end = ( iNumScanlines * ( i + 1 ) ) / iNumJobs;
+        for( int64 j = beg; j < end; ++j )
+            iDelegateBuildJobScanlines( cargs, iNumJobs, end - beg, j, jargs[ j ] );
+
+        iCommand->AddJob(
+              static_cast< uint32 >( end - beg )
             , &ResolveScheduledJobInvocation< TJobArgs, TCommandArgs, TDelegateInvoke >
-            , jargs
-            , iCommand
+            , jargs + beg
         );
-        iCommand->AddJob( job );
     }
 }
 
@@ -76,28 +78,83 @@ RangeBasedSchedulingDelegateBuildJobs_Chunks(
     , TDelegateBuildJobChunks iDelegateBuildJobChunks
 )
 {
-    iCommand->ReserveJobs( iNumChunks );
-    const TCommandArgs* cargs  = dynamic_cast< const TCommandArgs* >( iCommand->Args() );
+    const TCommandArgs* cargs  = static_cast< const TCommandArgs* >( iCommand->Args() );
+    TJobArgs* jargs = iCommand->ReserveJobs< TJobArgs >( iNumChunks, iNumChunks );
     int64 offset = 0;
     for( int i = 0; i < iNumChunks; ++i )
     {
-        IJobArgs** jargs = new IJobArgs*[ 1 ];
-        TJobArgs* largs = new TJobArgs();
-        jargs[ 0 ] = largs;
-        iDelegateBuildJobChunks( cargs, iSize, iNumChunks, offset, i, *largs );
-
-        FJob* job = new FJob(
+        iDelegateBuildJobChunks( cargs, iSize, iNumChunks, offset, i, jargs[ i ] );
+        iCommand->AddJob(
               1
             , &ResolveScheduledJobInvocation< TJobArgs, TCommandArgs, TDelegateInvoke >
-            , jargs
-            , iCommand
+            , jargs + i
         );
-        iCommand->AddJob( job );
         offset += iSize;
     }
     return;
 }
 
+/////////////////////////////////////////////////////
+// Tile Job Building
+template<
+      typename TJobArgs
+    , typename TCommandArgs
+    , void (*TDelegateInvoke)(
+          const TJobArgs*
+        , const TCommandArgs*
+        )
+    , typename TDelegateBuildJobTiles
+>
+ULIS_FORCEINLINE
+static
+void
+RangeBasedSchedulingDelegateBuildJobs_Tiles(
+      FCommand* iCommand
+    , const int64 iWidth
+    , const int64 iHeight
+    , const int64 iTileSize
+    , const bool iMono
+    , TDelegateBuildJobTiles iDelegateBuildJobTiles
+)
+{
+    // Each tile is a job which tasks are the spans of its scanlines, so that
+    // the source neighbourhood of a job stays small. A mono run processes
+    // all the tiles in order in a single job.
+    const int64 numTilesX = ( iWidth + iTileSize - 1 ) / iTileSize;
+    const int64 numTilesY = ( iHeight + iTileSize - 1 ) / iTileSize;
+    const int64 numJobs = iMono ? 1 : numTilesX * numTilesY;
+    const TCommandArgs* cargs  = static_cast< const TCommandArgs* >( iCommand->Args() );
+    TJobArgs* jargs = iCommand->ReserveJobs< TJobArgs >( numJobs, numTilesX * iHeight );
+    int64 index = 0;
+    for( int64 ty = 0; ty < numTilesY; ++ty )
+    {
+        const int64 y0 = ty * iTileSize;
+        const int64 y1 = FMath::Min( y0 + iTileSize, iHeight );
+        for( int64 tx = 0; tx < numTilesX; ++tx )
+        {
+            const int64 x = tx * iTileSize;
+            const int64 w = FMath::Min( iTileSize, iWidth - x );
+            const int64 first = index;
+            for( int64 line = y0; line < y1; ++line )
+                iDelegateBuildJobTiles( cargs, x, w, line, jargs[ index++ ] );
+
+            if( !iMono )
+                iCommand->AddJob(
+                      static_cast< uint32 >( index - first )
+                    , &ResolveScheduledJobInvocation< TJobArgs, TCommandArgs, TDelegateInvoke >
+                    , jargs + first
+                );
+        }
+    }
+
+    if( iMono )
+        iCommand->AddJob(
+              static_cast< uint32 >( index )
+            , &ResolveScheduledJobInvocation< TJobArgs, TCommandArgs, TDelegateInvoke >
+            , jargs
+        );
+}
+
 /////////////////////////////////////////////////////
 // Master Job Building
 template<
@@ -109,6 +166,7 @@ template<
         )
     , typename TDelegateBuildJobScanlines
     , typename TDelegateBuildJobChunks
+    , typename TDelegateBuildJobTiles = std::nullptr_t
 >
 ULIS_FORCEINLINE
 static
@@ -122,12 +180,16 @@ RangeBasedSchedulingBuildJobs(
     , const bool iForceMonoChunk
     , TDelegateBuildJobScanlines iDelegateBuildJobScanlines
     , TDelegateBuildJobChunks iDelegateBuildJobChunks
+    , TDelegateBuildJobTiles iDelegateBuildJobTiles = nullptr
 )
 {
     if( iForceMonoChunk )
         goto mono_chunks;
 
-    if( iPolicy.RunPolicy() == eScheduleRunPolicy::ScheduleRun_Mono )
+    if( iPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Tiles )
+        goto tiles;
+
+    if( iPolicy.RunPolicy() != eScheduleRunPolicy::ScheduleRun_Multi )
         if( iPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Scanlines )
             goto mono_scanlines;
         else
@@ -136,7 +198,9 @@ RangeBasedSchedulingBuildJobs(
             else
                 goto mono_chunks;
     else
-        if( iPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Scanlines )
+        if( iPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Auto )
+            goto auto_mode;
+        else if( iPolicy.ModePolicy() == eScheduleModePolicy::ScheduleMode_Scanlines )
             goto multi_scanlines;
         else
             if( !( iChunkAllowed ) )
@@ -157,8 +221,8 @@ mono_scanlines:
         >
         (
               iCommand
-            , 1
             , iNumScanlines
+            , 1
             , iDelegateBuildJobScanlines
         );
         return;
@@ -175,7 +239,7 @@ multi_scanlines:
         (
               iCommand
             , iNumScanlines
-            , 1
+            , iNumScanlines
             , iDelegateBuildJobScanlines
         );
         return;
@@ -235,6 +299,79 @@ multi_chunks_length:
         );
         return;
     }
+
+tiles:
+    {
+        // Operations that do not provide a tile builder run on scanlines.
+        if constexpr( std::is_same< TDelegateBuildJobTiles, std::nullptr_t >::value ) {
+            if( iPolicy.RunPolicy() != eScheduleRunPolicy::ScheduleRun_Multi )
+                goto mono_scanlines;
+            else
+                goto multi_scanlines;
+        } else {
+            const int64 tileSize = iPolicy.Value() > 0 ? iPolicy.Value() : FSchedulePolicy::DefaultTileSize;
+            const FRectI& rect = iCommand->Args()->dstRect;
+            RangeBasedSchedulingDelegateBuildJobs_Tiles<
+                  TJobArgs
+                , TCommandArgs
+                , TDelegateInvoke
+                , TDelegateBuildJobTiles
+            >
+            (
+                  iCommand
+                , rect.w
+                , iNumScanlines
+                , tileSize
+                , iPolicy.RunPolicy() != eScheduleRunPolicy::ScheduleRun_Multi
+                , iDelegateBuildJobTiles
+            );
+            return;
+        }
+    }
+
+auto_mode:
+    {
+        // Chunks are split on cache line boundaries, scanlines are grouped.
+        const int64 maxJobs = iChunkAllowed ? iBytesTotal : iNumScanlines;
+        const int64 numJobs = FScheduleCostModel::NumJobs( iCommand, iBytesTotal, maxJobs );
+        if( numJobs <= 1 )
+            if( !( iChunkAllowed ) )
+                goto mono_scanlines;
+            else
+                goto mono_chunks;
+
+        if( !( iChunkAllowed ) ) {
+            RangeBasedSchedulingDelegateBuildJobs_Scanlines<
+                  TJobArgs
+                , TCommandArgs
+                , TDelegateInvoke
+                , TDelegateBuildJobScanlines
+            >
+            (
+                  iCommand
+                , iNumScanlines
+                , numJobs
+                , iDelegateBuildJobScanlines
+            );
+            return;
+        }
+
+        const int64 size = FScheduleCostModel::ChunkSize( iCommand, iBytesTotal, numJobs );
+        const int64 count = ( iBytesTotal + size - 1 ) / size;
+        RangeBasedSchedulingDelegateBuildJobs_Chunks<
+              TJobArgs
+            , TCommandArgs
+            , TDelegateInvoke
+            , TDelegateBuildJobChunks
+        >
+        (
+              iCommand
+            , size
+            , count
+            , iDelegateBuildJobChunks
+        );
+        return;
+    }
 }
 
 ULIS_NAMESPACE_END
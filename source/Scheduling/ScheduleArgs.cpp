@@ -18,6 +18,22 @@ ICommandArgs::~ICommandArgs()
 {
 }
 
+uint64
+ICommandArgs::Footprint() const
+{
+    FCommandAccess accesses[ MaxAccesses ];
+    const uint32 num = Accesses( accesses );
+    uint64 footprint = 0;
+    for( uint32 i = 0; i < num; ++i ) {
+        bool seen = false;
+        for( uint32 j = 0; j < i && !seen; ++j )
+            seen = accesses[j].block == accesses[i].block;
+        if( !seen )
+            footprint += accesses[i].block->BytesTotal();
+    }
+    return  footprint;
+}
+
 /////////////////////////////////////////////////////
 // IJobArgs
 IJobArgs::~IJobArgs()
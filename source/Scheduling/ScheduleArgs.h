@@ -13,8 +13,22 @@
 #include "Core/Core.h"
 #include "Image/Block.h"
 #include "Math/Geometry/Rectangle.h"
+#include "Scheduling/SchedulingMemoryPool.h"
 
 ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FCommandAccess
+/// @brief      The FCommandAccess class describes a region of a block that
+///             is read or written by a command.
+/// @details    FCommandAccess is used by the hazard tracking of
+///             FCommandQueue in order to order commands that touch the same
+///             pixels.
+struct FCommandAccess {
+    const FBlock* block;
+    FRectI rect;
+    bool write;
+};
+
 /////////////////////////////////////////////////////
 /// @class      ICommandArgs
 /// @brief      The ICommandArgs class provides a virtual base class to implement
@@ -22,8 +36,11 @@ ULIS_NAMESPACE_BEGIN
 ///             coordination with a FThreadPool and a FCommandQueue.
 /// @details    The ICommandArgs does nothing special by itself, it is meant to
 ///             be used in a polymorphic way.
+///             Children are allocated from the FSchedulingMemoryPool.
 class ICommandArgs {
 public:
+    ULIS_DECLARE_SCHEDULING_POOL_ALLOCATION
+
     /*! Destructor */
     virtual ~ICommandArgs() = 0;
 
@@ -33,6 +50,29 @@ public:
         : dstRect( iDstRect )
     {}
 
+    /*!
+        Gather the regions accessed by the command, at most MaxAccesses, and
+        return their count. A count of zero means the accesses are unknown,
+        the command is then a barrier for hazard tracking.
+    */
+    virtual uint32 Accesses( FCommandAccess* oAccesses ) const { return  0; }
+
+    /*!
+        Estimate the time it takes to process a pixel of dstRect on a single
+        core, in nanoseconds, for ScheduleMode_Auto. The default stands for
+        memory bound operations such as fills and copies.
+    */
+    virtual ufloat CostPerPixel() const { return  1.f; }
+
+    /*!
+        Estimate the memory the command needs while it is in flight, in
+        bytes, for the memory budget of FCommandQueue. The default is the
+        size of the distinct blocks it accesses.
+    */
+    virtual uint64 Footprint() const;
+
+    static constexpr uint32 MaxAccesses = 4;
+
     const FRectI dstRect;
 };
 
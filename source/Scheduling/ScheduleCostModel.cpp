@@ -0,0 +1,70 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ScheduleCostModel.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FScheduleCostModel class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/ScheduleCostModel.h"
+#include "Scheduling/Command.h"
+#include "Scheduling/ScheduleArgs.h"
+#include "Math/Math.h"
+#include "System/CPUInfo/CPUInfo.h"
+
+ULIS_NAMESPACE_BEGIN
+//static
+int64
+FScheduleCostModel::NumJobs( const FCommand* iCommand, int64 iBytesTotal, int64 iMaxJobs )
+{
+    const uint32 workers = iCommand->NumWorkers();
+    if( workers <= 1 || iMaxJobs <= 1 )
+        return  1;
+
+    const ICommandArgs* args = iCommand->Args();
+    const int64 pixels = static_cast< int64 >( args->dstRect.Area() );
+    const ufloat work = static_cast< ufloat >( pixels ) * args->CostPerPixel();
+    const int64 affordable = static_cast< int64 >( work / MinJobDuration );
+    if( affordable <= 1 )
+        return  1;
+
+    // Bytes actually written, the block may be larger than the rect.
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const int64 bytes = args->Accesses( accesses ) ?
+          pixels * accesses[0].block->BytesPerPixel()
+        : iBytesTotal;
+    const int64 l2 = FMath::Max( static_cast< int64 >( FCPUInfo::L2CacheSize() ), int64( 1 ) );
+    const int64 cacheJobs = ( bytes + l2 - 1 ) / l2;
+
+    const int64 numJobs = FMath::Max( static_cast< int64 >( workers ) * JobsPerWorker, cacheJobs );
+    return  FMath::Clamp( numJobs, int64( 1 ), FMath::Min( affordable, iMaxJobs ) );
+}
+
+//static
+int64
+FScheduleCostModel::ChunkSize( const FCommand* iCommand, int64 iBytesTotal, int64 iNumJobs )
+{
+    FCommandAccess accesses[ ICommandArgs::MaxAccesses ];
+    const int64 bpp = iCommand->Args()->Accesses( accesses ) ? accesses[0].block->BytesPerPixel() : 1;
+    const int64 granularity = FMath::Max( static_cast< int64 >( FCPUInfo::L1CacheLineSize() ), int64( 1 ) ) * bpp;
+    const int64 size = ( iBytesTotal + iNumJobs - 1 ) / FMath::Max( iNumJobs, int64( 1 ) );
+    return  FMath::Max( ( size + granularity - 1 ) / granularity * granularity, granularity );
+}
+
+//static
+bool
+FScheduleCostModel::RunInline( const FCommand* iCommand )
+{
+    const ICommandArgs* args = iCommand->Args();
+    ufloat work = static_cast< ufloat >( args->dstRect.Area() ) * args->CostPerPixel();
+    const TArray< FCommand* >& fused = iCommand->FusedCommands();
+    for( uint64 i = 0; i < fused.Size(); ++i )
+        work += static_cast< ufloat >( fused[i]->Args()->dstRect.Area() ) * fused[i]->Args()->CostPerPixel();
+    return  work < MaxInlineDuration;
+}
+
+ULIS_NAMESPACE_END
+
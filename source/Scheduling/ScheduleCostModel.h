@@ -0,0 +1,69 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ScheduleCostModel.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FScheduleCostModel class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+
+ULIS_NAMESPACE_BEGIN
+class FCommand;
+/////////////////////////////////////////////////////
+/// @class      FScheduleCostModel
+/// @brief      The FScheduleCostModel class estimates how many jobs a
+///             command should be split in, for ScheduleMode_Auto.
+/// @details    The estimated duration of a command is the area of its
+///             destination rect times the cost per pixel of its arguments.
+///             A command that would not keep two jobs busy for at least
+///             MinJobDuration runs as a single job. Otherwise it is split in
+///             a few jobs per worker, so that work stealing can balance the
+///             load, and in at least enough jobs for each of them to fit in
+///             the L2 cache.
+///
+///             A command, or a chain of fused commands, estimated to run in
+///             less than MaxInlineDuration is run inline by the queue that
+///             flushes it, on the calling thread.
+///
+///             \sa FSchedulePolicy
+///             \sa ICommandArgs
+class FScheduleCostModel
+{
+public:
+    /*!
+        Estimate the number of jobs for iCommand, in [1, iMaxJobs].
+        iBytesTotal is the number of bytes the command goes through, it is
+        used if the arguments do not describe their accesses.
+    */
+    static int64 NumJobs( const FCommand* iCommand, int64 iBytesTotal, int64 iMaxJobs );
+
+    /*!
+        Compute the length of the chunks in order to split iBytesTotal in
+        about iNumJobs jobs. Chunks are made of whole pixels and whole cache
+        lines.
+    */
+    static int64 ChunkSize( const FCommand* iCommand, int64 iBytesTotal, int64 iNumJobs );
+
+    /*!
+        Check whether iCommand is cheap enough to run inline, rather than be
+        dispatched to the pool.
+    */
+    static bool RunInline( const FCommand* iCommand );
+
+    /*! Shortest worthwhile job duration, in nanoseconds. */
+    static constexpr ufloat MinJobDuration = 50000.f;
+
+    /*! Number of jobs per worker for large commands. */
+    static constexpr int64 JobsPerWorker = 4;
+
+    /*! Longest command duration worth running inline, in nanoseconds. */
+    static constexpr ufloat MaxInlineDuration = 20000.f;
+};
+
+ULIS_NAMESPACE_END
+
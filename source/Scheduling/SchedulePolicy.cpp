@@ -27,6 +27,14 @@ const FSchedulePolicy FSchedulePolicy::AsyncMultiScanlines( ScheduleTime_Async,
 const FSchedulePolicy FSchedulePolicy::AsyncMonoScanlines( ScheduleTime_Async, ScheduleRun_Mono, ScheduleMode_Scanlines );
 const FSchedulePolicy FSchedulePolicy::MultiScanlines( ScheduleTime_Sync, ScheduleRun_Multi, ScheduleMode_Scanlines );
 const FSchedulePolicy FSchedulePolicy::MonoScanlines( ScheduleTime_Sync, ScheduleRun_Mono, ScheduleMode_Scanlines );
+const FSchedulePolicy FSchedulePolicy::AsyncAuto( ScheduleTime_Async, ScheduleRun_Multi, ScheduleMode_Auto );
+const FSchedulePolicy FSchedulePolicy::Auto( ScheduleTime_Sync, ScheduleRun_Multi, ScheduleMode_Auto );
+const FSchedulePolicy FSchedulePolicy::AsyncMultiTiles( ScheduleTime_Async, ScheduleRun_Multi, ScheduleMode_Tiles, ScheduleParameter_Length, FSchedulePolicy::DefaultTileSize );
+const FSchedulePolicy FSchedulePolicy::MultiTiles( ScheduleTime_Sync, ScheduleRun_Multi, ScheduleMode_Tiles, ScheduleParameter_Length, FSchedulePolicy::DefaultTileSize );
+const FSchedulePolicy FSchedulePolicy::AsyncMonoTiles( ScheduleTime_Async, ScheduleRun_Mono, ScheduleMode_Tiles, ScheduleParameter_Length, FSchedulePolicy::DefaultTileSize );
+const FSchedulePolicy FSchedulePolicy::MonoTiles( ScheduleTime_Sync, ScheduleRun_Mono, ScheduleMode_Tiles, ScheduleParameter_Length, FSchedulePolicy::DefaultTileSize );
+const FSchedulePolicy FSchedulePolicy::AsyncInline( ScheduleTime_Async, ScheduleRun_Inline, ScheduleMode_Scanlines );
+const FSchedulePolicy FSchedulePolicy::Inline( ScheduleTime_Sync, ScheduleRun_Inline, ScheduleMode_Scanlines );
 //
 
 FSchedulePolicy::~FSchedulePolicy()
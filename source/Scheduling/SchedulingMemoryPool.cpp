@@ -0,0 +1,100 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingMemoryPool.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FSchedulingMemoryPool class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/SchedulingMemoryPool.h"
+#include <mutex>
+#include <new>
+
+ULIS_NAMESPACE_BEGIN
+namespace {
+static constexpr uint32 sMinClassShift = 6;     // 64 B
+static constexpr uint32 sMaxClassShift = 16;    // 64 KiB
+static constexpr uint32 sNumClasses = sMaxClassShift - sMinClassShift + 1;
+static constexpr std::size_t sSlabSize = std::size_t( 1 ) << 16;
+static constexpr std::size_t sCellAlignment = 64;
+
+struct FFreeCell {
+    FFreeCell* mNext;
+};
+
+struct FSizeClass {
+    std::mutex mMutex;
+    FFreeCell* mFree = nullptr;
+};
+
+// Never destroyed: commands may still be released by worker threads during
+// static destruction.
+FSizeClass*
+SizeClasses()
+{
+    static FSizeClass* classes = new FSizeClass[ sNumClasses ];
+    return  classes;
+}
+
+uint32
+SizeClassIndex( std::size_t iSize )
+{
+    uint32 index = 0;
+    std::size_t cell = std::size_t( 1 ) << sMinClassShift;
+    while( cell < iSize ) {
+        cell <<= 1;
+        ++index;
+    }
+    return  index;
+}
+} // namespace
+
+//static
+void*
+FSchedulingMemoryPool::Malloc( std::size_t iSize )
+{
+    if( iSize > ( std::size_t( 1 ) << sMaxClassShift ) )
+        return  ::operator new( iSize );
+
+    const uint32 index = SizeClassIndex( iSize );
+    const std::size_t cellSize = std::size_t( 1 ) << ( index + sMinClassShift );
+    FSizeClass& sizeClass = SizeClasses()[ index ];
+    std::lock_guard< std::mutex > lock( sizeClass.mMutex );
+    if( !sizeClass.mFree ) {
+        // Carve a new slab in cells, the first one is returned right away.
+        uint8* slab = static_cast< uint8* >( ::operator new( sSlabSize, std::align_val_t( sCellAlignment ) ) );
+        for( std::size_t offset = cellSize; offset < sSlabSize; offset += cellSize ) {
+            FFreeCell* cell = reinterpret_cast< FFreeCell* >( slab + offset );
+            cell->mNext = sizeClass.mFree;
+            sizeClass.mFree = cell;
+        }
+        return  slab;
+    }
+
+    FFreeCell* cell = sizeClass.mFree;
+    sizeClass.mFree = cell->mNext;
+    return  cell;
+}
+
+//static
+void
+FSchedulingMemoryPool::Free( void* iPtr, std::size_t iSize )
+{
+    if( !iPtr )
+        return;
+
+    if( iSize > ( std::size_t( 1 ) << sMaxClassShift ) )
+        return  ::operator delete( iPtr );
+
+    FSizeClass& sizeClass = SizeClasses()[ SizeClassIndex( iSize ) ];
+    FFreeCell* cell = static_cast< FFreeCell* >( iPtr );
+    std::lock_guard< std::mutex > lock( sizeClass.mMutex );
+    cell->mNext = sizeClass.mFree;
+    sizeClass.mFree = cell;
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,92 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingMemoryPool.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FSchedulingMemoryPool class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include <cstddef>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FSchedulingMemoryPool
+/// @brief      The FSchedulingMemoryPool class provides a recycling slab
+///             allocator for the short lived objects of the scheduling
+///             system: commands, command arguments, events and job storage.
+/// @details    Every command issued by a FContext used to hit the heap a few
+///             times, plus a few more times per job and per task. For small
+///             operations such as brush dabs, malloc and free would dominate
+///             the actual pixel work.
+///
+///             Allocations are rounded up to a power of two size class, from
+///             64 bytes to 64 KiB. Freed cells are kept in a free list per
+///             class and handed back on the next allocation of the same class,
+///             so that steady state command construction does not allocate.
+///             Cells of the small classes are carved from 64 KiB slabs.
+///             Larger requests are forwarded to the heap.
+///
+///             Commands are built on the thread that issues them and destroyed
+///             on the worker that completes them, so each class is guarded by
+///             its own lock. The pool is shared by all queues, and its memory
+///             is kept until program termination.
+///
+///             \sa FCommand
+///             \sa FJob
+class FSchedulingMemoryPool
+{
+public:
+    /*!
+        Allocate a cell of at least iSize bytes.
+        The returned memory is aligned to 64 bytes if it comes from the pool.
+    */
+    static void* Malloc( std::size_t iSize );
+
+    /*!
+        Give back a cell obtained from Malloc, iSize must be the size that was
+        requested on allocation.
+    */
+    static void Free( void* iPtr, std::size_t iSize );
+};
+
+/////////////////////////////////////////////////////
+/// @class      TSchedulingAllocator
+/// @brief      The TSchedulingAllocator class is a minimal standard allocator
+///             adapter over FSchedulingMemoryPool, for std::allocate_shared.
+template< typename T >
+class TSchedulingAllocator
+{
+public:
+    typedef T value_type;
+
+    TSchedulingAllocator() noexcept {}
+    template< typename U > TSchedulingAllocator( const TSchedulingAllocator< U >& ) noexcept {}
+
+    T* allocate( std::size_t iNum ) {
+        return  static_cast< T* >( FSchedulingMemoryPool::Malloc( iNum * sizeof( T ) ) );
+    }
+
+    void deallocate( T* iPtr, std::size_t iNum ) noexcept {
+        FSchedulingMemoryPool::Free( iPtr, iNum * sizeof( T ) );
+    }
+
+    template< typename U > bool operator==( const TSchedulingAllocator< U >& ) const noexcept { return  true; }
+    template< typename U > bool operator!=( const TSchedulingAllocator< U >& ) const noexcept { return  false; }
+};
+
+/////////////////////////////////////////////////////
+// Class scope allocation
+// Routes new and delete of a class and all its children to the pool.
+// The sized delete receives the size of the dynamic type as long as the
+// destructor is virtual.
+#define ULIS_DECLARE_SCHEDULING_POOL_ALLOCATION                                                         \
+    static void* operator new( std::size_t iSize ) { return  FSchedulingMemoryPool::Malloc( iSize ); } \
+    static void operator delete( void* iPtr, std::size_t iSize ) { FSchedulingMemoryPool::Free( iPtr, iSize ); }
+
+ULIS_NAMESPACE_END
+
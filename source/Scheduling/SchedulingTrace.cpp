@@ -0,0 +1,56 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingTrace.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FSchedulingTrace class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/SchedulingTrace.h"
+#include "Scheduling/SchedulingTrace_Private.h"
+
+ULIS_NAMESPACE_BEGIN
+//static
+bool
+FSchedulingTrace::Available()
+{
+#ifdef ULIS_TRACE_ENABLED
+    return  true;
+#else
+    return  false;
+#endif
+}
+
+//static
+void
+FSchedulingTrace::Start()
+{
+    FSchedulingTrace_Private::Start();
+}
+
+//static
+void
+FSchedulingTrace::Stop()
+{
+    FSchedulingTrace_Private::Stop();
+}
+
+//static
+bool
+FSchedulingTrace::Running()
+{
+    return  FSchedulingTrace_Private::Enabled();
+}
+
+//static
+bool
+FSchedulingTrace::Dump( const std::string& iPath )
+{
+    return  FSchedulingTrace_Private::Dump( iPath );
+}
+
+ULIS_NAMESPACE_END
+
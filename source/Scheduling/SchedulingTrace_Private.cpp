@@ -0,0 +1,248 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingTrace_Private.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FSchedulingTrace_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Scheduling/SchedulingTrace_Private.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+#ifdef ULIS_TRACE_ENABLED
+namespace {
+enum eTraceRecordType : uint8
+{
+      TraceRecord_Job
+    , TraceRecord_Command
+    , TraceRecord_Wait
+};
+
+struct FTraceRecord
+{
+    const char*         mName;
+    uint64              mId;
+    uint64              mTime[3];
+    eTraceRecordType    mType;
+};
+
+struct FTraceBuffer
+{
+    std::mutex                  mMutex;
+    std::string                 mName;
+    std::vector< FTraceRecord > mRecords;
+};
+
+struct FTraceRegistry
+{
+    std::mutex                                      mMutex;
+    std::vector< std::unique_ptr< FTraceBuffer > >  mBuffers;
+    std::atomic_uint64_t                            mNextId { 1 };
+    uint64                                          mOrigin { 0 };
+};
+
+// Never destroyed, threads may still record during static destruction.
+FTraceRegistry&
+Registry()
+{
+    static FTraceRegistry* registry = new FTraceRegistry();
+    return  *registry;
+}
+
+thread_local FTraceBuffer* tBuffer = nullptr;
+thread_local std::string tName;
+
+FTraceBuffer&
+ThreadBuffer()
+{
+    if( !tBuffer ) {
+        FTraceRegistry& registry = Registry();
+        std::lock_guard< std::mutex > lock( registry.mMutex );
+        registry.mBuffers.emplace_back( new FTraceBuffer() );
+        tBuffer = registry.mBuffers.back().get();
+        tBuffer->mName = tName.empty() ? "Thread " + std::to_string( registry.mBuffers.size() ) : tName;
+    }
+    return  *tBuffer;
+}
+
+void
+Record( eTraceRecordType iType, const char* iName, uint64 iId, uint64 iT0, uint64 iT1, uint64 iT2 )
+{
+    FTraceBuffer& buffer = ThreadBuffer();
+    std::lock_guard< std::mutex > lock( buffer.mMutex );
+    buffer.mRecords.push_back( { iName, iId, { iT0, iT1, iT2 }, iType } );
+}
+
+// Names are identifiers or thread names, only quotes and backslashes are
+// escaped, control characters are dropped.
+std::string
+Escape( const std::string& iStr )
+{
+    std::string result;
+    result.reserve( iStr.size() );
+    for( char c : iStr ) {
+        if( c == '"' || c == '\\' )
+            result.push_back( '\\' );
+        if( static_cast< unsigned char >( c ) >= 0x20 )
+            result.push_back( c );
+    }
+    return  result;
+}
+} // namespace
+
+std::atomic_bool FSchedulingTrace_Private::sEnabled( false );
+#endif // ULIS_TRACE_ENABLED
+
+//static
+uint64
+FSchedulingTrace_Private::Now()
+{
+    return  static_cast< uint64 >( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+//static
+uint64
+FSchedulingTrace_Private::NewId()
+{
+#ifdef ULIS_TRACE_ENABLED
+    return  Registry().mNextId.fetch_add( 1, std::memory_order_relaxed );
+#else
+    return  0;
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::NameThread( const std::string& iName )
+{
+#ifdef ULIS_TRACE_ENABLED
+    tName = iName;
+    if( tBuffer ) {
+        std::lock_guard< std::mutex > lock( tBuffer->mMutex );
+        tBuffer->mName = iName;
+    }
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::RecordJob( const char* iName, uint64 iId, uint64 iStart, uint64 iEnd )
+{
+#ifdef ULIS_TRACE_ENABLED
+    Record( TraceRecord_Job, iName, iId, iStart, iEnd, 0 );
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::RecordCommand( const char* iName, uint64 iId, uint64 iQueued, uint64 iScheduled, uint64 iFinished )
+{
+#ifdef ULIS_TRACE_ENABLED
+    Record( TraceRecord_Command, iName, iId, iQueued, iScheduled, iFinished );
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::RecordWait( const char* iName, uint64 iStart, uint64 iEnd )
+{
+#ifdef ULIS_TRACE_ENABLED
+    Record( TraceRecord_Wait, iName, 0, iStart, iEnd, 0 );
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::Start()
+{
+#ifdef ULIS_TRACE_ENABLED
+    FTraceRegistry& registry = Registry();
+    std::lock_guard< std::mutex > lock( registry.mMutex );
+    for( auto& buffer : registry.mBuffers ) {
+        std::lock_guard< std::mutex > bufferLock( buffer->mMutex );
+        buffer->mRecords.clear();
+    }
+    registry.mOrigin = Now();
+    sEnabled = true;
+#endif
+}
+
+//static
+void
+FSchedulingTrace_Private::Stop()
+{
+#ifdef ULIS_TRACE_ENABLED
+    sEnabled = false;
+#endif
+}
+
+//static
+bool
+FSchedulingTrace_Private::Dump( const std::string& iPath )
+{
+#ifdef ULIS_TRACE_ENABLED
+    FILE* file = fopen( iPath.c_str(), "w" );
+    if( !file )
+        return  false;
+
+    FTraceRegistry& registry = Registry();
+    std::lock_guard< std::mutex > lock( registry.mMutex );
+    const uint64 origin = registry.mOrigin;
+    auto ts = [ origin ]( uint64 iTime ) { return  iTime > origin ? ( iTime - origin ) / 1000.0 : 0.0; };
+
+    fprintf( file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n" );
+    fprintf( file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ULIS\"}}" );
+    for( uint64 tid = 0; tid < registry.mBuffers.size(); ++tid ) {
+        FTraceBuffer& buffer = *registry.mBuffers[ tid ];
+        std::lock_guard< std::mutex > bufferLock( buffer.mMutex );
+        if( buffer.mRecords.empty() )
+            continue;
+
+        fprintf( file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"args\":{\"name\":\"%s\"}}", static_cast< unsigned long long >( tid ), Escape( buffer.mName ).c_str() );
+        for( const FTraceRecord& record : buffer.mRecords ) {
+            const std::string name = Escape( record.mName );
+            const unsigned long long id = record.mId;
+            switch( record.mType ) {
+                case TraceRecord_Job:
+                    fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"job\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"command\":%llu}}"
+                        , name.c_str(), static_cast< unsigned long long >( tid ), ts( record.mTime[0] ), ( record.mTime[1] - record.mTime[0] ) / 1000.0, id );
+                    break;
+                case TraceRecord_Wait:
+                    fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"wait\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f}"
+                        , name.c_str(), static_cast< unsigned long long >( tid ), ts( record.mTime[0] ), ( record.mTime[1] - record.mTime[0] ) / 1000.0 );
+                    break;
+                case TraceRecord_Command: {
+                    // The whole lifetime, split in its queued and running parts.
+                    const char* phases[2] = { "queued", "running" };
+                    fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"command\",\"ph\":\"b\",\"id\":\"%llu\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"args\":{\"command\":%llu}}"
+                        , name.c_str(), id, static_cast< unsigned long long >( tid ), ts( record.mTime[0] ), id );
+                    for( int i = 0; i < 2; ++i ) {
+                        fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"command\",\"ph\":\"b\",\"id\":\"%llu\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f}"
+                            , phases[i], id, static_cast< unsigned long long >( tid ), ts( record.mTime[i] ) );
+                        fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"command\",\"ph\":\"e\",\"id\":\"%llu\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f}"
+                            , phases[i], id, static_cast< unsigned long long >( tid ), ts( record.mTime[i + 1] ) );
+                    }
+                    fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"command\",\"ph\":\"e\",\"id\":\"%llu\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f}"
+                        , name.c_str(), id, static_cast< unsigned long long >( tid ), ts( record.mTime[2] ) );
+                    break;
+                }
+            }
+        }
+    }
+    fprintf( file, "\n]}\n" );
+    return  fclose( file ) == 0;
+#else
+    return  false;
+#endif
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,75 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingTrace_Private.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FSchedulingTrace_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include <atomic>
+#include <string>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FSchedulingTrace_Private
+/// @brief      The FSchedulingTrace_Private class records the events of
+///             FSchedulingTrace, for the thread pools, events and queues.
+/// @details    Each thread appends its records to its own buffer, found
+///             through a thread local pointer and registered on its first
+///             record. Buffers are never freed, so that the records of a
+///             worker outlive it until the next Start(), and the pointer
+///             stays valid. Each buffer has its own lock, only contended by
+///             Start() and Dump().
+///
+///             Callers check Enabled() before they read the clock, it is a
+///             constant false when the trace is compiled out, so that the
+///             whole recording code is removed.
+///
+///             Timestamps are in nanoseconds on the steady clock.
+///
+///             \sa FSchedulingTrace
+class FSchedulingTrace_Private
+{
+public:
+    /*! Check whether records should be made. */
+#ifdef ULIS_TRACE_ENABLED
+    static bool Enabled() { return  sEnabled.load( std::memory_order_relaxed ); }
+#else
+    static constexpr bool Enabled() { return  false; }
+#endif
+
+    /*! Get the current time. */
+    static uint64 Now();
+
+    /*! Get a new command id. */
+    static uint64 NewId();
+
+    /*! Name the calling thread, the name is used by the next records. */
+    static void NameThread( const std::string& iName );
+
+    /*! Record the execution of a job of the command iId, named iName. */
+    static void RecordJob( const char* iName, uint64 iId, uint64 iStart, uint64 iEnd );
+
+    /*! Record the lifetime of the command iId, named iName. */
+    static void RecordCommand( const char* iName, uint64 iId, uint64 iQueued, uint64 iScheduled, uint64 iFinished );
+
+    /*! Record a wait for completion, iName is a string literal. */
+    static void RecordWait( const char* iName, uint64 iStart, uint64 iEnd );
+
+    static void Start();
+    static void Stop();
+    static bool Dump( const std::string& iPath );
+
+private:
+#ifdef ULIS_TRACE_ENABLED
+    static std::atomic_bool sEnabled;
+#endif
+};
+
+ULIS_NAMESPACE_END
+
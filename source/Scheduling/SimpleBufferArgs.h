@@ -36,6 +36,11 @@ public:
         , dst( iDst )
     {}
 
+    uint32 Accesses( FCommandAccess* oAccesses ) const override {
+        oAccesses[0] = { &dst, dstRect, true };
+        return  1;
+    }
+
     FBlock& dst;
 };
 
@@ -56,6 +61,33 @@ public:
     uint32 line;
 };
 
+/////////////////////////////////////////////////////
+// Padding
+// Size of a span of iBlock rounded up to whole vectors of iVector bytes, if
+// the span ends with its scanline and the rounded span fits in the padding of
+// the stride, so that a kernel can process it with full vectors and no tail.
+// The padding holds no pixels and belongs to the job that owns the scanline.
+// Returns iSize otherwise.
+static
+ULIS_FORCEINLINE
+int64
+SpanInPadding(
+      const FBlock& iBlock
+    , const uint8* iSpan
+    , const int64 iSize
+    , const int64 iVector
+)
+{
+    const int64 rounded = ( ( iSize + iVector - 1 ) / iVector ) * iVector;
+    if( rounded == iSize || iBlock.IsContiguous() )
+        return  iSize;
+
+    const int64 bps = static_cast< int64 >( iBlock.BytesPerScanLine() );
+    const int64 offset = static_cast< int64 >( iSpan - iBlock.Bits() ) % bps;
+    const int64 packed = static_cast< int64 >( iBlock.Width() ) * iBlock.BytesPerPixel();
+    return  ( offset + iSize == packed && offset + rounded <= bps ) ? rounded : iSize;
+}
+
 /////////////////////////////////////////////////////
 // Job Building
 static
@@ -115,7 +147,7 @@ ScheduleSimpleBufferJobs(
     , TDelegateBuildJobChunks iDelegateBuildJobChunks
 )
 {
-    const FSimpleBufferCommandArgs* cargs = dynamic_cast< const FSimpleBufferCommandArgs* >( iCommand->Args() );
+    const FSimpleBufferCommandArgs* cargs = static_cast< const FSimpleBufferCommandArgs* >( iCommand->Args() );
     RangeBasedSchedulingBuildJobs<
           TJobArgs
         , TCommandArgs
@@ -126,7 +158,7 @@ ScheduleSimpleBufferJobs(
         , iPolicy
         , static_cast< int64 >( cargs->dst.BytesTotal() )
         , cargs->dstRect.h
-        , iContiguous
+        , iContiguous && cargs->dst.IsContiguous()
         , iForceMonoChunk
         , iDelegateBuildJobScanlines
         , iDelegateBuildJobChunks
@@ -0,0 +1,58 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         LargeBlock.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FLargeBlock class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Sparse/LargeBlock.h"
+#include "Math/Math.h"
+#include <limits>
+
+ULIS_NAMESPACE_BEGIN
+FLargeBlock::~FLargeBlock()
+{
+}
+
+FLargeBlock::FLargeBlock(
+      FTilePool& iPool
+    , uint32 iWidth
+    , uint32 iHeight
+)
+    : FTiledBlock(
+          iPool
+        , FRectI(
+              0
+            , 0
+            , static_cast< int >( FMath::Min( iWidth, static_cast< uint32 >( std::numeric_limits< int >::max() ) ) )
+            , static_cast< int >( FMath::Min( iHeight, static_cast< uint32 >( std::numeric_limits< int >::max() ) ) )
+        )
+    )
+{
+    ULIS_ASSERT( iWidth <= static_cast< uint32 >( std::numeric_limits< int >::max() ) && iHeight <= static_cast< uint32 >( std::numeric_limits< int >::max() ), "Large block too large" );
+}
+
+uint32
+FLargeBlock::Width() const
+{
+    return  static_cast< uint32 >( Bounds().w );
+}
+
+uint32
+FLargeBlock::Height() const
+{
+    return  static_cast< uint32 >( Bounds().h );
+}
+
+uint64
+FLargeBlock::Area() const
+{
+    return  static_cast< uint64 >( Width() ) * Height();
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,127 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SwapFile.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FSwapFile class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Sparse/SwapFile.h"
+#include "Math/Math.h"
+
+#if defined( ULIS_WIN )
+#include "Sparse/SwapFile_Windows.inl"
+#elif defined( ULIS_MACOS ) || defined( ULIS_LINUX )
+#include "Sparse/SwapFile_POSIX.inl"
+#else
+#include "Sparse/SwapFile_Generic.inl"
+#endif
+
+#if ( defined( ULIS_GCC ) || defined( ULIS_MINGW ) ) && __GNUC__ < 8
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#include <filesystem>
+namespace fs = std::filesystem;
+#endif
+
+ULIS_NAMESPACE_BEGIN
+// Segments of about 64MB, aligned on 1MB so that their offsets suit the
+// mapping granularity of every system.
+static constexpr uint64 sSegmentTarget = 64 * 1024 * 1024;
+static constexpr uint64 sSegmentAlignment = 1024 * 1024;
+
+FSwapFile::~FSwapFile()
+{
+    for( uint64 i = 0; i < mSegments.size(); ++i )
+        detail::UnmapScratchSegment( mSegments[i], mSegmentSize, mMappings[i] );
+
+    if( IsOpen() )
+        detail::CloseScratchFile( mFile );
+}
+
+FSwapFile::FSwapFile( uint64 iSlotSize )
+    : mSlotSize( iSlotSize )
+    , mSlotsPerSegment( FMath::Max( uint64( 1 ), sSegmentTarget / iSlotSize ) )
+    , mSegmentSize( ( ( mSlotsPerSegment * iSlotSize + sSegmentAlignment - 1 ) / sSegmentAlignment ) * sSegmentAlignment )
+    , mFile( detail::InvalidScratchFile )
+{
+}
+
+bool
+FSwapFile::Open( const std::string& iDirectory )
+{
+    ULIS_ASSERT( !IsOpen(), "Swap file already open" );
+    std::string directory = iDirectory;
+    if( directory.empty() ) {
+        std::error_code ec;
+        directory = fs::temp_directory_path( ec ).string();
+        if( ec )
+            return  false;
+    }
+
+    mFile = detail::OpenScratchFile( directory );
+    return  IsOpen();
+}
+
+bool
+FSwapFile::IsOpen() const
+{
+    return  mFile != detail::InvalidScratchFile;
+}
+
+int64
+FSwapFile::AllocateSlot()
+{
+    if( !mFreeSlots.empty() ) {
+        const int64 slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+        return  slot;
+    }
+
+    // Grow by one segment, its slots are given in ascending order.
+    if( !IsOpen() )
+        return  -1;
+
+    const uint64 offset = mSegments.size() * mSegmentSize;
+    if( !detail::ResizeScratchFile( mFile, offset + mSegmentSize ) )
+        return  -1;
+
+    void* mapping = nullptr;
+    uint8* data = detail::MapScratchSegment( mFile, offset, mSegmentSize, &mapping );
+    if( !data )
+        return  -1;
+
+    mSegments.push_back( data );
+    mMappings.push_back( mapping );
+    const int64 first = static_cast< int64 >( ( mSegments.size() - 1 ) * mSlotsPerSegment );
+    for( int64 i = static_cast< int64 >( mSlotsPerSegment ) - 1; i > 0; --i )
+        mFreeSlots.push_back( first + i );
+    return  first;
+}
+
+void
+FSwapFile::FreeSlot( int64 iSlot )
+{
+    ULIS_ASSERT( iSlot >= 0 && static_cast< uint64 >( iSlot ) < mSegments.size() * mSlotsPerSegment, "Bad swap slot" );
+    mFreeSlots.push_back( iSlot );
+}
+
+uint8*
+FSwapFile::SlotData( int64 iSlot ) const
+{
+    const uint64 slot = static_cast< uint64 >( iSlot );
+    return  mSegments[ slot / mSlotsPerSegment ] + ( slot % mSlotsPerSegment ) * mSlotSize;
+}
+
+uint64
+FSwapFile::Size() const
+{
+    return  mSegments.size() * mSegmentSize;
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,77 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SwapFile.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FSwapFile class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include <string>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FSwapFile
+/// @brief      The FSwapFile class is a scratch file on disk, mapped in
+///             memory, made of slots of a fixed size.
+/// @details    The file is created in a directory, hidden from the other
+///             processes where the system allows it, and deleted when it is
+///             closed. It grows by segments of several slots, which are
+///             mapped once and stay mapped until the file is closed, so
+///             that the data of a slot keeps its address.
+///
+///             The swap file is not thread safe, it is guarded by the
+///             FTilePool that uses it.
+class FSwapFile
+{
+public:
+    /*! Destructor, unmaps and deletes the file. */
+    ~FSwapFile();
+
+    /*! Constructor, with the size of the slots in bytes. */
+    FSwapFile( uint64 iSlotSize );
+
+    FSwapFile( const FSwapFile& ) = delete;
+    FSwapFile& operator=( const FSwapFile& ) = delete;
+
+    /*!
+        Create the file in iDirectory, the temporary directory of the system
+        if empty. Returns false if the file cannot be created.
+    */
+    bool Open( const std::string& iDirectory );
+
+    /*! Check whether the file is open. */
+    bool IsOpen() const;
+
+    /*!
+        Get a free slot, the file grows if needed.
+        Returns -1 if the file cannot grow.
+    */
+    int64 AllocateSlot();
+
+    /*! Give back a slot. */
+    void FreeSlot( int64 iSlot );
+
+    /*! Mapped data of a slot. */
+    uint8* SlotData( int64 iSlot ) const;
+
+    /*! Size of the file, in bytes. */
+    uint64 Size() const;
+
+private:
+    const uint64 mSlotSize;
+    const uint64 mSlotsPerSegment;
+    const uint64 mSegmentSize;
+    intptr_t mFile;
+    std::vector< uint8* > mSegments;
+    std::vector< void* > mMappings;
+    std::vector< int64 > mFreeSlots;
+};
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,42 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SwapFile_Generic.inl
+* @author       Clement Berthaud
+* @brief        This file provides the scratch file tools for the FSwapFile class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Sparse/SwapFile.h"
+
+ULIS_NAMESPACE_BEGIN
+namespace detail {
+
+// No scratch file, the tiles stay in memory.
+static const intptr_t InvalidScratchFile = -1;
+
+intptr_t OpenScratchFile( const std::string& ) {
+    return  InvalidScratchFile;
+}
+
+bool ResizeScratchFile( intptr_t, uint64 ) {
+    return  false;
+}
+
+uint8* MapScratchSegment( intptr_t, uint64, uint64, void** oMapping ) {
+    *oMapping = nullptr;
+    return  nullptr;
+}
+
+void UnmapScratchSegment( uint8*, uint64, void* ) {
+}
+
+void CloseScratchFile( intptr_t ) {
+}
+
+} // namespace detail
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,66 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SwapFile_POSIX.inl
+* @author       Clement Berthaud
+* @brief        This file provides the scratch file tools for the FSwapFile class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Sparse/SwapFile.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+ULIS_NAMESPACE_BEGIN
+namespace detail {
+
+static const intptr_t InvalidScratchFile = -1;
+
+// The file is unlinked as soon as it is created, it is deleted by the
+// system when it is closed, even if the process crashes.
+intptr_t OpenScratchFile( const std::string& iDirectory ) {
+    std::string path = iDirectory + "/ULIS_swap_XXXXXX";
+    std::vector< char > name( path.begin(), path.end() );
+    name.push_back( '\0' );
+    const int fd = mkstemp( name.data() );
+    if( fd < 0 )
+        return  InvalidScratchFile;
+
+    unlink( name.data() );
+    return  fd;
+}
+
+// The blocks are reserved where the system allows it, so that a full disk
+// fails here rather than when the mapped memory is written.
+bool ResizeScratchFile( intptr_t iFile, uint64 iSize ) {
+#if defined( ULIS_LINUX )
+    return  posix_fallocate( static_cast< int >( iFile ), 0, static_cast< off_t >( iSize ) ) == 0;
+#else
+    return  ftruncate( static_cast< int >( iFile ), static_cast< off_t >( iSize ) ) == 0;
+#endif
+}
+
+uint8* MapScratchSegment( intptr_t iFile, uint64 iOffset, uint64 iSize, void** oMapping ) {
+    *oMapping = nullptr;
+    void* data = mmap( nullptr, iSize, PROT_READ | PROT_WRITE, MAP_SHARED, static_cast< int >( iFile ), static_cast< off_t >( iOffset ) );
+    return  data == MAP_FAILED ? nullptr : static_cast< uint8* >( data );
+}
+
+void UnmapScratchSegment( uint8* iData, uint64 iSize, void* ) {
+    munmap( iData, iSize );
+}
+
+void CloseScratchFile( intptr_t iFile ) {
+    close( static_cast< int >( iFile ) );
+}
+
+} // namespace detail
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,66 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SwapFile_Windows.inl
+* @author       Clement Berthaud
+* @brief        This file provides the scratch file tools for the FSwapFile class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Sparse/SwapFile.h"
+
+#include <windows.h>
+
+ULIS_NAMESPACE_BEGIN
+namespace detail {
+
+static const intptr_t InvalidScratchFile = reinterpret_cast< intptr_t >( INVALID_HANDLE_VALUE );
+
+// The file is deleted by the system when it is closed.
+intptr_t OpenScratchFile( const std::string& iDirectory ) {
+    char name[ MAX_PATH ];
+    if( GetTempFileNameA( iDirectory.c_str(), "ULS", 0, name ) == 0 )
+        return  InvalidScratchFile;
+
+    HANDLE file = CreateFileA( name, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr );
+    return  reinterpret_cast< intptr_t >( file );
+}
+
+bool ResizeScratchFile( intptr_t iFile, uint64 iSize ) {
+    HANDLE file = reinterpret_cast< HANDLE >( iFile );
+    LARGE_INTEGER size;
+    size.QuadPart = static_cast< LONGLONG >( iSize );
+    return  SetFilePointerEx( file, size, nullptr, FILE_BEGIN ) && SetEndOfFile( file );
+}
+
+// Each segment has its own mapping object, sized to the end of the segment.
+uint8* MapScratchSegment( intptr_t iFile, uint64 iOffset, uint64 iSize, void** oMapping ) {
+    const uint64 end = iOffset + iSize;
+    HANDLE mapping = CreateFileMappingA( reinterpret_cast< HANDLE >( iFile ), nullptr, PAGE_READWRITE, static_cast< DWORD >( end >> 32 ), static_cast< DWORD >( end & 0xFFFFFFFF ), nullptr );
+    *oMapping = mapping;
+    if( !mapping )
+        return  nullptr;
+
+    void* data = MapViewOfFile( mapping, FILE_MAP_ALL_ACCESS, static_cast< DWORD >( iOffset >> 32 ), static_cast< DWORD >( iOffset & 0xFFFFFFFF ), static_cast< SIZE_T >( iSize ) );
+    if( !data ) {
+        CloseHandle( mapping );
+        *oMapping = nullptr;
+    }
+    return  static_cast< uint8* >( data );
+}
+
+void UnmapScratchSegment( uint8* iData, uint64, void* iMapping ) {
+    UnmapViewOfFile( iData );
+    CloseHandle( static_cast< HANDLE >( iMapping ) );
+}
+
+void CloseScratchFile( intptr_t iFile ) {
+    CloseHandle( reinterpret_cast< HANDLE >( iFile ) );
+}
+
+} // namespace detail
+ULIS_NAMESPACE_END
+
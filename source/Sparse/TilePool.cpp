@@ -0,0 +1,690 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TilePool.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FTilePool class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Sparse/TilePool.h"
+#include "Sparse/LargeBlock.h"
+#include "Sparse/SwapFile.h"
+#include "Sparse/TiledBlock.h"
+#include "Image/Block.h"
+#include "Math/Math.h"
+#include "String/CRC32.h"
+#include "System/MemoryInfo/MemoryInfo.h"
+#include "zlib.h"
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+ULIS_NAMESPACE_BEGIN
+// Time of the last use of the tiles, in nanoseconds.
+static
+uint64
+Now()
+{
+    return  std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+FTilePool::~FTilePool()
+{
+    std::vector< FTiledBlock* > blocks( mTiledBlocks.begin(), mTiledBlocks.end() );
+    for( auto block : blocks )
+        delete  block;
+
+    PurgeAllNow();
+    ULIS_ASSERT( mPageIns.empty(), "Tile pool deleted with page-ins in flight" );
+    delete  mSwapFile;
+    delete  mEmptyTile;
+}
+
+FTilePool::FTilePool(
+      eFormat iFormat
+    , eMicro iMicro
+    , eMacro iMacro
+)
+    : IHasFormat( iFormat )
+    , mMicro( iMicro )
+    , mMacro( iMacro )
+    , mTileSize( static_cast< uint16 >( 1 << iMicro ) )
+    , mEmptyTile( new FBlock( mTileSize, mTileSize, iFormat ) )
+    , mRAMUsageCapTarget( std::numeric_limits< uint64 >::max() )
+    , mNumTiles( 0 )
+    , mLeastRecentlyUsed( nullptr )
+    , mMostRecentlyUsed( nullptr )
+    , mSwapFile( nullptr )
+    , mResidentBudget( std::numeric_limits< uint64 >::max() )
+    , mNumSwappedTiles( 0 )
+    , mNumEvictions( 0 )
+    , mNumPageIns( 0 )
+    , mPageInTime( 0 )
+    , mNumCompressedTiles( 0 )
+    , mCompressedBytes( 0 )
+    , mNumDecompressions( 0 )
+    , mDecompressionTime( 0 )
+{
+    memset( mEmptyTile->Bits(), 0, mEmptyTile->BytesTotal() );
+}
+
+uint16
+FTilePool::TileSize() const
+{
+    return  mTileSize;
+}
+
+uint8
+FTilePool::Micro() const
+{
+    return  mMicro;
+}
+
+uint8
+FTilePool::Macro() const
+{
+    return  mMacro;
+}
+
+uint64
+FTilePool::BytesPerTile() const
+{
+    return  mEmptyTile->BytesTotal();
+}
+
+FTiledBlock*
+FTilePool::CreateNewTiledBlock()
+{
+    return  new FTiledBlock( *this );
+}
+
+FLargeBlock*
+FTilePool::CreateNewLargeBlock( uint32 iWidth, uint32 iHeight )
+{
+    return  new FLargeBlock( *this, iWidth, iHeight );
+}
+
+void
+FTilePool::RequestTiledBlockDeletion( FTiledBlock* iBlock )
+{
+    ULIS_ASSERT( &iBlock->TilePool() == this, "Bad pool for tiled block deletion" );
+    delete  iBlock;
+}
+
+void
+FTilePool::SetRAMUsageCapTarget( uint64 iValue )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mRAMUsageCapTarget = iValue;
+    while( !mFreshTiles.empty() && ResidentBytes_Unsafe() > mRAMUsageCapTarget ) {
+        FTileElement* tile = mFreshTiles.back();
+        mFreshTiles.pop_back();
+        DeleteTile_Unsafe( tile );
+    }
+}
+
+uint64
+FTilePool::RAMUsageCapTarget() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mRAMUsageCapTarget;
+}
+
+uint64
+FTilePool::CurrentRAMUsage() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  ResidentBytes_Unsafe();
+}
+
+uint64
+FTilePool::NumFreshTilesAvailableForQuery() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mFreshTiles.size();
+}
+
+uint64
+FTilePool::NumDirtyHashedTilesCurrentlyInUse() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumTiles - mFreshTiles.size() - mHashedTiles.size();
+}
+
+uint64
+FTilePool::NumCorrectlyHashedTilesCurrentlyInUse() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mHashedTiles.size();
+}
+
+uint64
+FTilePool::NumRegisteredTiledBlocks() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mTiledBlocks.size();
+}
+
+void
+FTilePool::PurgeAllNow()
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    for( auto tile : mFreshTiles )
+        DeleteTile_Unsafe( tile );
+    mFreshTiles.clear();
+}
+
+bool
+FTilePool::EnableSwap( uint64 iResidentBudget, const std::string& iDirectory )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    if( !mSwapFile ) {
+        FSwapFile* file = new FSwapFile( BytesPerTile() );
+        if( !file->Open( iDirectory ) ) {
+            delete  file;
+            return  false;
+        }
+        mSwapFile = file;
+    }
+
+    mResidentBudget = iResidentBudget;
+    EnforceResidentBudget_Unsafe();
+    return  true;
+}
+
+bool
+FTilePool::IsSwapEnabled() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mSwapFile != nullptr;
+}
+
+void
+FTilePool::SetResidentBudget( uint64 iValue )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mResidentBudget = iValue;
+    EnforceResidentBudget_Unsafe();
+}
+
+uint64
+FTilePool::ResidentBudget() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mResidentBudget;
+}
+
+//static
+uint64
+FTilePool::DefaultResidentBudget()
+{
+    return  FMemoryInfo::TotalRAM() / 2;
+}
+
+uint64
+FTilePool::NumResidentTiles() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumTiles - mNumSwappedTiles - mNumCompressedTiles;
+}
+
+uint64
+FTilePool::NumSwappedTiles() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumSwappedTiles;
+}
+
+uint64
+FTilePool::SwapFileSize() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mSwapFile ? mSwapFile->Size() : 0;
+}
+
+uint64
+FTilePool::NumEvictions() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumEvictions;
+}
+
+uint64
+FTilePool::NumPageIns() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumPageIns;
+}
+
+uint64
+FTilePool::PageInTime() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mPageInTime;
+}
+
+uint64
+FTilePool::CompressColdTiles( uint64 iIdleTime )
+{
+    // The cold tiles are the first ones from the least recently used. They
+    // are pinned while they are compressed outside of the lock, with the
+    // time of their last use to tell whether they were used meanwhile.
+    std::vector< std::pair< FTileElement*, uint64 > > cold;
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        const uint64 now = Now();
+        const uint64 idle = iIdleTime * 1000000;
+        for( FTileElement* tile = mLeastRecentlyUsed; tile && tile->mLastUse + idle <= now; tile = tile->mNext ) {
+            if( tile->mNumPins == 0 ) {
+                ++( tile->mNumPins );
+                cold.emplace_back( tile, tile->mLastUse );
+            }
+        }
+    }
+
+    const uint64 bytes = BytesPerTile();
+    const uint8 bpp = BytesPerPixel();
+    std::vector< uint8 > scratch( compressBound( static_cast< uLong >( bytes ) ) );
+    uint64 count = 0;
+    for( auto& entry : cold ) {
+        FTileElement* tile = entry.first;
+        const uint8* bits = tile->mBlock->Bits();
+        bool uniform = true;
+        for( uint64 i = bpp; i < bytes && uniform; i += bpp )
+            uniform = memcmp( bits, bits + i, bpp ) == 0;
+
+        // A single pixel for a uniform tile, a zlib stream otherwise, which
+        // is always larger than a pixel.
+        uint8* packed = nullptr;
+        uLongf size = bpp;
+        if( uniform ) {
+            packed = new uint8[ size ];
+            memcpy( packed, bits, size );
+        } else {
+            size = static_cast< uLongf >( scratch.size() );
+            if( compress2( scratch.data(), &size, bits, static_cast< uLong >( bytes ), Z_BEST_SPEED ) == Z_OK && size > bpp && size < bytes ) {
+                packed = new uint8[ size ];
+                memcpy( packed, scratch.data(), size );
+            }
+        }
+
+        std::lock_guard< std::mutex > lock( mMutex );
+        --( tile->mNumPins );
+        const bool used = tile->mNumPins > 0 || tile->mLastUse != entry.second;
+        if( !packed || used || tile->mRefCount == 0 ) {
+            delete [] packed;
+            if( tile->mNumPins == 0 && tile->mRefCount == 0 )
+                RecycleTile_Unsafe( tile );
+            continue;
+        }
+
+        UnhashTile_Unsafe( tile );
+        UnlinkUsed_Unsafe( tile );
+        tile->mBlock->LoadFromData( nullptr, mTileSize, mTileSize, Format(), nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ) );
+        tile->mPacked = packed;
+        tile->mPackedSize = static_cast< uint32 >( size );
+        tile->bResident = false;
+        ++mNumCompressedTiles;
+        mCompressedBytes += size;
+        ++count;
+    }
+    return  count;
+}
+
+uint64
+FTilePool::NumCompressedTiles() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumCompressedTiles;
+}
+
+uint64
+FTilePool::CompressedBytes() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mCompressedBytes;
+}
+
+float
+FTilePool::CompressionRatio() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mCompressedBytes ? static_cast< float >( mNumCompressedTiles * BytesPerTile() ) / mCompressedBytes : 1.f;
+}
+
+uint64
+FTilePool::NumDecompressions() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mNumDecompressions;
+}
+
+uint64
+FTilePool::DecompressionTime() const
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    return  mDecompressionTime;
+}
+
+const FBlock&
+FTilePool::EmptyTile() const
+{
+    return  *mEmptyTile;
+}
+
+FTileElement*
+FTilePool::QueryFreshTile()
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    FTileElement* tile = nullptr;
+    if( mFreshTiles.empty() ) {
+        tile = new FTileElement( new FBlock( mTileSize, mTileSize, Format() ) );
+        ++mNumTiles;
+    } else {
+        tile = mFreshTiles.back();
+        mFreshTiles.pop_back();
+    }
+    tile->mRefCount = 1;
+    tile->mLastUse = Now();
+
+    // The new tile cannot be evicted before it is pinned a first time.
+    EnforceResidentBudget_Unsafe();
+    return  tile;
+}
+
+void
+FTilePool::RetainTile( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    ++( iTile->mRefCount );
+}
+
+void
+FTilePool::ReleaseTile( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    ULIS_ASSERT( iTile->mRefCount > 0, "Bad RefCount on Release Tile" );
+    if( --( iTile->mRefCount ) == 0 && iTile->mNumPins == 0 )
+        RecycleTile_Unsafe( iTile );
+}
+
+void
+FTilePool::PinTile( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    ++( iTile->mNumPins );
+    iTile->mLastUse = Now();
+    if( iTile->bResident ) {
+        UnlinkUsed_Unsafe( iTile );
+        LinkUsed_Unsafe( iTile );
+    }
+}
+
+void
+FTilePool::UnpinTile( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    ULIS_ASSERT( iTile->mNumPins > 0, "Bad pin count on Unpin Tile" );
+    if( --( iTile->mNumPins ) > 0 )
+        return;
+
+    if( iTile->mRefCount == 0 )
+        RecycleTile_Unsafe( iTile );
+    else
+        EnforceResidentBudget_Unsafe();
+}
+
+bool
+FTilePool::MakeWritable( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    if( iTile->mRefCount != 1 )
+        return  false;
+
+    UnhashTile_Unsafe( iTile );
+    return  true;
+}
+
+FTileElement*
+FTilePool::Deduplicate( FTileElement* iTile )
+{
+    // The tile is pinned while its content is read outside of the lock, so
+    // that it is not evicted meanwhile.
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        if( !iTile->bDirty || !iTile->bResident )
+            return  iTile;
+        ++( iTile->mNumPins );
+    }
+
+    const uint64 bytes = BytesPerTile();
+    const uint8* bits = iTile->mBlock->Bits();
+    const bool empty = memcmp( bits, mEmptyTile->Bits(), bytes ) == 0;
+    const uint32 hash = empty ? 0 : CRC32( bits, static_cast< int >( bytes ) );
+    std::lock_guard< std::mutex > lock( mMutex );
+    --( iTile->mNumPins );
+    if( empty )
+        return  nullptr;
+
+    auto range = mHashedTiles.equal_range( hash );
+    for( auto it = range.first; it != range.second; ++it ) {
+        if( memcmp( it->second->mBlock->Bits(), bits, bytes ) == 0 ) {
+            ++( it->second->mRefCount );
+            return  it->second;
+        }
+    }
+
+    iTile->mHash = hash;
+    iTile->bDirty = false;
+    mHashedTiles.emplace( hash, iTile );
+    return  iTile;
+}
+
+bool
+FTilePool::RequestPageIn( FTileElement* iTile, FEvent* oEvent, bool* oNew )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    ULIS_ASSERT( iTile->mNumPins > 0, "Page-in requested for a tile that is not pinned" );
+    if( iTile->bResident )
+        return  false;
+
+    auto it = mPageIns.find( iTile );
+    *oNew = it == mPageIns.end();
+    if( *oNew )
+        it = mPageIns.emplace( iTile, FEvent() ).first;
+    *oEvent = it->second;
+    return  true;
+}
+
+void
+FTilePool::PageIn( FTileElement* iTile )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mPageIns.erase( iTile );
+    if( iTile->bResident )
+        return;
+
+    const uint64 start = Now();
+    const uint64 bytes = BytesPerTile();
+    uint8* data = new uint8[ bytes ];
+    if( iTile->mSwapSlot >= 0 ) {
+        memcpy( data, mSwapFile->SlotData( iTile->mSwapSlot ), bytes );
+        mSwapFile->FreeSlot( iTile->mSwapSlot );
+        iTile->mSwapSlot = -1;
+        --mNumSwappedTiles;
+        ++mNumPageIns;
+        mPageInTime += Now() - start;
+    } else {
+        Unpack( iTile, data );
+        mCompressedBytes -= iTile->mPackedSize;
+        delete [] iTile->mPacked;
+        iTile->mPacked = nullptr;
+        iTile->mPackedSize = 0;
+        --mNumCompressedTiles;
+        ++mNumDecompressions;
+        mDecompressionTime += Now() - start;
+    }
+    iTile->mBlock->LoadFromData( data, mTileSize, mTileSize, Format(), nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ) );
+    iTile->bResident = true;
+    iTile->mLastUse = Now();
+    LinkUsed_Unsafe( iTile );
+    EnforceResidentBudget_Unsafe();
+}
+
+void
+FTilePool::RegisterTiledBlock( FTiledBlock* iBlock )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mTiledBlocks.insert( iBlock );
+}
+
+void
+FTilePool::UnregisterTiledBlock( FTiledBlock* iBlock )
+{
+    std::lock_guard< std::mutex > lock( mMutex );
+    mTiledBlocks.erase( iBlock );
+}
+
+void
+FTilePool::RecycleTile_Unsafe( FTileElement* iTile )
+{
+    UnhashTile_Unsafe( iTile );
+    UnlinkUsed_Unsafe( iTile );
+    if( !iTile->bResident || ResidentBytes_Unsafe() > FMath::Min( mRAMUsageCapTarget, mResidentBudget ) ) {
+        DeleteTile_Unsafe( iTile );
+        return;
+    }
+
+    mFreshTiles.push_back( iTile );
+}
+
+void
+FTilePool::UnhashTile_Unsafe( FTileElement* iTile )
+{
+    if( iTile->bDirty )
+        return;
+
+    auto range = mHashedTiles.equal_range( iTile->mHash );
+    for( auto it = range.first; it != range.second; ++it ) {
+        if( it->second == iTile ) {
+            mHashedTiles.erase( it );
+            break;
+        }
+    }
+    iTile->mHash = 0;
+    iTile->bDirty = true;
+}
+
+void
+FTilePool::DeleteTile_Unsafe( FTileElement* iTile )
+{
+    if( iTile->mSwapSlot >= 0 ) {
+        mSwapFile->FreeSlot( iTile->mSwapSlot );
+        --mNumSwappedTiles;
+    } else if( iTile->mPacked ) {
+        mCompressedBytes -= iTile->mPackedSize;
+        delete [] iTile->mPacked;
+        --mNumCompressedTiles;
+    }
+    delete  iTile->mBlock;
+    delete  iTile;
+    --mNumTiles;
+}
+
+void
+FTilePool::LinkUsed_Unsafe( FTileElement* iTile )
+{
+    iTile->mPrevious = mMostRecentlyUsed;
+    iTile->mNext = nullptr;
+    if( mMostRecentlyUsed )
+        mMostRecentlyUsed->mNext = iTile;
+    else
+        mLeastRecentlyUsed = iTile;
+    mMostRecentlyUsed = iTile;
+}
+
+void
+FTilePool::UnlinkUsed_Unsafe( FTileElement* iTile )
+{
+    if( iTile->mPrevious )
+        iTile->mPrevious->mNext = iTile->mNext;
+    else if( mLeastRecentlyUsed == iTile )
+        mLeastRecentlyUsed = iTile->mNext;
+    else
+        return;
+
+    if( iTile->mNext )
+        iTile->mNext->mPrevious = iTile->mPrevious;
+    else
+        mMostRecentlyUsed = iTile->mPrevious;
+    iTile->mPrevious = nullptr;
+    iTile->mNext = nullptr;
+}
+
+void
+FTilePool::EnforceResidentBudget_Unsafe()
+{
+    if( !mSwapFile )
+        return;
+
+    // Tiles kept for the next queries go first, then the least recently
+    // used tiles that are not pinned.
+    while( !mFreshTiles.empty() && ResidentBytes_Unsafe() > mResidentBudget ) {
+        DeleteTile_Unsafe( mFreshTiles.back() );
+        mFreshTiles.pop_back();
+    }
+
+    FTileElement* tile = mLeastRecentlyUsed;
+    while( tile && ResidentBytes_Unsafe() > mResidentBudget ) {
+        FTileElement* next = tile->mNext;
+        if( tile->mNumPins == 0 && !EvictTile_Unsafe( tile ) )
+            return;
+        tile = next;
+    }
+}
+
+bool
+FTilePool::EvictTile_Unsafe( FTileElement* iTile )
+{
+    const int64 slot = mSwapFile->AllocateSlot();
+    if( slot < 0 )
+        return  false;
+
+    UnhashTile_Unsafe( iTile );
+    UnlinkUsed_Unsafe( iTile );
+    memcpy( mSwapFile->SlotData( slot ), iTile->mBlock->Bits(), BytesPerTile() );
+    iTile->mBlock->LoadFromData( nullptr, mTileSize, mTileSize, Format(), nullptr, FOnInvalidBlock(), FOnCleanupData( &OnCleanup_FreeMemory ) );
+    iTile->mSwapSlot = slot;
+    iTile->bResident = false;
+    ++mNumSwappedTiles;
+    ++mNumEvictions;
+    return  true;
+}
+
+void
+FTilePool::Unpack( const FTileElement* iTile, uint8* oData ) const
+{
+    const uint64 bytes = BytesPerTile();
+    const uint8 bpp = BytesPerPixel();
+    if( iTile->mPackedSize == bpp ) {
+        for( uint64 i = 0; i < bytes; i += bpp )
+            memcpy( oData + i, iTile->mPacked, bpp );
+        return;
+    }
+
+    uLongf size = static_cast< uLongf >( bytes );
+    uncompress( oData, &size, iTile->mPacked, iTile->mPackedSize );
+    ULIS_ASSERT( size == bytes, "Bad compressed tile" );
+}
+
+uint64
+FTilePool::ResidentBytes_Unsafe() const
+{
+    return  ( mNumTiles - mNumSwappedTiles - mNumCompressedTiles ) * BytesPerTile() + mCompressedBytes;
+}
+
+ULIS_NAMESPACE_END
+
@@ -0,0 +1,281 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TiledBlock.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FTiledBlock class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "Sparse/TiledBlock.h"
+#include "Image/Block.h"
+#include <cstring>
+
+ULIS_NAMESPACE_BEGIN
+FTiledBlock::~FTiledBlock()
+{
+    Clear();
+    mTilePool.UnregisterTiledBlock( this );
+}
+
+FTiledBlock::FTiledBlock( FTilePool& iPool )
+    : IHasFormat( iPool.Format() )
+    , mTilePool( iPool )
+    , mNumTiles( 0 )
+    , mRect()
+    , bRectDirty( false )
+    , mBounds()
+    , bBounded( false )
+{
+    mTilePool.RegisterTiledBlock( this );
+}
+
+FTiledBlock::FTiledBlock( FTilePool& iPool, const FRectI& iBounds )
+    : IHasFormat( iPool.Format() )
+    , mTilePool( iPool )
+    , mNumTiles( 0 )
+    , mRect()
+    , bRectDirty( false )
+    , mBounds( iBounds )
+    , bBounded( true )
+{
+    mTilePool.RegisterTiledBlock( this );
+}
+
+FTilePool&
+FTiledBlock::TilePool() const
+{
+    return  mTilePool;
+}
+
+uint16
+FTiledBlock::TileSize() const
+{
+    return  mTilePool.TileSize();
+}
+
+uint64
+FTiledBlock::NumTiles() const
+{
+    return  mNumTiles;
+}
+
+FRectI
+FTiledBlock::Rect() const
+{
+    if( bRectDirty ) {
+        mRect = FRectI();
+        for( auto& it : mSparseMap ) {
+            const FRootChunk& root = it.second;
+            for( uint32 i = 0; i < root.mTiles.size(); ++i )
+                if( root.mTiles[i] )
+                    mRect = mRect.UnionLeaveEmpty( TileRect( TileCoordinatesFromKey( it.first, i ) ) );
+        }
+        bRectDirty = false;
+    }
+    return  mRect;
+}
+
+bool
+FTiledBlock::IsBounded() const
+{
+    return  bBounded;
+}
+
+const FRectI&
+FTiledBlock::Bounds() const
+{
+    return  mBounds;
+}
+
+FVec2I
+FTiledBlock::TileCoordinatesFromPixelCoordinates( const FVec2I& iPos ) const
+{
+    const uint8 micro = mTilePool.Micro();
+    return  FVec2I( iPos.x >> micro, iPos.y >> micro );
+}
+
+FRectI
+FTiledBlock::TileRect( const FVec2I& iTile ) const
+{
+    const int size = mTilePool.TileSize();
+    return  FRectI( iTile.x * size, iTile.y * size, size, size );
+}
+
+FRectI
+FTiledBlock::TileRange( const FRectI& iRect ) const
+{
+    if( iRect.w <= 0 || iRect.h <= 0 )
+        return  FRectI();
+
+    const uint8 micro = mTilePool.Micro();
+    return  FRectI::FromMinMax(
+          iRect.x >> micro
+        , iRect.y >> micro
+        , ( ( iRect.x + iRect.w - 1 ) >> micro ) + 1
+        , ( ( iRect.y + iRect.h - 1 ) >> micro ) + 1
+    );
+}
+
+const FBlock*
+FTiledBlock::QueryConstBlockAtPixelCoordinates( const FVec2I& iPos, FVec2I* oLocalCoords ) const
+{
+    const FVec2I coords = TileCoordinatesFromPixelCoordinates( iPos );
+    if( oLocalCoords )
+        *oLocalCoords = iPos - TileRect( coords ).Position();
+
+    FTileElement* tile = QueryTile( coords );
+    if( !tile )
+        return  &( mTilePool.EmptyTile() );
+
+    mTilePool.PageIn( tile );
+    return  tile->mBlock;
+}
+
+FTileElement**
+FTiledBlock::QueryOneMutableTileElementForImminentDirtyOperationAtPixelCoordinates( const FVec2I& iPos, FVec2I* oLocalCoords )
+{
+    const FVec2I coords = TileCoordinatesFromPixelCoordinates( iPos );
+    if( oLocalCoords )
+        *oLocalCoords = iPos - TileRect( coords ).Position();
+
+    // The tile is pinned so that it is not evicted by the fresh tile, which
+    // is pinned once so that it can be evicted later.
+    FTileElement* tile = QueryTile( coords );
+    if( tile ) {
+        mTilePool.PinTile( tile );
+        mTilePool.PageIn( tile );
+    }
+
+    if( !tile || !mTilePool.MakeWritable( tile ) ) {
+        FTileElement* fresh = mTilePool.QueryFreshTile();
+        if( tile )
+            memcpy( fresh->mBlock->Bits(), tile->mBlock->Bits(), mTilePool.BytesPerTile() );
+        else
+            memset( fresh->mBlock->Bits(), 0, mTilePool.BytesPerTile() );
+        SetTile( coords, fresh );
+        mTilePool.PinTile( fresh );
+        mTilePool.UnpinTile( fresh );
+        mTilePool.ReleaseTile( fresh );
+    }
+
+    if( tile )
+        mTilePool.UnpinTile( tile );
+
+    uint32 index = 0;
+    const uint64 key = KeyFromTileCoordinates( coords, &index );
+    return  &( mSparseMap[ key ].mTiles[ index ] );
+}
+
+void
+FTiledBlock::Clear()
+{
+    for( auto& it : mSparseMap )
+        for( auto tile : it.second.mTiles )
+            if( tile )
+                mTilePool.ReleaseTile( tile );
+
+    mSparseMap.clear();
+    mNumTiles = 0;
+    mRect = FRectI();
+    bRectDirty = false;
+}
+
+void
+FTiledBlock::SanitizeNow()
+{
+    // Gather the changes first, emptying a tile can remove its root chunk.
+    std::vector< std::pair< FVec2I, FTileElement* > > changes;
+    for( auto& it : mSparseMap ) {
+        const FRootChunk& root = it.second;
+        for( uint32 i = 0; i < root.mTiles.size(); ++i ) {
+            FTileElement* tile = root.mTiles[i];
+            if( !tile )
+                continue;
+
+            FTileElement* sanitized = mTilePool.Deduplicate( tile );
+            if( sanitized != tile )
+                changes.emplace_back( TileCoordinatesFromKey( it.first, i ), sanitized );
+        }
+    }
+
+    for( auto& change : changes ) {
+        SetTile( change.first, change.second );
+        if( change.second )
+            mTilePool.ReleaseTile( change.second );
+    }
+}
+
+FTileElement*
+FTiledBlock::QueryTile( const FVec2I& iTile ) const
+{
+    uint32 index = 0;
+    auto it = mSparseMap.find( KeyFromTileCoordinates( iTile, &index ) );
+    return  it == mSparseMap.end() ? nullptr : it->second.mTiles[ index ];
+}
+
+void
+FTiledBlock::SetTile( const FVec2I& iTile, FTileElement* iElement )
+{
+    uint32 index = 0;
+    const uint64 key = KeyFromTileCoordinates( iTile, &index );
+    auto it = mSparseMap.find( key );
+    if( it == mSparseMap.end() ) {
+        if( !iElement )
+            return;
+
+        const uint32 side = 1 << mTilePool.Macro();
+        it = mSparseMap.emplace( key, FRootChunk{ std::vector< FTileElement* >( side * side, nullptr ), 0 } ).first;
+    }
+
+    FRootChunk& root = it->second;
+    FTileElement* previous = root.mTiles[ index ];
+    if( previous == iElement )
+        return;
+
+    if( iElement )
+        mTilePool.RetainTile( iElement );
+    root.mTiles[ index ] = iElement;
+
+    if( !previous ) {
+        ++( root.mNumTiles );
+        ++mNumTiles;
+        if( !bRectDirty )
+            mRect = mRect.UnionLeaveEmpty( TileRect( iTile ) );
+    } else if( !iElement ) {
+        --( root.mNumTiles );
+        --mNumTiles;
+        bRectDirty = true;
+        if( root.mNumTiles == 0 )
+            mSparseMap.erase( it );
+    }
+
+    if( previous )
+        mTilePool.ReleaseTile( previous );
+}
+
+uint64
+FTiledBlock::KeyFromTileCoordinates( const FVec2I& iTile, uint32* oIndex ) const
+{
+    const uint8 macro = mTilePool.Macro();
+    const int mask = ( 1 << macro ) - 1;
+    *oIndex = ( ( iTile.y & mask ) << macro ) + ( iTile.x & mask );
+    const uint32 rx = static_cast< uint32 >( iTile.x >> macro );
+    const uint32 ry = static_cast< uint32 >( iTile.y >> macro );
+    return  ( static_cast< uint64 >( rx ) << 32 ) | ry;
+}
+
+FVec2I
+FTiledBlock::TileCoordinatesFromKey( uint64 iKey, uint32 iIndex ) const
+{
+    const uint8 macro = mTilePool.Macro();
+    const int mask = ( 1 << macro ) - 1;
+    const int rx = static_cast< int32 >( static_cast< uint32 >( iKey >> 32 ) );
+    const int ry = static_cast< int32 >( static_cast< uint32 >( iKey ) );
+    return  FVec2I( rx * ( mask + 1 ) + ( iIndex & mask ), ry * ( mask + 1 ) + ( iIndex >> macro ) );
+}
+
+ULIS_NAMESPACE_END
+
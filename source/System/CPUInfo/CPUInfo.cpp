@@ -296,5 +296,66 @@ FCPUInfo::L1CacheLineSize()
     return  detail::sgCPUInfo_private_instance.l1_cache_line_size;
 }
 
+//static
+uint32
+FCPUInfo::L2CacheSize()
+{
+    return  detail::sgCPUInfo_private_instance.l2_cache_size;
+}
+
+//static
+uint32
+FCPUInfo::NumLogicalCores()
+{
+    return  static_cast< uint32 >( detail::sgCPUInfo_private_instance.logical_cores.size() );
+}
+
+//static
+uint32
+FCPUInfo::NumPhysicalCores()
+{
+    return  detail::sgCPUInfo_private_instance.num_physical_cores;
+}
+
+//static
+uint32
+FCPUInfo::NumNUMANodes()
+{
+    return  detail::sgCPUInfo_private_instance.num_numa_nodes;
+}
+
+//static
+uint32
+FCPUInfo::LogicalCoreID( uint32 iIndex )
+{
+    ULIS_ASSERT( iIndex < NumLogicalCores(), "Bad logical core index" );
+    return  detail::sgCPUInfo_private_instance.logical_cores[ iIndex ].id;
+}
+
+//static
+uint32
+FCPUInfo::PhysicalCore( uint32 iIndex )
+{
+    ULIS_ASSERT( iIndex < NumLogicalCores(), "Bad logical core index" );
+    return  detail::sgCPUInfo_private_instance.logical_cores[ iIndex ].core;
+}
+
+//static
+uint32
+FCPUInfo::NUMANode( uint32 iIndex )
+{
+    ULIS_ASSERT( iIndex < NumLogicalCores(), "Bad logical core index" );
+    return  detail::sgCPUInfo_private_instance.logical_cores[ iIndex ].node;
+}
+
+//static
+uint32
+FCPUInfo::CacheGroup( uint32 iIndex, uint8 iLevel )
+{
+    ULIS_ASSERT( iIndex < NumLogicalCores(), "Bad logical core index" );
+    ULIS_ASSERT( iLevel >= 1 && iLevel <= 3, "Bad cache level" );
+    return  detail::sgCPUInfo_private_instance.logical_cores[ iIndex ].cache_group[ iLevel - 1 ];
+}
+
 ULIS_NAMESPACE_END
 
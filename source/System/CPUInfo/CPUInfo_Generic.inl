@@ -12,6 +12,7 @@
 #pragma once
 #include "System/CPUInfo/CPUInfo.h"
 #include "System/CPUInfo/CPUInfoHelpers.h"
+#include "System/CPUInfo/CPUInfo_Private.h"
 
 #pragma message( "GENERIC DEVICE ACTIVATED" )
 
@@ -52,6 +53,10 @@ uint32 num_workers() {
     return  1;
 }
 
+void cpu_topology( std::vector< FLogicalCoreInfo >* oCores ) {
+    // Not detected, a flat topology is assumed.
+}
+
 } // namespace detail
 
 ULIS_NAMESPACE_END
@@ -12,14 +12,19 @@
 #pragma once
 #include "System/CPUInfo/CPUInfo.h"
 #include "System/CPUInfo/CPUInfoHelpers.h"
+#include "System/CPUInfo/CPUInfo_Private.h"
 
 #include <cpuid.h>
+#include <sched.h>
 //#include <intrin.h>
 #include <stdint.h>
 #include <string>
 #include <stdlib.h>
 #include <thread>
 #include <stdio.h>
+#include <map>
+#include <utility>
+#include <vector>
 
 ULIS_NAMESPACE_BEGIN
 
@@ -88,22 +93,42 @@ get_vendor_string() {
     return  name;
 }
 
-size_t cache_line_size() {
-    FILE * p = 0;
-    p = fopen("/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size", "r");
+FILE* open_cache_file( int iIndex, const char* iName ) {
+    char path[128];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/%s", iIndex, iName);
+    return fopen(path, "r");
+}
+
+size_t cache_line_size( int iIndex ) {
+    FILE * p = open_cache_file( iIndex, "coherency_line_size" );
     unsigned int i = 0;
     if (p) {
-        fscanf(p, "%d", &i);
+        fscanf(p, "%u", &i);
         fclose(p);
     }
     return i;
 }
 
-
-size_t cache_size() {
-    FILE * p = 0;
-    p = fopen("/sys/devices/system/cpu/cpu0/cache/index0/size", "r");
+size_t cache_size( int iIndex ) {
+    // The size is written with a unit suffix, such as 48K.
+    FILE * p = open_cache_file( iIndex, "size" );
     unsigned int i = 0;
+    char unit = 0;
+    if (p) {
+        if( fscanf(p, "%u%c", &i, &unit) == 2 ) {
+            if( unit == 'K' )
+                i *= 1024;
+            else if( unit == 'M' )
+                i *= 1024 * 1024;
+        }
+        fclose(p);
+    }
+    return i;
+}
+
+int cache_level( int iIndex ) {
+    FILE * p = open_cache_file( iIndex, "level" );
+    int i = -1;
     if (p) {
         fscanf(p, "%d", &i);
         fclose(p);
@@ -111,15 +136,163 @@ size_t cache_size() {
     return i;
 }
 
+bool cache_holds_data( int iIndex ) {
+    // Data or Unified, but not Instruction.
+    FILE * p = open_cache_file( iIndex, "type" );
+    char type[16] = { 0 };
+    if (p) {
+        fscanf(p, "%15s", type);
+        fclose(p);
+    }
+    return type[0] == 'D' || type[0] == 'U';
+}
+
 void cache_info( uint8 iLevel, uint32 *oCacheSize, uint32* oLineSize ) {
-    *oCacheSize = static_cast< uint32 >( cache_size() );
-    *oLineSize = static_cast< uint32 >( cache_line_size() );
+    // Caches of the first cpu are listed as index0, index1, ... in no
+    // particular order, the outputs are left untouched if none matches.
+    for( int index = 0; ; ++index ) {
+        const int level = cache_level( index );
+        if( level < 0 )
+            return;
+
+        if( level == iLevel && cache_holds_data( index ) ) {
+            *oCacheSize = static_cast< uint32 >( cache_size( index ) );
+            *oLineSize = static_cast< uint32 >( cache_line_size( index ) );
+            return;
+        }
+    }
 }
 
 uint32 num_workers() {
     return  std::thread::hardware_concurrency();
 }
 
+bool read_uint( const char* iPath, uint32* oValue ) {
+    FILE * p = fopen( iPath, "r" );
+    if( !p )
+        return false;
+    const bool ok = fscanf( p, "%u", oValue ) == 1;
+    fclose( p );
+    return ok;
+}
+
+bool read_cpu_list( const char* iPath, std::vector< uint32 >* oList ) {
+    // Lists are written as ranges, such as 0-3,8-11,16.
+    FILE * p = fopen( iPath, "r" );
+    if( !p )
+        return false;
+    unsigned int beg = 0;
+    unsigned int end = 0;
+    char sep = 0;
+    while( fscanf( p, "%u", &beg ) == 1 ) {
+        end = beg;
+        if( fscanf( p, "%c", &sep ) == 1 && sep == '-' ) {
+            if( fscanf( p, "%u", &end ) != 1 )
+                break;
+            fscanf( p, "%c", &sep );
+        }
+        for( unsigned int i = beg; i <= end; ++i )
+            oList->push_back( i );
+        if( sep != ',' )
+            break;
+    }
+    fclose( p );
+    return !oList->empty();
+}
+
+uint32 dense_index( std::map< std::pair< uint32, uint32 >, uint32 >& ioMap, uint32 iKey0, uint32 iKey1 ) {
+    // Indices are given in order of first appearance.
+    auto it = ioMap.find( std::make_pair( iKey0, iKey1 ) );
+    if( it != ioMap.end() )
+        return  it->second;
+    const uint32 index = static_cast< uint32 >( ioMap.size() );
+    ioMap[ std::make_pair( iKey0, iKey1 ) ] = index;
+    return  index;
+}
+
+void cpu_topology( std::vector< FLogicalCoreInfo >* oCores ) {
+    // Only the logical cores this process is allowed to run on are listed,
+    // cpusets of containers or taskset are honored that way.
+    std::vector< uint32 > ids;
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+        for( uint32 i = 0; i < CPU_SETSIZE; ++i )
+            if( CPU_ISSET( i, &set ) )
+                ids.push_back( i );
+    }
+    if( ids.empty() && !read_cpu_list( "/sys/devices/system/cpu/online", &ids ) )
+        return;
+
+    // NUMA nodes, the whole machine is a single node without NUMA support.
+    std::map< uint32, uint32 > nodeOf;
+    std::vector< uint32 > nodes;
+    read_cpu_list( "/sys/devices/system/node/online", &nodes );
+    for( uint32 node : nodes ) {
+        char path[128];
+        std::vector< uint32 > cpus;
+        snprintf( path, sizeof( path ), "/sys/devices/system/node/node%u/cpulist", node );
+        read_cpu_list( path, &cpus );
+        for( uint32 cpu : cpus )
+            nodeOf[ cpu ] = node;
+    }
+
+    std::map< std::pair< uint32, uint32 >, uint32 > cores;
+    std::map< std::pair< uint32, uint32 >, uint32 > nodeIndices;
+    std::map< std::pair< uint32, uint32 >, uint32 > groups[3];
+    oCores->reserve( ids.size() );
+    for( uint32 id : ids ) {
+        char path[128];
+        uint32 package = 0;
+        uint32 coreId = id;
+        snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", id );
+        read_uint( path, &package );
+        snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/topology/core_id", id );
+        read_uint( path, &coreId );
+
+        FLogicalCoreInfo info;
+        info.id = id;
+        info.core = dense_index( cores, package, coreId );
+        auto node = nodeOf.find( id );
+        info.node = dense_index( nodeIndices, node == nodeOf.end() ? 0 : node->second, 0 );
+
+        // A cache is identified by the first logical core that shares it.
+        // Private caches default to the physical core, the L3 to the package.
+        uint32 owner[3] = { info.core, info.core, package };
+        uint32 kind[3] = { 0, 0, 1 };
+        for( int index = 0; ; ++index ) {
+            uint32 level = 0;
+            snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/cache/index%d/level", id, index );
+            if( !read_uint( path, &level ) )
+                break;
+            if( level < 1 || level > 3 )
+                continue;
+
+            // Skip instruction caches.
+            char type[16] = { 0 };
+            snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/cache/index%d/type", id, index );
+            FILE * p = fopen( path, "r" );
+            if( p ) {
+                fscanf( p, "%15s", type );
+                fclose( p );
+            }
+            if( type[0] == 'I' )
+                continue;
+
+            std::vector< uint32 > shared;
+            snprintf( path, sizeof( path ), "/sys/devices/system/cpu/cpu%u/cache/index%d/shared_cpu_list", id, index );
+            if( read_cpu_list( path, &shared ) ) {
+                owner[ level - 1 ] = shared[0];
+                kind[ level - 1 ] = 2;
+            }
+        }
+        for( int level = 0; level < 3; ++level )
+            info.cache_group[ level ] = dense_index( groups[ level ], kind[ level ], owner[ level ] );
+
+        oCores->push_back( info );
+    }
+}
+
 } // namespace detail
 
 ULIS_NAMESPACE_END
@@ -9,6 +9,7 @@
 */
 #include "System/CPUInfo/CPUInfo_Private.h"
 #include "System/CPUInfo/CPUInfoHelpers.h"
+#include "Math/Math.h"
 
 #if defined( ULIS_WIN )
 #include "System/CPUInfo/CPUInfo_Windows.inl"
@@ -26,8 +27,25 @@ FCPUInfo_Private::FCPUInfo_Private()
     , max_workers( static_cast< uint32 >( detail::num_workers() ) )
     , l1_cache_size( 65536 )
     , l1_cache_line_size( 64 )
+    , l2_cache_size( 262144 )
+    , num_physical_cores( 0 )
+    , num_numa_nodes( 0 )
 {
+    uint32 l2_cache_line_size = 0;
     detail::cache_info( 1, &l1_cache_size, &l1_cache_line_size );
+    detail::cache_info( 2, &l2_cache_size, &l2_cache_line_size );
+
+    // Without topology information, each worker is assumed to run on its
+    // own physical core, all of them sharing the last level cache.
+    detail::cpu_topology( &logical_cores );
+    if( logical_cores.empty() ) {
+        for( uint32 i = 0; i < max_workers; ++i )
+            logical_cores.push_back( FLogicalCoreInfo { i, i, 0, { i, i, 0 } } );
+    }
+    for( const FLogicalCoreInfo& info : logical_cores ) {
+        num_physical_cores = FMath::Max( num_physical_cores, info.core + 1 );
+        num_numa_nodes = FMath::Max( num_numa_nodes, info.node + 1 );
+    }
 
     features_bitfield |= ULIS_W_OS_X64( uint64( detail::detect_OS_x64() ) );
     features_bitfield |= ULIS_W_OS_AVX( uint64( detail::detect_OS_AVX() ) );
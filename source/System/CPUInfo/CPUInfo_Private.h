@@ -11,8 +11,24 @@
 */
 #pragma once
 #include "Core/Core.h"
+#include <vector>
 
 ULIS_NAMESPACE_BEGIN
+/// @class      FLogicalCoreInfo
+/// @brief      The FLogicalCoreInfo struct describes the place of a logical
+///             core in the CPU topology.
+/// @details    All indices but id are dense, starting at zero, so that they
+///             can be compared between logical cores: two logical cores with
+///             the same core are SMT siblings, two logical cores with the same
+///             cache_group[1] share a L2 cache, and so on.
+struct FLogicalCoreInfo
+{
+    uint32 id;              // OS index, as used for affinity.
+    uint32 core;            // Physical core.
+    uint32 node;            // NUMA node.
+    uint32 cache_group[3];  // Set of logical cores sharing the L1, L2, L3.
+};
+
 /// @class      FCPUInfo_Private
 /// @brief      The FCPUInfo_Private provides the internal mechanisms for
 ///             KCPUInfo.
@@ -25,6 +41,10 @@ struct FCPUInfo_Private
     uint32 max_workers;
     uint32 l1_cache_size;
     uint32 l1_cache_line_size;
+    uint32 l2_cache_size;
+    uint32 num_physical_cores;
+    uint32 num_numa_nodes;
+    std::vector< FLogicalCoreInfo > logical_cores;
 };
 
 ULIS_NAMESPACE_END
@@ -12,6 +12,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "System/CPUInfo/CPUInfoHelpers.h"
+#include "System/CPUInfo/CPUInfo_Private.h"
 
 #include <Windows.h>
 #include <intrin.h>
@@ -123,7 +124,7 @@ void cache_info( uint8 iLevel, uint32 *oCacheSize, uint32* oLineSize ) {
     GetLogicalProcessorInformation(&buffer[0], &buffer_size);
 
     for (i = 0; i != buffer_size / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION); ++i) {
-        if( buffer[i].Relationship == RelationCache && buffer[i].Cache.Level == iLevel ) {
+        if( buffer[i].Relationship == RelationCache && buffer[i].Cache.Level == iLevel && buffer[i].Cache.Type != CacheInstruction ) {
             *oLineSize  = static_cast< uint32 >( buffer[i].Cache.LineSize );
             *oCacheSize = static_cast< uint32 >( buffer[i].Cache.Size );
             break;
@@ -137,6 +138,10 @@ uint32 num_workers() {
     return  std::thread::hardware_concurrency();
 }
 
+void cpu_topology( std::vector< FLogicalCoreInfo >* oCores ) {
+    // Not detected, a flat topology is assumed.
+}
+
 } // namespace detail
 
 ULIS_NAMESPACE_END
@@ -12,6 +12,7 @@
 #pragma once
 #include "System/CPUInfo/CPUInfo.h"
 #include "System/CPUInfo/CPUInfoHelpers.h"
+#include "System/CPUInfo/CPUInfo_Private.h"
 
 #include <cpuid.h>
 // Check: maybe <intrin.h> for other versions of AppleCLANG ?
@@ -97,15 +98,15 @@ cache_line_size() {
 }
 
 size_t
-cache_size() {
+cache_size( uint8 iLevel ) {
     size_t line_size = 0;
     size_t sizeof_line_size = sizeof(line_size);
-    sysctlbyname("hw.l1dcachesize", &line_size, &sizeof_line_size, 0, 0);
+    sysctlbyname(iLevel == 1 ? "hw.l1dcachesize" : "hw.l2cachesize", &line_size, &sizeof_line_size, 0, 0);
     return line_size;
 }
 
 void cache_info( uint8 iLevel, uint32 *oCacheSize, uint32* oLineSize ) {
-    *oCacheSize = static_cast< uint32 >( cache_size() );
+    *oCacheSize = static_cast< uint32 >( cache_size( iLevel ) );
     *oLineSize = static_cast< uint32 >( cache_line_size() );
 }
 
@@ -113,6 +114,10 @@ uint32 num_workers() {
     return  std::thread::hardware_concurrency();
 }
 
+void cpu_topology( std::vector< FLogicalCoreInfo >* oCores ) {
+    // Not detected, a flat topology is assumed.
+}
+
 } // namespace detail
 
 ULIS_NAMESPACE_END
@@ -18,7 +18,6 @@
 #include <stdio.h>
 #include <string.h>
 #include <sys/times.h>
-#include <sys/vtimes.h>
 
 
 ULIS_NAMESPACE_BEGIN
@@ -183,7 +182,7 @@ void init_CPUCurrentlyUsedByProcess(){
 
 
 double CPUCurrentlyUsedByProcess() {
-    static int dummy = init_CPUCurrentlyUsedByProcess();
+    static int dummy = ( init_CPUCurrentlyUsedByProcess(), 0 );
     struct tms timeSample;
     clock_t now;
     double percent;
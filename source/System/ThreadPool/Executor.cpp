@@ -0,0 +1,39 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         Executor.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FCallbackExecutor class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "System/ThreadPool/Executor.h"
+#include "Math/Math.h"
+
+ULIS_NAMESPACE_BEGIN
+FCallbackExecutor::~FCallbackExecutor()
+{
+}
+
+FCallbackExecutor::FCallbackExecutor( uint32 iConcurrency, const FOnDispatchTask& iDispatch )
+    : mConcurrency( FMath::Max( iConcurrency, uint32( 1 ) ) )
+    , mDispatch( iDispatch )
+{
+}
+
+uint32
+FCallbackExecutor::Concurrency() const
+{
+    return  mConcurrency;
+}
+
+void
+FCallbackExecutor::Dispatch( fpExecutorTask iTask, void* iData, eCommandQueuePriority iPriority )
+{
+    mDispatch.Execute( iTask, iData, iPriority );
+}
+
+ULIS_NAMESPACE_END
+
@@ -18,8 +18,17 @@ FThreadPool::~FThreadPool()
     delete  d;
 }
 
-FThreadPool::FThreadPool( uint32 iNumWorkers )
-    : d( new FThreadPool_Private( iNumWorkers ) )
+FThreadPool::FThreadPool(
+      uint32 iNumWorkers
+    , eThreadPoolBackend iBackend
+    , eThreadPoolAffinity iAffinity
+)
+    : d( new FThreadPool_Private( iNumWorkers, iBackend, iAffinity ) )
+{
+}
+
+FThreadPool::FThreadPool( IExecutor& iExecutor )
+    : d( new FThreadPool_Private( &iExecutor ) )
 {
 }
 
@@ -41,6 +50,42 @@ FThreadPool::GetNumWorkers() const
     return  d->GetNumWorkers();
 }
 
+eThreadPoolBackend
+FThreadPool::Backend() const
+{
+    return  d->Backend();
+}
+
+eThreadPoolAffinity
+FThreadPool::Affinity() const
+{
+    return  d->Affinity();
+}
+
+void
+FThreadPool::SetWaitSpinCount( uint32 iSpinCount )
+{
+    d->SetWaitSpinCount( iSpinCount );
+}
+
+uint32
+FThreadPool::WaitSpinCount() const
+{
+    return  d->WaitSpinCount();
+}
+
+FThreadPoolStats
+FThreadPool::Stats() const
+{
+    return  d->Stats();
+}
+
+IExecutor*
+FThreadPool::Executor() const
+{
+    return  d->Executor();
+}
+
 //static
 uint32
 FThreadPool::MaxWorkers()
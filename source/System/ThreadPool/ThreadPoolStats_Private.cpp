@@ -0,0 +1,100 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ThreadPoolStats_Private.cpp
+* @author       Clement Berthaud
+* @brief        This file provides the definition for the FThreadPoolStats_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include "System/ThreadPool/ThreadPoolStats_Private.h"
+#include "Scheduling/SchedulingTrace_Private.h"
+#include "Math/Math.h"
+
+ULIS_NAMESPACE_BEGIN
+FThreadPoolStats_Private::FThreadPoolStats_Private( uint32 iNumSlots )
+    : mNumSlots( FMath::Max( iNumSlots, uint32( 1 ) ) )
+    , mSlots( new FSlot[ FMath::Max( iNumSlots, uint32( 1 ) ) ] )
+    , mNumCommands( 0 )
+    , mLastTime( FSchedulingTrace_Private::Now() )
+    , mLastBusyTime( 0 )
+    , mLastNumCommands( 0 )
+{
+}
+
+void
+FThreadPoolStats_Private::RecordJob( uint32 iSlot, uint64 iTime )
+{
+    FSlot& slot = mSlots[ iSlot ];
+    Bump( slot.mBusyTime, iTime );
+    Bump( slot.mNumJobs, 1 );
+    Bump( slot.mJobTime[ Bucket( iTime ) ], 1 );
+}
+
+void
+FThreadPoolStats_Private::RecordLatency( uint32 iSlot, uint64 iTime )
+{
+    Bump( mSlots[ iSlot ].mLatency[ Bucket( iTime ) ], 1 );
+}
+
+void
+FThreadPoolStats_Private::RecordCommand()
+{
+    // Commands finish on any worker, or on the scheduler when discarded.
+    mNumCommands.fetch_add( 1, std::memory_order_relaxed );
+}
+
+void
+FThreadPoolStats_Private::Sample( uint32 iNumWorkers, FThreadPoolStats* oStats ) const
+{
+    uint64 busyTime = 0;
+    oStats->numJobsFinished = 0;
+    for( uint32 b = 0; b < FThreadPoolStats::NumHistogramBuckets; ++b ) {
+        oStats->jobTimeHistogram[b] = 0;
+        oStats->schedulingLatencyHistogram[b] = 0;
+    }
+    for( uint32 i = 0; i < mNumSlots; ++i ) {
+        const FSlot& slot = mSlots[i];
+        busyTime += slot.mBusyTime.load( std::memory_order_relaxed );
+        oStats->numJobsFinished += slot.mNumJobs.load( std::memory_order_relaxed );
+        for( uint32 b = 0; b < FThreadPoolStats::NumHistogramBuckets; ++b ) {
+            oStats->jobTimeHistogram[b] += slot.mJobTime[b].load( std::memory_order_relaxed );
+            oStats->schedulingLatencyHistogram[b] += slot.mLatency[b].load( std::memory_order_relaxed );
+        }
+    }
+    oStats->numCommandsFinished = mNumCommands.load( std::memory_order_relaxed );
+
+    // Rates over the interval since the previous sample. Busy time is only
+    // accounted when a job ends, a long job can push a short interval above
+    // a full utilisation, it is clamped.
+    const uint64 now = FSchedulingTrace_Private::Now();
+    const uint64 elapsed = now - mLastTime.exchange( now, std::memory_order_relaxed );
+    const uint64 busy = busyTime - mLastBusyTime.exchange( busyTime, std::memory_order_relaxed );
+    const uint64 commands = oStats->numCommandsFinished - mLastNumCommands.exchange( oStats->numCommandsFinished, std::memory_order_relaxed );
+    oStats->utilisation = elapsed && iNumWorkers ? FMath::Min( 100.f, static_cast< float >( busy * 100.0 / ( static_cast< double >( elapsed ) * iNumWorkers ) ) ) : 0.f;
+    oStats->commandsPerSecond = elapsed ? static_cast< float >( commands * 1e9 / elapsed ) : 0.f;
+}
+
+//static
+uint32
+FThreadPoolStats_Private::Bucket( uint64 iTime )
+{
+    // Microseconds are approximated by 1024 ns.
+    uint32 bucket = 0;
+    for( uint64 us = iTime >> 10; us && bucket < FThreadPoolStats::NumHistogramBuckets - 1; us >>= 1 )
+        ++bucket;
+    return  bucket;
+}
+
+//static
+void
+FThreadPoolStats_Private::Bump( std::atomic_uint64_t& ioCounter, uint64 iValue )
+{
+    // Single writer, a plain load and store is enough.
+    ioCounter.store( ioCounter.load( std::memory_order_relaxed ) + iValue, std::memory_order_relaxed );
+}
+
+ULIS_NAMESPACE_END
+
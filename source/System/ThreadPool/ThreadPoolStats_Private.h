@@ -0,0 +1,80 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ThreadPoolStats_Private.h
+* @author       Clement Berthaud
+* @brief        This file provides the declaration for the FThreadPoolStats_Private class.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#pragma once
+#include "Core/Core.h"
+#include "System/ThreadPool/ThreadPool.h"
+#include <atomic>
+#include <memory>
+
+ULIS_NAMESPACE_BEGIN
+/////////////////////////////////////////////////////
+/// @class      FThreadPoolStats_Private
+/// @brief      The FThreadPoolStats_Private class holds the counters behind
+///             FThreadPool::Stats().
+/// @details    Each worker owns a slot, on its own cache line, that only it
+///             writes: counters are bumped with a relaxed load and store
+///             rather than a locked read-modify-write, and Sample() reads
+///             them with relaxed loads. A sample is thus not an atomic
+///             snapshot of the whole pool, each counter is exact on its own.
+///
+///             Slots are allocated once for MaxWorkers(), so that they
+///             outlive a change of the number of workers.
+///
+///             Times are in nanoseconds on the clock of the scheduling
+///             trace.
+///
+///             \sa FThreadPool_Private
+class FThreadPoolStats_Private
+{
+    struct alignas( 64 ) FSlot
+    {
+        std::atomic_uint64_t mBusyTime { 0 };
+        std::atomic_uint64_t mNumJobs { 0 };
+        std::atomic_uint64_t mJobTime[ FThreadPoolStats::NumHistogramBuckets ] {};
+        std::atomic_uint64_t mLatency[ FThreadPoolStats::NumHistogramBuckets ] {};
+    };
+
+public:
+    FThreadPoolStats_Private( uint32 iNumSlots );
+    FThreadPoolStats_Private( const FThreadPoolStats_Private& ) = delete;
+    FThreadPoolStats_Private& operator=( const FThreadPoolStats_Private& ) = delete;
+
+    /*! Count a job of the worker iSlot, that ran for iTime. */
+    void RecordJob( uint32 iSlot, uint64 iTime );
+
+    /*! Count the scheduling latency of a command, seen by the worker iSlot. */
+    void RecordLatency( uint32 iSlot, uint64 iTime );
+
+    /*! Count a finished or discarded command, from any thread. */
+    void RecordCommand();
+
+    /*!
+        Fill the counters of oStats, and the rates since the previous sample
+        for iNumWorkers workers. The queue depths are left to the caller.
+    */
+    void Sample( uint32 iNumWorkers, FThreadPoolStats* oStats ) const;
+
+private:
+    static uint32 Bucket( uint64 iTime );
+    static void Bump( std::atomic_uint64_t& ioCounter, uint64 iValue );
+
+private:
+    const uint32 mNumSlots;
+    std::unique_ptr< FSlot[] > mSlots;
+    alignas( 64 ) std::atomic_uint64_t mNumCommands;
+    mutable std::atomic_uint64_t mLastTime;
+    mutable std::atomic_uint64_t mLastBusyTime;
+    mutable std::atomic_uint64_t mLastNumCommands;
+};
+
+ULIS_NAMESPACE_END
+
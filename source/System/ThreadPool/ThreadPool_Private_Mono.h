@@ -16,6 +16,9 @@
 #include "Memory/Queue.h"
 #include "Scheduling/Job.h"
 #include "Scheduling/Command.h"
+#include "System/ThreadPool/ThreadPool.h"
+#include "System/ThreadPool/ThreadPoolStats_Private.h"
+#include "System/ThreadPool/Executor.h"
 
 #pragma message( "MONO THREAD POOL ACTIVATED" )
 
@@ -27,19 +30,38 @@ ULIS_NAMESPACE_BEGIN
 /// @details    This version of the private implementation is for systems
 ///             without actual multi threading support.
 ///
+///             An IExecutor given at construction time is only stored:
+///             commands still run on submission, on the calling thread.
+///
 ///             \sa FThreadPool
 class FThreadPool_Private
 {
 public:
     ~FThreadPool_Private();
-    FThreadPool_Private( uint32 iNumWorkers );
+    FThreadPool_Private( uint32 iNumWorkers, eThreadPoolBackend iBackend = ThreadPoolBackend_SharedQueue, eThreadPoolAffinity iAffinity = ThreadPoolAffinity_None );
+    explicit FThreadPool_Private( IExecutor* iExecutor );
     FThreadPool_Private( const FThreadPool_Private& ) = delete;
     FThreadPool_Private& operator=( const FThreadPool_Private& ) = delete;
     void ScheduleCommands( TQueue< const FCommand* >& ioCommands );
+    void ScheduleReadyCommand( const FCommand* iCommand );
+    void RunCommand( const FCommand* iCommand );
     void WaitForCompletion();
     void SetNumWorkers( uint32 iNumWorkers );
     uint32 GetNumWorkers() const;
+    eThreadPoolBackend Backend() const;
+    eThreadPoolAffinity Affinity() const;
+    void SetWaitSpinCount( uint32 iSpinCount );
+    uint32 WaitSpinCount() const;
+    FThreadPoolStats Stats() const;
+    IExecutor* Executor() const;
     static uint32 MaxWorkers();
+
+private:
+    eThreadPoolBackend mBackend;
+    eThreadPoolAffinity mAffinity;
+    uint32 mWaitSpinCount;
+    FThreadPoolStats_Private mStats;
+    IExecutor* mExecutor;
 };
 
 ULIS_NAMESPACE_END
@@ -12,13 +12,28 @@
 */
 #pragma once
 #include "System/ThreadPool/ThreadPool_Private_Mono.h"
+#include "Scheduling/SchedulingTrace_Private.h"
 
 ULIS_NAMESPACE_BEGIN
 FThreadPool_Private::~FThreadPool_Private()
 {
 }
 
-FThreadPool_Private::FThreadPool_Private( uint32 iNumWorkers )
+FThreadPool_Private::FThreadPool_Private( uint32 iNumWorkers, eThreadPoolBackend iBackend, eThreadPoolAffinity iAffinity )
+    : mBackend( iBackend )
+    , mAffinity( iAffinity )
+    , mWaitSpinCount( 0 )
+    , mStats( 1 )
+    , mExecutor( nullptr )
+{
+}
+
+FThreadPool_Private::FThreadPool_Private( IExecutor* iExecutor )
+    : mBackend( ThreadPoolBackend_SharedQueue )
+    , mAffinity( ThreadPoolAffinity_None )
+    , mWaitSpinCount( 0 )
+    , mStats( 1 )
+    , mExecutor( iExecutor )
 {
 }
 
@@ -32,21 +47,42 @@ FThreadPool_Private::ScheduleCommands( TQueue< const FCommand* >& ioCommands )
 
         ULIS_ASSERT( cmd->ReadyForScheduling(), "Bad queue state, waiting on events that are not scheduled will hang forever." );
 
-        if( cmd->ReadyForProcessing() )
-        {
-            const_cast< FCommand* >( cmd )->ProcessAsyncScheduling();
-            FSharedInternalEvent evt = cmd->Event();
-            const TArray< const FJob* >& jobs = cmd->Jobs();
-            const uint64 size = jobs.Size();
-            for( uint64 i = 0; i < size; ++i ) {
-                jobs[i]->Execute();
-                evt->NotifyOneJobFinished();
-            }
-        }
-        else
-        {
-            ioCommands.Push( cmd );
+        // Either processes the command right away, or lets its last
+        // dependency do it when it finishes.
+        cmd->Event()->Submit( this );
+    }
+}
+
+void
+FThreadPool_Private::ScheduleReadyCommand( const FCommand* iCommand )
+{
+    RunCommand( iCommand );
+}
+
+void
+FThreadPool_Private::RunCommand( const FCommand* iCommand )
+{
+    FSharedInternalEvent evt = iCommand->Event();
+    mStats.RecordCommand();
+    if( evt->CancelRequested() )
+        return  evt->Discard();
+
+    evt->NotifyScheduled();
+    const_cast< FCommand* >( iCommand )->ProcessAsyncScheduling();
+    const FJob* jobs = iCommand->Jobs();
+    const uint64 size = iCommand->NumJobs();
+    for( uint64 i = 0; i < size; ++i ) {
+        if( !evt->CancelRequested() ) {
+            const uint64 start = FSchedulingTrace_Private::Now();
+            jobs[i].Execute();
+            const uint64 end = FSchedulingTrace_Private::Now();
+            mStats.RecordJob( 0, end - start );
+            if( FSchedulingTrace_Private::Enabled() )
+                FSchedulingTrace_Private::RecordJob( iCommand->Name(), evt->TraceId(), start, end );
+            if( evt->CollectsMetrics() )
+                evt->AddJobTime( end - start );
         }
+        evt->NotifyOneJobFinished();
     }
 }
 
@@ -66,6 +102,52 @@ FThreadPool_Private::GetNumWorkers() const
     return  1;
 }
 
+eThreadPoolBackend
+FThreadPool_Private::Backend() const
+{
+    return  mBackend;
+}
+
+eThreadPoolAffinity
+FThreadPool_Private::Affinity() const
+{
+    return  mAffinity;
+}
+
+void
+FThreadPool_Private::SetWaitSpinCount( uint32 iSpinCount )
+{
+    mWaitSpinCount = iSpinCount;
+}
+
+uint32
+FThreadPool_Private::WaitSpinCount() const
+{
+    return  mWaitSpinCount;
+}
+
+FThreadPoolStats
+FThreadPool_Private::Stats() const
+{
+    // Commands run synchronously on submission, nothing is ever queued nor
+    // waits for a worker.
+    FThreadPoolStats stats;
+    stats.numWorkers = 1;
+    stats.numBusyWorkers = 0;
+    stats.numIdleWorkers = 1;
+    stats.numQueuedCommands = 0;
+    stats.numPendingCommands = 0;
+    stats.numQueuedJobs = 0;
+    mStats.Sample( 1, &stats );
+    return  stats;
+}
+
+IExecutor*
+FThreadPool_Private::Executor() const
+{
+    return  mExecutor;
+}
+
 //static
 uint32
 FThreadPool_Private::MaxWorkers()
@@ -16,11 +16,16 @@
 #include "Memory/Queue.h"
 #include "Scheduling/Job.h"
 #include "Scheduling/Command.h"
+#include "Scheduling/CommandQueue.h"
+#include "System/ThreadPool/ThreadPool.h"
+#include "System/ThreadPool/Executor.h"
+#include "System/ThreadPool/ThreadPoolStats_Private.h"
 
 #include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <random>
 #include <thread>
@@ -33,38 +38,126 @@ ULIS_NAMESPACE_BEGIN
 /// @details    This version of the private implementation is for generic
 ///             systems with multithreading support.
 ///
+///             Commands and jobs are stored in one deque per priority class,
+///             workers and the scheduler thread always serve the highest
+///             priority deque that is not empty first.
+///
+///             With ThreadPoolBackend_SharedQueue, all jobs are pushed in the
+///             shared mJobs deques, guarded by mJobsQueueMutex.
+///             With ThreadPoolBackend_WorkStealing, the jobs of a command are
+///             split in contiguous runs and distributed among the workers own
+///             deques, of the priority of the command. A worker pops jobs from the front of its own deque, and
+///             steals from the back of the other deques when it runs dry.
+///             mJobsQueueMutex is then only used to put idle workers to sleep.
+///
+///             With a pinned eThreadPoolAffinity, mWorkerCores holds the index
+///             of the logical core of each worker, see AffinityOrder(). The
+///             workers are pinned by StartWorkers() as soon as they start.
+///
+///             mCommands only receives commands which wait list is complete:
+///             the FInternalEvent of a command notifies the pool through
+///             ScheduleReadyCommand() when its last dependency finishes. The
+///             scheduler thread sleeps on cvCommand until such a command
+///             arrives, it never polls nor retries commands that are not ready.
+///
+///             mNumPending counts the commands submitted and not finished yet.
+///             WaitForCompletion() parks on cvJobsFinished until it drops to
+///             zero, after an optional bounded spin of mWaitSpinCount rounds.
+///
+///             RunCommand() runs a ready command on the calling thread, for
+///             commands run inline by FCommandQueue. They bypass the workers
+///             and are not counted by Stats().
+///
+///             With an IExecutor, no worker nor scheduler thread is started:
+///             ScheduleReadyCommand() builds the jobs of the command on the
+///             calling thread and hands each of them to the executor, through
+///             the RunExecutorJob() trampoline. mNumJobs then counts the jobs
+///             handed and not started yet.
+///
+///             mStats holds the per worker counters of Stats(), the queue
+///             depths are read from the atomic counts above. mNumJobs is
+///             atomic for that purpose only, it is still modified under
+///             mJobsQueueMutex.
+///
 ///             \sa FThreadPool
 class FThreadPool_Private
 {
+    /////////////////////////////////////////////////////
+    /// @class      FWorkerQueue
+    /// @brief      The FWorkerQueue class holds the local jobs deque of a
+    ///             worker for the work stealing backend.
+    struct FWorkerQueue
+    {
+        std::deque< const FJob* >       mJobs[ NumCommandQueuePriorities ];
+        std::mutex                      mMutex;
+    };
+
 public:
     ~FThreadPool_Private();
-    FThreadPool_Private( uint32 iNumWorkers = MaxWorkers() );
+    FThreadPool_Private( uint32 iNumWorkers = MaxWorkers(), eThreadPoolBackend iBackend = ThreadPoolBackend_SharedQueue, eThreadPoolAffinity iAffinity = ThreadPoolAffinity_None );
+    explicit FThreadPool_Private( IExecutor* iExecutor );
     FThreadPool_Private( const FThreadPool_Private& ) = delete;
     FThreadPool_Private& operator=( const FThreadPool_Private& ) = delete;
     void ScheduleCommands( TQueue< const FCommand* >& ioCommands );
+    void ScheduleReadyCommand( const FCommand* iCommand );
+    void RunCommand( const FCommand* iCommand );
     void WaitForCompletion();
     void SetNumWorkers( uint32 iNumWorkers );
     uint32 GetNumWorkers() const;
+    eThreadPoolBackend Backend() const;
+    eThreadPoolAffinity Affinity() const;
+    void SetWaitSpinCount( uint32 iSpinCount );
+    uint32 WaitSpinCount() const;
+    FThreadPoolStats Stats() const;
+    IExecutor* Executor() const;
     static uint32 MaxWorkers();
 
 private:
-    void ScheduleJob( const FJob* iJob );
-    void WorkProcess();
+    static std::vector< uint32 > AffinityOrder( eThreadPoolAffinity iAffinity );
+    void StartWorkers( uint32 iNumWorkers );
+    void StopWorkers();
+    void ScheduleJobs( const FJob* iJobs, uint64 iNumJobs, eCommandQueuePriority iPriority );
+    void ScheduleJobs_WorkStealing( const FJob* iJobs, uint64 iNumJobs, eCommandQueuePriority iPriority );
+    const FJob* PopJob_SharedQueue();
+    const FJob* PopJob_WorkStealing( uint32 iWorker );
+    void ProcessJob( const FJob* iJob, uint32 iWorker );
+    void DispatchCommand( const FCommand* iCommand );
+    static void RunExecutorJob( void* iJob );
+    void WorkProcess( uint32 iWorker );
+    void WorkStealingProcess( uint32 iWorker );
     void ScheduleProcess();
+    void NotifyCommandFinished();
 
 private:
     // Private Data
-    uint32                              mNumBusy;
+    eThreadPoolBackend                  mBackend;
+    eThreadPoolAffinity                 mAffinity;
+    std::vector< uint32 >               mWorkerCores;
+    std::atomic_uint32_t                mNumBusy;
     bool                                bStop;
+    bool                                bStopScheduler;
     std::atomic_uint32_t                mNumQueued;
+    std::atomic_uint32_t                mNumPending;
+    std::atomic_uint32_t                mWaitSpinCount;
     std::vector< std::thread >          mWorkers;
+    std::atomic_uint32_t                mNumWorkers;
     std::thread                         mScheduler;
-    std::deque< const FJob* >           mJobs;
-    std::deque< const FCommand* >       mCommands;
+    std::deque< const FJob* >           mJobs[ NumCommandQueuePriorities ];
+    std::atomic_uint64_t                mNumJobs;
+    std::deque< const FCommand* >       mCommands[ NumCommandQueuePriorities ];
+    uint64                              mNumCommands;
+    std::vector< std::unique_ptr< FWorkerQueue > > mWorkerQueues;
+    std::atomic_uint32_t                mNumStealable;
+    std::atomic_uint32_t                mNumStealableOf[ NumCommandQueuePriorities ];
+    uint32                              mNextWorker;
     std::mutex                          mJobsQueueMutex;
     std::mutex                          mCommandsQueueMutex;
+    std::mutex                          mCompletionMutex;
     std::condition_variable             cvJob;
+    std::condition_variable             cvCommand;
     std::condition_variable             cvJobsFinished;
+    FThreadPoolStats_Private            mStats;
+    IExecutor*                          mExecutor;
 };
 
 ULIS_NAMESPACE_END
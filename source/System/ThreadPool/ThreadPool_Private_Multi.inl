@@ -12,6 +12,15 @@
 */
 #pragma once
 #include "System/ThreadPool/ThreadPool_Private_Multi.h"
+#include "System/CPUInfo/CPUInfo.h"
+#include "Scheduling/SchedulingTrace_Private.h"
+
+#include <algorithm>
+
+#if defined( ULIS_LINUX )
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 ULIS_NAMESPACE_BEGIN
 FThreadPool_Private::~FThreadPool_Private()
@@ -25,74 +34,417 @@ FThreadPool_Private::~FThreadPool_Private()
         std::lock_guard< std::mutex > lock0( mJobsQueueMutex, std::adopt_lock );
         std::lock_guard< std::mutex > lock1( mCommandsQueueMutex, std::adopt_lock );
         bStop = true;
+        bStopScheduler = true;
         cvJob.notify_all();
+        cvCommand.notify_all();
     }
 
-    // Join all threads
-    mScheduler.join();
+    // Join all threads, there are none with an executor.
+    if( mScheduler.joinable() )
+        mScheduler.join();
 
     for( auto& t : mWorkers )
         t.join();
 
 }
 
-FThreadPool_Private::FThreadPool_Private( uint32 iNumWorkers )
-    : mNumBusy( 0 )
+FThreadPool_Private::FThreadPool_Private( uint32 iNumWorkers, eThreadPoolBackend iBackend, eThreadPoolAffinity iAffinity )
+    : mBackend( iBackend )
+    , mAffinity( iAffinity )
+    , mNumBusy( 0 )
+    , mNumJobs( 0 )
+    , mNumCommands( 0 )
     , bStop( false )
+    , bStopScheduler( false )
     , mNumQueued( 0 )
+    , mNumPending( 0 )
+    , mWaitSpinCount( 0 )
+    , mNumStealable( 0 )
+    , mNextWorker( 0 )
+    , mNumWorkers( 0 )
+    , mStats( MaxWorkers() )
+    , mExecutor( nullptr )
 {
-    uint32 max = FMath::Clamp( iNumWorkers, uint32( 1 ), MaxWorkers() );
-    mWorkers.reserve( max );
-    for( uint32 i = 0; i < max; ++i )
-        mWorkers.emplace_back( std::bind( &FThreadPool_Private::WorkProcess, this ) );
-
+    for( uint32 p = 0; p < NumCommandQueuePriorities; ++p )
+        mNumStealableOf[p] = 0;
+    StartWorkers( FMath::Clamp( iNumWorkers, uint32( 1 ), MaxWorkers() ) );
     mScheduler = std::thread( std::bind( &FThreadPool_Private::ScheduleProcess, this ) );
 }
 
+FThreadPool_Private::FThreadPool_Private( IExecutor* iExecutor )
+    : mBackend( ThreadPoolBackend_SharedQueue )
+    , mAffinity( ThreadPoolAffinity_None )
+    , mNumBusy( 0 )
+    , mNumJobs( 0 )
+    , mNumCommands( 0 )
+    , bStop( false )
+    , bStopScheduler( false )
+    , mNumQueued( 0 )
+    , mNumPending( 0 )
+    , mWaitSpinCount( 0 )
+    , mNumStealable( 0 )
+    , mNextWorker( 0 )
+    , mNumWorkers( FMath::Max( iExecutor->Concurrency(), uint32( 1 ) ) )
+    , mStats( 1 )
+    , mExecutor( iExecutor )
+{
+    for( uint32 p = 0; p < NumCommandQueuePriorities; ++p )
+        mNumStealableOf[p] = 0;
+}
+
 void
 FThreadPool_Private::ScheduleCommands( TQueue< const FCommand* >& ioCommands )
 {
-    std::lock_guard< std::mutex > lock( mCommandsQueueMutex );
-    uint32 size = static_cast< uint32 >( ioCommands.Size() );
+    // Count all commands first, a submitted command may be processed and
+    // completed before the next one is submitted.
+    const uint32 size = static_cast< uint32 >( ioCommands.Size() );
+    mNumPending.fetch_add( size );
+    mNumQueued.fetch_add( size );
     while( !ioCommands.IsEmpty() )
     {
         const FCommand* cmd = ioCommands.Front();
         ioCommands.Pop();
         ULIS_ASSERT( cmd->ReadyForScheduling(), "Bad Events dependency, this command relies on unscheduled commands and will block the pool forever." );
-        mCommands.push_back( cmd );
+
+        // Either schedules the command right away, or lets its last
+        // dependency do it when it finishes.
+        cmd->Event()->Submit( this );
     }
-    mNumQueued.fetch_add( size );
 }
 
 void
-FThreadPool_Private::ScheduleJob( const FJob* iJob )
+FThreadPool_Private::ScheduleReadyCommand( const FCommand* iCommand )
 {
+    iCommand->Event()->NotifyReady( FSchedulingTrace_Private::Now() );
+    if( mExecutor )
+        return  DispatchCommand( iCommand );
+
+    std::lock_guard< std::mutex > lock( mCommandsQueueMutex );
+    mCommands[ iCommand->Priority() ].push_back( iCommand );
+    ++mNumCommands;
+    cvCommand.notify_one();
+}
+
+void
+FThreadPool_Private::RunCommand( const FCommand* iCommand )
+{
+    FSharedInternalEvent evt = iCommand->Event();
+    if( evt->CancelRequested() )
+        return  evt->Discard();
+
+    evt->NotifyScheduled();
+    const_cast< FCommand* >( iCommand )->ProcessAsyncScheduling();
+    const FJob* jobs = iCommand->Jobs();
+    const uint64 size = iCommand->NumJobs();
+    for( uint64 i = 0; i < size; ++i ) {
+        if( !evt->CancelRequested() ) {
+            const bool trace = FSchedulingTrace_Private::Enabled();
+            const uint64 start = trace || evt->CollectsMetrics() ? FSchedulingTrace_Private::Now() : 0;
+            jobs[i].Execute();
+            if( start ) {
+                const uint64 end = FSchedulingTrace_Private::Now();
+                if( trace )
+                    FSchedulingTrace_Private::RecordJob( iCommand->Name(), evt->TraceId(), start, end );
+                if( evt->CollectsMetrics() )
+                    evt->AddJobTime( end - start );
+            }
+        }
+        evt->NotifyOneJobFinished();
+    }
+}
+
+void
+FThreadPool_Private::ScheduleJobs( const FJob* iJobs, uint64 iNumJobs, eCommandQueuePriority iPriority )
+{
+    if( mBackend == ThreadPoolBackend_WorkStealing )
+        return  ScheduleJobs_WorkStealing( iJobs, iNumJobs, iPriority );
+
+    const uint64 size = iNumJobs;
     std::lock_guard< std::mutex > lock( mJobsQueueMutex );
-    mJobs.push_back( iJob );
-    cvJob.notify_one();
+    for( uint64 i = 0; i < size; ++i )
+        mJobs[ iPriority ].push_back( iJobs + i );
+    mNumJobs += size;
+
+    if( size > 1 )
+        cvJob.notify_all();
+    else
+        cvJob.notify_one();
 }
 
 void
-FThreadPool_Private::WaitForCompletion()
+FThreadPool_Private::ScheduleJobs_WorkStealing( const FJob* iJobs, uint64 iNumJobs, eCommandQueuePriority iPriority )
 {
-    //std::unique_lock< std::mutex > lock( mJobsQueueMutex );
-    //cvJobsFinished.wait( lock, [ this ](){ return mJobs.empty() && ( mNumBusy == 0 ) && ( mNumQueued == 0 ); } );
+    // Jobs are split in contiguous runs, one per worker, so that neighbour
+    // scanlines or chunks of a block are processed by the same worker.
+    // The first worker rotates from one command to the other in order to
+    // spread commands made of a single job.
+    const uint64 size = iNumJobs;
+    if( size == 0 )
+        return;
+
+    const uint64 numQueues = mWorkerQueues.size();
+    const uint64 numRuns = FMath::Min( size, numQueues );
+    const uint64 first = mNextWorker;
+    mNextWorker = static_cast< uint32 >( ( first + 1 ) % numQueues );
+
+    mNumStealableOf[ iPriority ].fetch_add( static_cast< uint32 >( size ) );
+    mNumStealable.fetch_add( static_cast< uint32 >( size ) );
+    for( uint64 i = 0; i < numRuns; ++i )
+    {
+        const uint64 beg = ( size * i ) / numRuns;
+        const uint64 end = ( size * ( i + 1 ) ) / numRuns;
+        FWorkerQueue& queue = *mWorkerQueues[ ( first + i ) % numQueues ];
+        std::lock_guard< std::mutex > lock( queue.mMutex );
+        for( uint64 j = beg; j < end; ++j )
+            queue.mJobs[ iPriority ].push_back( iJobs + j );
+    }
 
-    while( true )
+    // Wake up sleeping workers, they will steal what they need.
+    std::lock_guard< std::mutex > lock( mJobsQueueMutex );
+    if( numRuns > 1 )
+        cvJob.notify_all();
+    else
+        cvJob.notify_one();
+}
+
+const FJob*
+FThreadPool_Private::PopJob_SharedQueue()
+{
+    // mJobsQueueMutex must be held.
+    for( uint32 p = 0; p < NumCommandQueuePriorities; ++p ) {
+        if( !mJobs[p].empty() ) {
+            const FJob* job = mJobs[p].front();
+            mJobs[p].pop_front();
+            --mNumJobs;
+            return  job;
+        }
+    }
+    return  nullptr;
+}
+
+const FJob*
+FThreadPool_Private::PopJob_WorkStealing( uint32 iWorker )
+{
+    const uint32 numQueues = static_cast< uint32 >( mWorkerQueues.size() );
+
+    // Higher priorities first, a worker steals high priority jobs before it
+    // runs its own low priority ones.
+    for( uint32 p = 0; p < NumCommandQueuePriorities; ++p )
     {
-        std::lock( mJobsQueueMutex, mCommandsQueueMutex );
-        std::lock_guard< std::mutex > lock0( mJobsQueueMutex, std::adopt_lock );
-        std::lock_guard< std::mutex > lock1( mCommandsQueueMutex, std::adopt_lock );
-        if( mJobs.empty() && ( mNumBusy == 0 ) && ( mNumQueued == 0 ) && mCommands.empty() )
-            break;
+        if( mNumStealableOf[p] == 0 )
+            continue;
+
+        // Own queue first, from the front.
+        {
+            FWorkerQueue& queue = *mWorkerQueues[ iWorker ];
+            std::lock_guard< std::mutex > lock( queue.mMutex );
+            if( !queue.mJobs[p].empty() ) {
+                const FJob* job = queue.mJobs[p].front();
+                queue.mJobs[p].pop_front();
+                --mNumStealableOf[p];
+                --mNumStealable;
+                return  job;
+            }
+        }
+
+        // Then steal from the back of the others, closest neighbours first:
+        // with a pinned affinity, they are the ones that share a cache.
+        for( uint32 i = 1; i < numQueues; ++i )
+        {
+            FWorkerQueue& queue = *mWorkerQueues[ ( iWorker + i ) % numQueues ];
+            std::lock_guard< std::mutex > lock( queue.mMutex );
+            if( !queue.mJobs[p].empty() ) {
+                const FJob* job = queue.mJobs[p].back();
+                queue.mJobs[p].pop_back();
+                --mNumStealableOf[p];
+                --mNumStealable;
+                return  job;
+            }
+        }
+    }
+
+    return  nullptr;
+}
+
+void
+FThreadPool_Private::WaitForCompletion()
+{
+    // Optional bounded spin, for short waits where parking the thread would
+    // cost more than the wait itself.
+    const uint32 spin = mWaitSpinCount;
+    for( uint32 i = 0; i < spin; ++i ) {
+        if( mNumPending == 0 )
+            return;
+        std::this_thread::yield();
     }
+
+    // Then park until the last pending command notifies its completion.
+    const uint64 start = FSchedulingTrace_Private::Enabled() ? FSchedulingTrace_Private::Now() : 0;
+    std::unique_lock< std::mutex > lock( mCompletionMutex );
+    cvJobsFinished.wait( lock, [ this ](){ return mNumPending == 0; } );
+    lock.unlock();
+    if( start )
+        FSchedulingTrace_Private::RecordWait( "FThreadPool::WaitForCompletion", start, FSchedulingTrace_Private::Now() );
 }
 
 void
 FThreadPool_Private::SetNumWorkers( uint32 iNumWorkers )
 {
+    // The concurrency of an executor belongs to the host.
+    if( mExecutor )
+        return;
+
     WaitForCompletion();
+    StopWorkers();
+    StartWorkers( FMath::Clamp( iNumWorkers, uint32( 1 ), MaxWorkers() ) );
+}
+
+uint32
+FThreadPool_Private::GetNumWorkers() const
+{
+    return  mExecutor ? mNumWorkers.load() : static_cast< uint32 >( mWorkers.size() );
+}
+
+eThreadPoolBackend
+FThreadPool_Private::Backend() const
+{
+    return  mBackend;
+}
+
+eThreadPoolAffinity
+FThreadPool_Private::Affinity() const
+{
+    return  mAffinity;
+}
+
+void
+FThreadPool_Private::SetWaitSpinCount( uint32 iSpinCount )
+{
+    mWaitSpinCount = iSpinCount;
+}
+
+uint32
+FThreadPool_Private::WaitSpinCount() const
+{
+    return  mWaitSpinCount;
+}
 
+FThreadPoolStats
+FThreadPool_Private::Stats() const
+{
+    FThreadPoolStats stats;
+    const uint32 numWorkers = mNumWorkers;
+    const uint32 numBusy = FMath::Min( mNumBusy.load(), numWorkers );
+    stats.numWorkers = numWorkers;
+    stats.numBusyWorkers = numBusy;
+    stats.numIdleWorkers = numWorkers - numBusy;
+    stats.numQueuedCommands = mNumQueued;
+    stats.numPendingCommands = mNumPending;
+    stats.numQueuedJobs = mBackend == ThreadPoolBackend_WorkStealing ? mNumStealable.load() : mNumJobs.load();
+    mStats.Sample( numWorkers, &stats );
+    return  stats;
+}
+
+IExecutor*
+FThreadPool_Private::Executor() const
+{
+    return  mExecutor;
+}
+
+//static
+uint32
+FThreadPool_Private::MaxWorkers()
+{
+    return  std::thread::hardware_concurrency();
+}
+
+//static
+std::vector< uint32 >
+FThreadPool_Private::AffinityOrder( eThreadPoolAffinity iAffinity )
+{
+    // Logical cores sorted by NUMA node, then by shared L3 and L2, so that
+    // neighbour workers share as much as possible.
+    const uint32 num = FCPUInfo::NumLogicalCores();
+    std::vector< uint32 > order( num );
+    for( uint32 i = 0; i < num; ++i )
+        order[i] = i;
+    std::stable_sort( order.begin(), order.end(), []( uint32 iA, uint32 iB ) {
+        if( FCPUInfo::NUMANode( iA ) != FCPUInfo::NUMANode( iB ) )
+            return  FCPUInfo::NUMANode( iA ) < FCPUInfo::NUMANode( iB );
+        if( FCPUInfo::CacheGroup( iA, 3 ) != FCPUInfo::CacheGroup( iB, 3 ) )
+            return  FCPUInfo::CacheGroup( iA, 3 ) < FCPUInfo::CacheGroup( iB, 3 );
+        if( FCPUInfo::CacheGroup( iA, 2 ) != FCPUInfo::CacheGroup( iB, 2 ) )
+            return  FCPUInfo::CacheGroup( iA, 2 ) < FCPUInfo::CacheGroup( iB, 2 );
+        return  FCPUInfo::PhysicalCore( iA ) < FCPUInfo::PhysicalCore( iB );
+    } );
+
+    // One logical core per physical core first, the SMT siblings after them,
+    // or not at all.
+    std::vector< bool > taken( FCPUInfo::NumPhysicalCores(), false );
+    std::vector< uint32 > first;
+    std::vector< uint32 > siblings;
+    for( uint32 i : order ) {
+        const uint32 core = FCPUInfo::PhysicalCore( i );
+        if( taken[ core ] ) {
+            siblings.push_back( i );
+        } else {
+            taken[ core ] = true;
+            first.push_back( i );
+        }
+    }
+    if( iAffinity == ThreadPoolAffinity_Pinned )
+        first.insert( first.end(), siblings.begin(), siblings.end() );
+    return  first;
+}
+
+void
+FThreadPool_Private::StartWorkers( uint32 iNumWorkers )
+{
+    mWorkerCores.clear();
+    if( mAffinity != ThreadPoolAffinity_None )
+    {
+        const std::vector< uint32 > order = AffinityOrder( mAffinity );
+        if( mAffinity == ThreadPoolAffinity_PhysicalCores )
+            iNumWorkers = FMath::Clamp( iNumWorkers, uint32( 1 ), static_cast< uint32 >( order.size() ) );
+        for( uint32 i = 0; i < iNumWorkers; ++i )
+            mWorkerCores.push_back( order[ i % order.size() ] );
+    }
+
+    mWorkers.clear();
+    mWorkers.reserve( iNumWorkers );
+    mNumWorkers = iNumWorkers;
+    if( mBackend == ThreadPoolBackend_WorkStealing )
+    {
+        // Queues are only resized while no worker is running.
+        mWorkerQueues.clear();
+        mWorkerQueues.reserve( iNumWorkers );
+        for( uint32 i = 0; i < iNumWorkers; ++i )
+            mWorkerQueues.emplace_back( new FWorkerQueue() );
+        mNextWorker = 0;
+
+        for( uint32 i = 0; i < iNumWorkers; ++i )
+            mWorkers.emplace_back( std::bind( &FThreadPool_Private::WorkStealingProcess, this, i ) );
+    }
+    else
+    {
+        for( uint32 i = 0; i < iNumWorkers; ++i )
+            mWorkers.emplace_back( std::bind( &FThreadPool_Private::WorkProcess, this, i ) );
+    }
+
+#if defined( ULIS_LINUX )
+    for( uint32 i = 0; i < mWorkerCores.size(); ++i )
+    {
+        cpu_set_t set;
+        CPU_ZERO( &set );
+        CPU_SET( FCPUInfo::LogicalCoreID( mWorkerCores[i] ), &set );
+        pthread_setaffinity_np( mWorkers[i].native_handle(), sizeof( set ), &set );
+    }
+#endif
+}
+
+void
+FThreadPool_Private::StopWorkers()
+{
     // Notify stop condition
     {
         std::lock_guard< std::mutex > lock( mJobsQueueMutex );
@@ -105,30 +457,92 @@ FThreadPool_Private::SetNumWorkers( uint32 iNumWorkers )
         t.join();
 
     bStop = false;
+}
 
-    uint32 max = FMath::Min( iNumWorkers, MaxWorkers() );
-    mWorkers.clear();
-    mWorkers.reserve( max );
-    for( uint32 i = 0; i < max; ++i )
-        mWorkers.emplace_back( std::bind( &FThreadPool_Private::WorkProcess, this ) );
+void
+FThreadPool_Private::ProcessJob( const FJob* iJob, uint32 iWorker )
+{
+    // Gather event
+    FSharedInternalEvent evt = iJob->Parent()->Event();
+
+    // The first job of a command measures how long it waited for a worker.
+    const uint64 start = FSchedulingTrace_Private::Now();
+    const uint64 ready = evt->TakeReadyTime();
+    if( ready && iWorker != UINT32_MAX )
+        mStats.RecordLatency( iWorker, start > ready ? start - ready : 0 );
+
+    // run function outside context, unless the command was cancelled
+    if( !evt->CancelRequested() ) {
+        iJob->Execute();
+        const uint64 end = FSchedulingTrace_Private::Now();
+        if( iWorker != UINT32_MAX )
+            mStats.RecordJob( iWorker, end - start );
+        if( FSchedulingTrace_Private::Enabled() )
+            FSchedulingTrace_Private::RecordJob( iJob->Parent()->Name(), evt->TraceId(), start, end );
+        if( evt->CollectsMetrics() )
+            evt->AddJobTime( end - start );
+    }
+
+    // Notify event, the last job of the last pending command wakes up the
+    // waiting threads. Executor threads are not joined, they must be done
+    // with the pool before that.
+    const bool finished = evt->NotifyOneJobFinished();
+    if( iWorker == UINT32_MAX )
+        --mNumBusy;
+    if( finished )
+        NotifyCommandFinished();
 }
 
-uint32
-FThreadPool_Private::GetNumWorkers() const
+void
+FThreadPool_Private::DispatchCommand( const FCommand* iCommand )
 {
-    return  static_cast< uint32 >( mWorkers.size() );
+    // Same as the scheduler thread, on the thread that made the command
+    // ready, the executor only receives jobs.
+    FSharedInternalEvent evt = iCommand->Event();
+    if( evt->CancelRequested() ) {
+        evt->Discard();
+        NotifyCommandFinished();
+    } else {
+        evt->NotifyScheduled();
+        const_cast< FCommand* >( iCommand )->ProcessAsyncScheduling();
+        const FJob* jobs = iCommand->Jobs();
+        const uint64 size = iCommand->NumJobs();
+        mNumJobs += size;
+        for( uint64 i = 0; i < size; ++i )
+            mExecutor->Dispatch( &FThreadPool_Private::RunExecutorJob, const_cast< FJob* >( jobs + i ), iCommand->Priority() );
+    }
+    mNumQueued.fetch_sub( 1 );
 }
 
 //static
-uint32
-FThreadPool_Private::MaxWorkers()
+void
+FThreadPool_Private::RunExecutorJob( void* iJob )
 {
-    return  std::thread::hardware_concurrency();
+    // Executor threads have no worker slot, their jobs are not timed in the
+    // histograms of Stats(). ProcessJob() marks the end of the job.
+    const FJob* job = static_cast< const FJob* >( iJob );
+    FThreadPool_Private* pool = job->Parent()->Event()->Pool();
+    --pool->mNumJobs;
+    ++pool->mNumBusy;
+    pool->ProcessJob( job, UINT32_MAX );
 }
 
 void
-FThreadPool_Private::WorkProcess()
+FThreadPool_Private::NotifyCommandFinished()
 {
+    // The mutex is taken so that the notification cannot slip between the
+    // predicate check and the wait in WaitForCompletion.
+    mStats.RecordCommand();
+    if( --mNumPending == 0 ) {
+        std::lock_guard< std::mutex > lock( mCompletionMutex );
+        cvJobsFinished.notify_all();
+    }
+}
+
+void
+FThreadPool_Private::WorkProcess( uint32 iWorker )
+{
+    FSchedulingTrace_Private::NameThread( "Worker " + std::to_string( iWorker ) );
     while( true )
     {
         // Acquire Mutex
@@ -136,36 +550,25 @@ FThreadPool_Private::WorkProcess()
 
         // Release held mutex and put to sleep until notified
         // Then wake up of signal and re-acquire the mutex to check condition
-        cvJob.wait( latch, [ this ](){ return bStop || !mJobs.empty(); } );
+        cvJob.wait( latch, [ this ](){ return bStop || mNumJobs != 0; } );
 
-        if( !mJobs.empty() )
+        if( mNumJobs != 0 )
         {
             // got work. set busy.
             ++mNumBusy;
 
-            // pull from queue
-            const FJob* job = mJobs.front();
-            mJobs.pop_front();
+            // pull from queue, highest priority first
+            const FJob* job = PopJob_SharedQueue();
 
             // release lock. run async
             latch.unlock();
 
-            // Gather event
-            FSharedInternalEvent evt = job->Parent()->Event();
-
-            // run function outside context
-            job->Execute();
+            ProcessJob( job, iWorker );
 
             // lock again, run sync.
             latch.lock();
-            // Notify event
-            bool notify = evt->NotifyOneJobFinished();
             // Managing internals
             --mNumBusy;
-
-            latch.unlock();
-            if( notify )
-                cvJobsFinished.notify_one();
         }
         else if( bStop )
         {
@@ -175,46 +578,68 @@ FThreadPool_Private::WorkProcess()
 }
 
 void
-FThreadPool_Private::ScheduleProcess()
+FThreadPool_Private::WorkStealingProcess( uint32 iWorker )
 {
+    FSchedulingTrace_Private::NameThread( "Worker " + std::to_string( iWorker ) );
     while( true )
     {
-        std::unique_lock< std::mutex > latch( mCommandsQueueMutex );
-
-        if( !mCommands.empty() )
+        const FJob* job = PopJob_WorkStealing( iWorker );
+        if( job )
         {
-            // pull from queue
-            const FCommand* cmd = mCommands.front();
-            mCommands.pop_front();
+            ++mNumBusy;
+            ProcessJob( job, iWorker );
+            --mNumBusy;
+            continue;
+        }
 
-            latch.unlock();
+        // Nothing to do anywhere, sleep until new jobs are scheduled.
+        std::unique_lock< std::mutex > latch( mJobsQueueMutex );
+        cvJob.wait( latch, [ this ](){ return bStop || mNumStealable != 0; } );
 
-            // Push jobs
-            bool ready = cmd->ReadyForProcessing();
-            if( ready )
-            {
-                const_cast< FCommand* >( cmd )->ProcessAsyncScheduling();
-                const TArray< const FJob* >& jobs = cmd->Jobs();
-                const uint64 size = jobs.Size();
-                for( uint64 i = 0; i < size; ++i )
-                    ScheduleJob( jobs[i] );
-                mNumQueued.fetch_sub( 1 );
-            }
+        if( bStop && mNumStealable == 0 )
+            break;
+    }
+}
 
-            // lock again, run sync.
-            latch.lock();
+void
+FThreadPool_Private::ScheduleProcess()
+{
+    FSchedulingTrace_Private::NameThread( "Scheduler" );
+    while( true )
+    {
+        std::unique_lock< std::mutex > latch( mCommandsQueueMutex );
+
+        // Sleep until a ready command is available.
+        cvCommand.wait( latch, [ this ](){ return bStopScheduler || mNumCommands != 0; } );
+
+        if( mNumCommands == 0 )
+            break;
 
-            if( !ready )
-            {
-                mCommands.push_back( cmd );
+        // pull from queue, highest priority first
+        const FCommand* cmd = nullptr;
+        for( uint32 p = 0; !cmd; ++p ) {
+            if( !mCommands[p].empty() ) {
+                cmd = mCommands[p].front();
+                mCommands[p].pop_front();
             }
         }
-        else if( bStop )
-        {
-            break;
+        --mNumCommands;
+
+        latch.unlock();
+
+        // Push jobs, the command is ready by construction. A cancelled
+        // command is dropped before its jobs are even built.
+        FSharedInternalEvent evt = cmd->Event();
+        if( evt->CancelRequested() ) {
+            evt->Discard();
+            NotifyCommandFinished();
+        } else {
+            evt->NotifyScheduled();
+            const_cast< FCommand* >( cmd )->ProcessAsyncScheduling();
+            ScheduleJobs( cmd->Jobs(), cmd->NumJobs(), cmd->Priority() );
         }
+        mNumQueued.fetch_sub( 1 );
     }
 }
 
 ULIS_NAMESPACE_END
-
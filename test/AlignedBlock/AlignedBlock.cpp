@@ -0,0 +1,140 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         AlignedBlock.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the aligned scanline layout of FBlock.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: AlignedBlock [workers]
+// Fills, copies, blends and converts blocks with aligned scanlines of odd
+// widths, checks that they give the same pixels as packed blocks, and times
+// a copy with both layouts.
+
+// Largest difference between the pixels of two blocks of the same size and
+// format, the padding is ignored.
+int
+MaxDifference( const FBlock& iA, const FBlock& iB )
+{
+    int diff = 0;
+    const uint64 size = uint64( iA.Width() ) * iA.BytesPerPixel();
+    for( uint16 y = 0; y < iA.Height(); ++y ) {
+        const uint8* a = iA.ScanlineBits( y );
+        const uint8* b = iB.ScanlineBits( y );
+        for( uint64 i = 0; i < size; ++i )
+            diff = FMath::Max( diff, std::abs( int( a[i] ) - int( b[i] ) ) );
+    }
+    return  diff;
+}
+
+bool
+IsAligned( const FBlock& iBlock )
+{
+    return  reinterpret_cast< uintptr_t >( iBlock.Bits() ) % ULIS_SCANLINE_ALIGNMENT == 0
+        && iBlock.BytesPerScanLine() % ULIS_SCANLINE_ALIGNMENT == 0
+        && iBlock.BytesPerScanLine() >= iBlock.Width() * iBlock.BytesPerPixel();
+}
+
+// The same operations on an aligned and a packed block.
+bool
+CheckFormat( FThreadPool& iPool, eFormat iFormat, const char* iName )
+{
+    FCommandQueue queue( iPool );
+    FContext ctx( queue, iFormat, PerformanceIntent_Max );
+    const uint16 w = 333;
+    const uint16 h = 97;
+    FBlock aligned( w, h, iFormat, ScanlineLayout_Aligned );
+    FBlock packed( w, h, iFormat );
+    bool ok = IsAligned( aligned ) && !aligned.IsContiguous() && packed.IsContiguous();
+
+    // Whole block and odd regions, with the padded scanlines and the chunks
+    // of the packed block.
+    for( FBlock* block : { &aligned, &packed } ) {
+        ctx.Fill( *block, FColor::RGBA8( 20, 40, 60, 255 ), block->Rect(), FSchedulePolicy::CacheEfficient );
+        ctx.Fill( *block, FColor::RGBA8( 200, 100, 50, 128 ), FRectI( 7, 3, 301, 80 ) );
+        ctx.Fill( *block, FColor::RGBA8( 0, 255, 0, 255 ), FRectI( 300, 50, 33, 47 ) );
+    }
+    ctx.Finish();
+    ok = ok && MaxDifference( aligned, packed ) == 0;
+
+    // A gradient copied at odd positions, from and to both layouts.
+    FBlock gradient( w, h, iFormat );
+    for( uint16 y = 0; y < h; ++y )
+        for( uint16 x = 0; x < w; ++x )
+            gradient.SetPixel( x, y, FColor::RGBA8( uint8( x ), uint8( y * 2 ), uint8( x + y ), uint8( 255 - y ) ) );
+    FBlock alignedGradient( w, h, iFormat, ScanlineLayout_Aligned );
+    ctx.Copy( gradient, alignedGradient, gradient.Rect(), FVec2I( 0 ), FSchedulePolicy::CacheEfficient );
+    ctx.Finish();
+    ok = ok && MaxDifference( alignedGradient, gradient ) == 0;
+    ctx.Copy( alignedGradient, aligned, FRectI( 5, 0, 200, 60 ), FVec2I( 133, 11 ) );
+    ctx.Copy( gradient, packed, FRectI( 5, 0, 200, 60 ), FVec2I( 133, 11 ) );
+    ctx.Finish();
+    ok = ok && MaxDifference( aligned, packed ) == 0;
+
+    // Blends and conversions.
+    for( FBlock* block : { &aligned, &packed } ) {
+        ctx.Blend( alignedGradient, *block, FRectI( 0, 0, 120, 90 ), FVec2I( 213, 4 ), Blend_Normal, Alpha_Normal, 0.7f );
+        ctx.Blend( gradient, *block, FRectI( 0, 0, 64, 64 ), FVec2I( 1, 1 ), Blend_Multiply, Alpha_Normal, 0.5f );
+    }
+    ctx.Finish();
+    ok = ok && MaxDifference( aligned, packed ) == 0;
+
+    FBlock convertedAligned( w, h, Format_RGBAF, ScanlineLayout_Aligned );
+    FBlock convertedPacked( w, h, Format_RGBAF );
+    ctx.ConvertFormat( aligned, convertedAligned );
+    ctx.ConvertFormat( packed, convertedPacked );
+    ctx.Finish();
+    ok = ok && IsAligned( convertedAligned ) && MaxDifference( convertedAligned, convertedPacked ) == 0;
+
+    std::cout << iName << ": stride " << aligned.BytesPerScanLine() << " for " << w * aligned.BytesPerPixel() << " bytes of pixels" << std::endl;
+    return  ok;
+}
+
+// Average time of a full copy between two blocks of a layout, in ms.
+double
+CopyTime( FContext& iCtx, eScanlineLayout iLayout )
+{
+    const uint16 w = 1999;
+    const uint16 h = 1999;
+    FBlock src( w, h, Format_RGBA8, iLayout );
+    FBlock dst( w, h, Format_RGBA8, iLayout );
+    iCtx.Fill( src, FColor::RGBA8( 10, 20, 30, 40 ), src.Rect() );
+    iCtx.Finish();
+    const int repeat = 32;
+    auto startTime = std::chrono::steady_clock::now();
+    for( int i = 0; i < repeat; ++i ) {
+        iCtx.Copy( src, dst, src.Rect() );
+        iCtx.Finish();
+    }
+    return  std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0 / repeat;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    bool ok = true;
+    ok = CheckFormat( pool, Format_RGBA8, "RGBA8" ) && ok;
+    ok = CheckFormat( pool, Format_RGB8, "RGB8" ) && ok;
+    ok = CheckFormat( pool, Format_RGBA16, "RGBA16" ) && ok;
+
+    FCommandQueue queue( pool );
+    FContext ctx( queue, Format_RGBA8, PerformanceIntent_Max );
+    const double packedMs = CopyTime( ctx, ScanlineLayout_Packed );
+    const double alignedMs = CopyTime( ctx, ScanlineLayout_Aligned );
+
+    std::cout << "workers: " << workers << std::endl;
+    std::cout << "copy 1999x1999 RGBA8, packed: " << packedMs << " ms, aligned: " << alignedMs << " ms" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+    return  ok ? 0 : 1;
+}
+
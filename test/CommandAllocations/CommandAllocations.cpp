@@ -0,0 +1,98 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandAllocations.cpp
+* @author       Clement Berthaud
+* @brief        Allocations per command benchmark application for ULIS.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+using namespace ::ULIS;
+
+// Every heap allocation of the process goes through here. With glibc, the
+// malloc family is replaced so that raw mallocs such as XMalloc are counted
+// too, elsewhere only operator new is seen.
+static std::atomic< uint64 > sNumAllocs( 0 );
+
+#if defined( __GLIBC__ )
+extern "C" {
+void* __libc_malloc( size_t );
+void* __libc_calloc( size_t, size_t );
+void* __libc_realloc( void*, size_t );
+void* __libc_memalign( size_t, size_t );
+void __libc_free( void* );
+
+void* malloc( size_t iSize ) { ++sNumAllocs; return  __libc_malloc( iSize ); }
+void* calloc( size_t iNum, size_t iSize ) { ++sNumAllocs; return  __libc_calloc( iNum, iSize ); }
+void* realloc( void* iPtr, size_t iSize ) { ++sNumAllocs; return  __libc_realloc( iPtr, iSize ); }
+void* aligned_alloc( size_t iAlign, size_t iSize ) { ++sNumAllocs; return  __libc_memalign( iAlign, iSize ); }
+int posix_memalign( void** oPtr, size_t iAlign, size_t iSize ) { ++sNumAllocs; *oPtr = __libc_memalign( iAlign, iSize ); return  *oPtr ? 0 : 12; }
+void free( void* iPtr ) { __libc_free( iPtr ); }
+}
+#else
+void* operator new( std::size_t iSize ) {
+    ++sNumAllocs;
+    if( void* ptr = std::malloc( iSize ? iSize : 1 ) )
+        return  ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete( void* iPtr ) noexcept {
+    std::free( iPtr );
+}
+
+void operator delete( void* iPtr, std::size_t ) noexcept {
+    std::free( iPtr );
+}
+#endif
+
+// Usage: CommandAllocations [size] [repeat]
+// Issues small Clear commands, such as brush dabs, with several policies and
+// reports the number of heap allocations and the time spent per command,
+// once the command and job storage has been warmed up.
+int main( int argc, char *argv[] ) {
+    int size = argc > 1 ? std::stoi( argv[1] ) : 64;
+    uint32 repeat = argc > 2 ? std::stoul( argv[2] ) : 1000;
+
+    FThreadPool pool;
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock block( size, size, fmt );
+
+    const FSchedulePolicy* policies[] = { &FSchedulePolicy::MonoChunk, &FSchedulePolicy::MultiScanlines, &FSchedulePolicy::CacheEfficient };
+    const char* names[] = { "MonoChunk", "MultiScanlines", "CacheEfficient" };
+
+    std::cout << "size: " << size << "x" << size << " repeat: " << repeat << std::endl;
+    std::cout << std::setw( 16 ) << "policy" << std::setw( 14 ) << "allocs/cmd" << std::setw( 14 ) << "us/cmd" << std::endl;
+    for( int p = 0; p < 3; ++p ) {
+        // Warm up.
+        for( uint32 l = 0; l < 16; ++l )
+            ctx.Clear( block, block.Rect(), *policies[p] );
+        ctx.Finish();
+
+        uint64 startAllocs = sNumAllocs;
+        auto startTime = std::chrono::steady_clock::now();
+        for( uint32 l = 0; l < repeat; ++l )
+            ctx.Clear( block, block.Rect(), *policies[p] );
+        ctx.Finish();
+        auto endTime = std::chrono::steady_clock::now();
+        uint64 endAllocs = sNumAllocs;
+
+        double allocs = static_cast< double >( endAllocs - startAllocs ) / repeat;
+        double us = static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / repeat;
+        std::cout << std::setw( 16 ) << names[p] << std::setw( 14 ) << std::fixed << std::setprecision( 2 ) << allocs << std::setw( 14 ) << us << std::endl;
+    }
+
+    return  0;
+}
@@ -0,0 +1,75 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandFusion.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the fusion of point-wise commands.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: CommandFusion [size] [repeat] [workers]
+// Runs chains of point-wise commands on the same square block, with hazard
+// tracking, first as separate commands then fused, and checks that both
+// produce the same pixels. The frame chain is Clear, Fill, Blend,
+// Premultiply. The streaming chain is made of cheap memory bound commands:
+// Clear, Fill, FillPreserveAlpha, Swap.
+double
+RunScenario( bool iStreaming, bool iFusion, int iSize, uint32 iRepeat, uint32 iWorkers, FBlock& oResult ) {
+    FThreadPool pool( iWorkers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    queue.SetCommandFusion( iFusion );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock src( iSize, iSize, fmt );
+    ctx.Fill( src, FColor::RGBA8( 0, 0, 255, 64 ), src.Rect(), FSchedulePolicy::MultiScanlines );
+    ctx.Finish();
+
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 l = 0; l < iRepeat; ++l ) {
+        ctx.Clear( oResult, oResult.Rect(), FSchedulePolicy::MultiScanlines );
+        ctx.Fill( oResult, FColor::RGBA8( 255, 0, 0, 127 ), oResult.Rect(), FSchedulePolicy::MultiScanlines );
+        if( iStreaming ) {
+            ctx.FillPreserveAlpha( oResult, FColor::RGBA8( 0, 255, 0 ), oResult.Rect(), FSchedulePolicy::MultiScanlines );
+            ctx.Swap( oResult, 0, 2, oResult.Rect(), FSchedulePolicy::MultiScanlines );
+        } else {
+            ctx.Blend( src, oResult, src.Rect(), FVec2I( 0 ), Blend_Normal, Alpha_Normal, 1.f, FSchedulePolicy::MultiScanlines );
+            ctx.Premultiply( oResult, oResult.Rect(), FSchedulePolicy::MultiScanlines );
+        }
+        ctx.Finish();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    return  static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / 1000.0 / static_cast< double >( iRepeat );
+}
+
+int main( int argc, char *argv[] ) {
+    int size = argc > 1 ? std::stoi( argv[1] ) : 4096;
+    uint32 repeat = argc > 2 ? std::stoul( argv[2] ) : 20;
+    uint32 workers = argc > 3 ? std::stoul( argv[3] ) : FThreadPool::MaxWorkers();
+
+    const char* names[] = { "frame", "streaming" };
+    bool match = true;
+    std::cout << "size: " << size << "x" << size << " repeat: " << repeat << " workers: " << workers << std::endl;
+    std::cout << std::setw( 10 ) << "chain" << std::setw( 14 ) << "unfused ms" << std::setw( 14 ) << "fused ms" << std::setw( 10 ) << "speedup" << std::setw( 8 ) << "match" << std::endl;
+    for( int c = 0; c < 2; ++c ) {
+        FBlock unfused( size, size, Format_RGBA8 );
+        FBlock fused( size, size, Format_RGBA8 );
+        double unfusedMs = RunScenario( c == 1, false, size, repeat, workers, unfused );
+        double fusedMs = RunScenario( c == 1, true, size, repeat, workers, fused );
+        bool same = std::memcmp( unfused.Bits(), fused.Bits(), unfused.BytesTotal() ) == 0;
+        match = match && same;
+        std::cout << std::setw( 10 ) << names[c] << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << unfusedMs << std::setw( 14 ) << fusedMs << std::setw( 10 ) << std::setprecision( 2 ) << unfusedMs / fusedMs << std::setw( 8 ) << ( same ? "yes" : "NO" ) << std::endl;
+    }
+
+    return  match ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandMetrics.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the metrics of commands and operations.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: CommandMetrics [iterations] [workers] [size]
+// Runs a few operations with metrics enabled and reports the throughput of
+// each, in megapixels per second of wall time and of CPU time. Also checks
+// the metrics of a single command read through its event.
+static const char* sPaths[] = { "MEM", "SSE", "AVX" };
+
+int main( int argc, char *argv[] ) {
+    uint32 iterations = argc > 1 ? std::stoul( argv[1] ) : 20;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    int size = argc > 3 ? std::stoi( argv[3] ) : 1024;
+
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock src( size, size, fmt );
+    FBlock dst( size, size, fmt );
+    FKernel box( FVec2I( 3 ), 1.f / 9.f );
+
+    // Without metrics, events have none.
+    FEvent untracked;
+    ctx.Fill( src, FColor::RGBA8( 255, 0, 0, 128 ), src.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &untracked );
+    ctx.Finish();
+    FCommandMetrics metrics;
+    bool ok = !untracked.Metrics( &metrics );
+
+    ctx.SetMetricsEnabled( true );
+    FEvent copy;
+    ctx.Copy( src, dst, src.Rect(), FVec2I( 0 ), FSchedulePolicy::MultiScanlines, 0, nullptr, &copy );
+    ctx.Finish();
+    const uint64 area = static_cast< uint64 >( size ) * size;
+    ok = ok
+        && copy.Metrics( &metrics )
+        && metrics.numJobs > 0
+        && metrics.pixels == area
+        && metrics.bytesRead == area * 4
+        && metrics.bytesWritten == area * 4
+        && metrics.wallTime > 0;
+    ctx.ResetMetrics();
+
+    const float half = size / 2.f;
+    FMat3F mat = FMat3F::MakeTranslationMatrix( half, half ) * FMat3F::MakeRotationMatrix( 0.1f ) * FMat3F::MakeTranslationMatrix( -half, -half );
+    for( uint32 i = 0; i < iterations; ++i ) {
+        ctx.Fill( src, FColor::RGBA8( 255, 0, 0, 128 ), src.Rect() );
+        ctx.Finish();
+        ctx.Blend( src, dst, src.Rect(), FVec2I( 0 ), Blend_Normal, Alpha_Normal, 0.5f );
+        ctx.Finish();
+        ctx.Convolve( src, dst, box, src.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ) );
+        ctx.Finish();
+        ctx.TransformAffine( src, dst, src.Rect(), mat, Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ) );
+        ctx.Finish();
+    }
+
+    TArray< FOperationMetrics > operations;
+    ctx.OperationMetrics( &operations );
+    std::cout << "iterations: " << iterations << " workers: " << workers << " size: " << size << "x" << size << std::endl;
+    std::cout << std::setw( 16 ) << "operation" << std::setw( 10 ) << "commands" << std::setw( 8 ) << "jobs" << std::setw( 8 ) << "path"
+              << std::setw( 12 ) << "Mpx/s" << std::setw( 12 ) << "Mpx/s CPU" << std::setw( 10 ) << "GB/s" << std::endl;
+    std::cout << std::fixed << std::setprecision( 1 );
+    for( uint64 i = 0; i < operations.Size(); ++i ) {
+        const FOperationMetrics& op = operations[i];
+        std::cout << std::setw( 16 ) << op.operation << std::setw( 10 ) << op.numCommands << std::setw( 8 ) << op.numJobs << std::setw( 8 ) << sPaths[ op.dispatchPath ]
+                  << std::setw( 12 ) << op.pixels * 1000.0 / op.wallTime
+                  << std::setw( 12 ) << op.pixels * 1000.0 / op.cpuTime
+                  << std::setw( 10 ) << ( op.bytesRead + op.bytesWritten ) / static_cast< double >( op.wallTime ) << std::endl;
+        ok = ok && op.numCommands == iterations && op.pixels == area * iterations;
+    }
+    ok = ok && operations.Size() == 4;
+    std::cout << "metrics: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    return  ok ? 0 : 1;
+}
+
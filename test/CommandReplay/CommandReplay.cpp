@@ -0,0 +1,128 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         CommandReplay.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the replay of recorded FCommandList.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+using namespace ::ULIS;
+
+// Usage: CommandReplay [frames] [layers] [workers]
+// Composes a viewport every frame: layers blended on a canvas, then the
+// canvas rotated in the view. The frame is either issued call by call, or
+// recorded once and submitted again, with the same result. The issue time is
+// the time spent in the calls or in Submit(), before the flush. Also checks
+// that rebinding a layer to other storage is picked up by the replay.
+static const int sCanvasSize = 1024;
+static const int sLayerSize = 128;
+
+void
+IssueFrame( FContext& iCtx, const std::vector< std::unique_ptr< FBlock > >& iLayers, FBlock& iCanvas, FBlock& iView ) {
+    iCtx.Clear( iCanvas, iCanvas.Rect() );
+    for( size_t i = 0; i < iLayers.size(); ++i ) {
+        const FVec2I pos( static_cast< int >( ( i * 97 ) % ( sCanvasSize - sLayerSize ) ), static_cast< int >( ( i * 53 ) % ( sCanvasSize - sLayerSize ) ) );
+        iCtx.Blend( *iLayers[i], iCanvas, iLayers[i]->Rect(), pos, Blend_Normal, Alpha_Normal, 0.8f, FSchedulePolicy::MultiScanlines );
+    }
+    const float half = sCanvasSize / 2.f;
+    FMat3F mat = FMat3F::MakeTranslationMatrix( half, half ) * FMat3F::MakeRotationMatrix( 0.1f ) * FMat3F::MakeTranslationMatrix( -half, -half );
+    iCtx.TransformAffine( iCanvas, iView, iCanvas.Rect(), mat, Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines );
+}
+
+void
+Noise( uint8* oBits, uint64 iSize, uint32 iSeed ) {
+    for( uint64 i = 0; i < iSize; ++i )
+        oBits[i] = static_cast< uint8 >( ( ( i + iSeed ) * 2654435761u ) >> 13 );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 frames = argc > 1 ? std::stoul( argv[1] ) : 200;
+    uint32 numLayers = argc > 2 ? std::stoul( argv[2] ) : 64;
+    uint32 workers = argc > 3 ? std::stoul( argv[3] ) : FThreadPool::MaxWorkers();
+
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+
+    std::vector< std::unique_ptr< FBlock > > layers;
+    for( uint32 i = 0; i < numLayers; ++i ) {
+        layers.emplace_back( new FBlock( sLayerSize, sLayerSize, fmt ) );
+        Noise( layers.back()->Bits(), layers.back()->BytesTotal(), i );
+    }
+    FBlock canvas( sCanvasSize, sCanvasSize, fmt );
+    FBlock view( sCanvasSize, sCanvasSize, fmt );
+    FBlock expected( sCanvasSize, sCanvasSize, fmt );
+
+    // Reference, issued call by call.
+    double issueMs = 0.0;
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < frames; ++f ) {
+        auto issueTime = std::chrono::steady_clock::now();
+        IssueFrame( ctx, layers, canvas, view );
+        issueMs += std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - issueTime ).count() / 1000.0;
+        ctx.Finish();
+    }
+    double frameMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+    std::memcpy( expected.Bits(), view.Bits(), view.BytesTotal() );
+
+    // Recorded once, submitted every frame.
+    FCommandList list;
+    queue.BeginRecording( list );
+    IssueFrame( ctx, layers, canvas, view );
+    queue.EndRecording();
+
+    ctx.Clear( view, view.Rect() );
+    ctx.Finish();
+    double replayIssueMs = 0.0;
+    startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < frames; ++f ) {
+        auto issueTime = std::chrono::steady_clock::now();
+        queue.Submit( list );
+        replayIssueMs += std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - issueTime ).count() / 1000.0;
+        ctx.Finish();
+    }
+    double replayFrameMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+    bool match = std::memcmp( expected.Bits(), view.Bits(), view.BytesTotal() ) == 0;
+
+    // Rebind the first layer to other storage, the replay must follow.
+    std::vector< uint8 > other( layers[0]->BytesTotal() );
+    Noise( other.data(), other.size(), 12345 );
+    IssueFrame( ctx, layers, canvas, view );
+    ctx.Finish();
+    bool unchanged = std::memcmp( expected.Bits(), view.Bits(), view.BytesTotal() ) == 0;
+    layers[0]->LoadFromData( other.data(), sLayerSize, sLayerSize, fmt );
+    IssueFrame( ctx, layers, canvas, view );
+    ctx.Finish();
+    std::memcpy( expected.Bits(), view.Bits(), view.BytesTotal() );
+    ctx.Clear( view, view.Rect() );
+    ctx.Finish();
+    FEvent submitted;
+    queue.Submit( list, 0, nullptr, &submitted );
+    ctx.Flush();
+    submitted.Wait();
+    bool rebound = std::memcmp( expected.Bits(), view.Bits(), view.BytesTotal() ) == 0;
+    ctx.Finish();
+
+    std::cout << "frames: " << frames << " layers: " << numLayers << " commands: " << list.Size() << " workers: " << workers << std::endl;
+    std::cout << std::setw( 10 ) << "" << std::setw( 14 ) << "issue ms" << std::setw( 14 ) << "frame ms" << std::endl;
+    std::cout << std::fixed << std::setprecision( 4 );
+    std::cout << std::setw( 10 ) << "calls" << std::setw( 14 ) << issueMs / frames << std::setw( 14 ) << frameMs / frames << std::endl;
+    std::cout << std::setw( 10 ) << "replay" << std::setw( 14 ) << replayIssueMs / frames << std::setw( 14 ) << replayFrameMs / frames << std::endl;
+    std::cout << "match: " << ( match ? "yes" : "NO" ) << " rebound: " << ( rebound && unchanged ? "yes" : "NO" ) << std::endl;
+
+    return  match && rebound && unchanged ? 0 : 1;
+}
+
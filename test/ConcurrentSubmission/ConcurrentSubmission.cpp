@@ -0,0 +1,97 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ConcurrentSubmission.cpp
+* @author       Clement Berthaud
+* @brief        Test application for commands pushed from several threads.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace ::ULIS;
+
+// Usage: ConcurrentSubmission [producers] [commands] [workers]
+// Several threads push fills on their own block in the same queue, while the
+// main thread flushes it. Without hazard tracking, the fills of a thread are
+// chained with events, and pushes are lock-free. With hazard tracking, they
+// are ordered by the queue. In both cases, the last fill of each thread must
+// win, and the rate of pushes is reported.
+double
+Run( bool iTracking, uint32 iProducers, uint32 iCommands, uint32 iWorkers, bool* oOk ) {
+    FThreadPool pool( iWorkers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( iTracking );
+    std::vector< std::unique_ptr< FBlock > > blocks;
+    for( uint32 p = 0; p < iProducers; ++p )
+        blocks.emplace_back( new FBlock( 8, 8, Format_RGBA8 ) );
+
+    std::atomic_uint32_t numDone( 0 );
+    std::vector< std::thread > producers;
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 p = 0; p < iProducers; ++p ) {
+        producers.emplace_back( [&, p]() {
+            FContext ctx( queue, Format_RGBA8, PerformanceIntent_Max );
+            FBlock& block = *blocks[p];
+            std::unique_ptr< FEvent[] > events( iTracking ? nullptr : new FEvent[ iCommands ] );
+            for( uint32 k = 0; k < iCommands; ++k ) {
+                const FColor color = FColor::RGBA8( k & 0xFF, ( k >> 8 ) & 0xFF, p, 255 );
+                if( iTracking )
+                    ctx.Fill( block, color, block.Rect(), FSchedulePolicy::MonoScanlines );
+                else
+                    ctx.Fill( block, color, block.Rect(), FSchedulePolicy::MonoScanlines, k ? 1 : 0, k ? &events[ k - 1 ] : nullptr, &events[k] );
+            }
+            ++numDone;
+
+            // Events must outlive their commands.
+            if( !iTracking )
+                events[ iCommands - 1 ].Wait();
+        } );
+    }
+
+    while( numDone < iProducers ) {
+        queue.Flush();
+        std::this_thread::yield();
+    }
+    queue.Finish();
+    for( auto& t : producers )
+        t.join();
+    auto endTime = std::chrono::steady_clock::now();
+
+    const uint32 last = iCommands - 1;
+    for( uint32 p = 0; p < iProducers; ++p ) {
+        const uint8* pixel = blocks[p]->Bits();
+        *oOk = *oOk && pixel[0] == ( last & 0xFF ) && pixel[1] == ( ( last >> 8 ) & 0xFF ) && pixel[2] == p;
+    }
+    const double seconds = std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() / 1e6;
+    return  iProducers * iCommands / seconds;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 producers = argc > 1 ? std::stoul( argv[1] ) : 4;
+    uint32 commands = argc > 2 ? std::stoul( argv[2] ) : 5000;
+    uint32 workers = argc > 3 ? std::stoul( argv[3] ) : FThreadPool::MaxWorkers();
+
+    std::cout << "producers: " << producers << " commands: " << commands << " workers: " << workers << std::endl;
+    std::cout << std::setw( 12 ) << "path" << std::setw( 16 ) << "commands/s" << std::setw( 8 ) << "order" << std::endl;
+    bool ok = true;
+    const char* names[] = { "lock-free", "tracking" };
+    for( int t = 0; t < 2; ++t ) {
+        bool order = true;
+        const double rate = Run( t == 1, producers, commands, workers, &order );
+        ok = ok && order;
+        std::cout << std::setw( 12 ) << names[t] << std::setw( 16 ) << std::fixed << std::setprecision( 0 ) << rate << std::setw( 8 ) << ( order ? "yes" : "NO" ) << std::endl;
+    }
+
+    return  ok ? 0 : 1;
+}
+
@@ -0,0 +1,116 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         EventCancel.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the cancellation of commands with FEvent.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+using namespace ::ULIS;
+
+// Usage: EventCancel [workers]
+// Checks the status and the side effects of cancelled commands: queued ones,
+// their dependents, commands ordered after them by hazard tracking, and a
+// long running convolution cancelled while in flight.
+static bool sOk = true;
+
+void
+Check( bool iCondition, const char* iWhat ) {
+    std::cout << ( iCondition ? "ok   " : "FAIL " ) << iWhat << std::endl;
+    sOk = sOk && iCondition;
+}
+
+bool
+IsFilledWith( const FBlock& iBlock, uint8 iValue ) {
+    for( uint64 i = 0; i < iBlock.BytesTotal(); ++i )
+        if( iBlock.Bits()[i] != iValue )
+            return  false;
+    return  true;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock a( 256, 256, fmt );
+    FBlock b( 256, 256, fmt );
+
+    // A queued command and its dependent, both dropped.
+    {
+        ctx.Clear( a, a.Rect() );
+        ctx.Clear( b, b.Rect() );
+        ctx.Finish();
+        FEvent fillA;
+        FEvent fillB;
+        ctx.Fill( a, FColor::RGBA8( 255, 255, 255, 255 ), a.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &fillA );
+        ctx.Fill( b, FColor::RGBA8( 255, 255, 255, 255 ), b.Rect(), FSchedulePolicy::MultiScanlines, 1, &fillA, &fillB );
+        Check( fillA.Cancel(), "queued command can be cancelled" );
+        ctx.Finish();
+        Check( fillA.Status() == EventStatus_Cancelled, "queued command reports cancelled" );
+        Check( fillB.Status() == EventStatus_Cancelled, "dependent command reports cancelled" );
+        Check( IsFilledWith( a, 0 ) && IsFilledWith( b, 0 ), "cancelled commands did not run" );
+        Check( !fillA.Cancel(), "cancelled command cannot be cancelled again" );
+    }
+
+    // A command ordered after a cancelled one by hazard tracking still runs.
+    {
+        queue.SetHazardTracking( true );
+        FEvent fill;
+        FEvent clear;
+        ctx.Fill( a, FColor::RGBA8( 255, 255, 255, 255 ), a.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &fill );
+        ctx.Clear( a, a.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &clear );
+        fill.Cancel();
+        ctx.Finish();
+        Check( clear.Status() == EventStatus_Finished, "hazard ordered command still runs" );
+        queue.SetHazardTracking( false );
+    }
+
+    // A finished command cannot be cancelled.
+    {
+        FEvent fill;
+        ctx.Fill( a, FColor::RGBA8( 255, 255, 255, 255 ), a.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &fill );
+        ctx.Finish();
+        Check( !fill.Cancel() && fill.Status() == EventStatus_Finished, "finished command cannot be cancelled" );
+        Check( IsFilledWith( a, 255 ), "finished command did run" );
+    }
+
+    // An in-flight convolution stops early, without waiting for completion.
+    {
+        FBlock src( 1024, 1024, fmt );
+        FBlock dst( 1024, 1024, fmt );
+        FKernel box( FVec2I( 9 ), 1.f / 81.f );
+        ctx.Fill( src, FColor::RGBA8( 0, 0, 255, 64 ), src.Rect() );
+        ctx.Finish();
+
+        auto startTime = std::chrono::steady_clock::now();
+        ctx.Convolve( src, dst, box, src.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines );
+        ctx.Finish();
+        auto fullTime = std::chrono::steady_clock::now() - startTime;
+
+        FEvent convolve;
+        startTime = std::chrono::steady_clock::now();
+        ctx.Convolve( src, dst, box, src.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines, 0, nullptr, &convolve );
+        ctx.Flush();
+        std::this_thread::sleep_for( fullTime / 10 );
+        Check( convolve.Cancel(), "in-flight command can be cancelled" );
+        convolve.Wait();
+        auto cancelledTime = std::chrono::steady_clock::now() - startTime;
+        ctx.Finish();
+        Check( convolve.Status() == EventStatus_Cancelled, "in-flight command reports cancelled" );
+        Check( cancelledTime < fullTime / 2, "in-flight command stops early" );
+        std::cout << "full: " << std::chrono::duration_cast< std::chrono::milliseconds >( fullTime ).count() << " ms, cancelled: " << std::chrono::duration_cast< std::chrono::milliseconds >( cancelledTime ).count() << " ms" << std::endl;
+    }
+
+    return  sOk ? 0 : 1;
+}
+
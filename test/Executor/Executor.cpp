@@ -0,0 +1,184 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         Executor.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the IExecutor interface of FThreadPool.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace ::ULIS;
+
+// Usage: Executor [frames] [threads]
+// Runs the same frames of blends and convolutions on the built-in workers,
+// on a host task system through an IExecutor, and through a
+// FCallbackExecutor, then checks that all of them give the same pixels.
+
+// A minimal host task system: a few threads and one shared deque.
+class FHostTasks
+{
+public:
+    ~FHostTasks() {
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            bStop = true;
+        }
+        cvTask.notify_all();
+        for( auto& t : mThreads )
+            t.join();
+    }
+
+    FHostTasks( uint32 iNumThreads ) {
+        for( uint32 i = 0; i < iNumThreads; ++i )
+            mThreads.emplace_back( [this](){ Run(); } );
+    }
+
+    uint32 NumThreads() const {
+        return  static_cast< uint32 >( mThreads.size() );
+    }
+
+    void Submit( std::function< void() >&& iTask ) {
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            mTasks.push_back( std::move( iTask ) );
+        }
+        cvTask.notify_one();
+    }
+
+    uint64 NumRun() const {
+        return  mNumRun;
+    }
+
+private:
+    void Run() {
+        while( true ) {
+            std::unique_lock< std::mutex > lock( mMutex );
+            cvTask.wait( lock, [this](){ return bStop || !mTasks.empty(); } );
+            if( mTasks.empty() )
+                return;
+            std::function< void() > task = std::move( mTasks.front() );
+            mTasks.pop_front();
+            lock.unlock();
+            task();
+            ++mNumRun;
+        }
+    }
+
+    std::vector< std::thread > mThreads;
+    std::deque< std::function< void() > > mTasks;
+    std::mutex mMutex;
+    std::condition_variable cvTask;
+    std::atomic_uint64_t mNumRun { 0 };
+    bool bStop = false;
+};
+
+// The host task system seen through the interface.
+class FHostExecutor
+    : public IExecutor
+{
+public:
+    FHostExecutor( FHostTasks& iTasks )
+        : mTasks( iTasks )
+    {}
+
+    uint32 Concurrency() const override {
+        return  mTasks.NumThreads();
+    }
+
+    void Dispatch( fpExecutorTask iTask, void* iData, eCommandQueuePriority ) override {
+        mTasks.Submit( [iTask, iData](){ iTask( iData ); } );
+    }
+
+private:
+    FHostTasks& mTasks;
+};
+
+// The host task system seen through a callback.
+void
+DispatchToHost( fpExecutorTask iTask, void* iData, eCommandQueuePriority, void* iInfo ) {
+    static_cast< FHostTasks* >( iInfo )->Submit( [iTask, iData](){ iTask( iData ); } );
+}
+
+double
+RunFrames( FThreadPool& iPool, FBlock& iOut, uint32 iFrames ) {
+    FCommandQueue queue( iPool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock dab( 64, 64, fmt );
+    FBlock canvas( 512, 512, fmt );
+    FKernel box( FVec2I( 3 ), 1.f / 9.f );
+    ctx.Fill( dab, FColor::RGBA8( 255, 0, 0, 128 ), dab.Rect() );
+    ctx.Clear( canvas, canvas.Rect() );
+    ctx.Finish();
+
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < iFrames; ++f ) {
+        for( int i = 0; i < 32; ++i )
+            ctx.Blend( dab, canvas, dab.Rect(), FVec2I( ( f * 37 + i * 29 ) % 448, ( f * 23 + i * 13 ) % 448 ), Blend_Normal, Alpha_Normal, 0.5f, FSchedulePolicy::MultiScanlines );
+        ctx.Convolve( canvas, iOut, box, canvas.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines );
+        ctx.Finish();
+    }
+    return  std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 frames = argc > 1 ? std::stoul( argv[1] ) : 50;
+    uint32 threads = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+
+    eFormat fmt = Format_RGBA8;
+    FBlock ref( 512, 512, fmt );
+    FBlock viaInterface( 512, 512, fmt );
+    FBlock viaCallback( 512, 512, fmt );
+
+    FThreadPool pool( threads );
+    const double builtinMs = RunFrames( pool, ref, frames );
+
+    FHostTasks tasks( threads );
+    double interfaceMs = 0.0;
+    double callbackMs = 0.0;
+    bool ok = true;
+    {
+        FHostExecutor executor( tasks );
+        FThreadPool hosted( executor );
+        ok = ok && hosted.Executor() == &executor && hosted.GetNumWorkers() == threads;
+        interfaceMs = RunFrames( hosted, viaInterface, frames );
+    }
+    const uint64 numInterfaceTasks = tasks.NumRun();
+    {
+        FCallbackExecutor executor( tasks.NumThreads(), FOnDispatchTask( &DispatchToHost, &tasks ) );
+        FThreadPool hosted( executor );
+        callbackMs = RunFrames( hosted, viaCallback, frames );
+    }
+
+    const uint64 bytes = ref.BytesTotal();
+    ok = ok
+        && numInterfaceTasks > 0
+        && tasks.NumRun() > numInterfaceTasks
+        && memcmp( ref.Bits(), viaInterface.Bits(), bytes ) == 0
+        && memcmp( ref.Bits(), viaCallback.Bits(), bytes ) == 0;
+
+    std::cout << "frames: " << frames << " threads: " << threads << " host tasks: " << tasks.NumRun() << std::endl;
+    std::cout << std::fixed << std::setprecision( 4 );
+    std::cout << std::setw( 10 ) << "built-in" << std::setw( 14 ) << builtinMs / frames << " ms/frame" << std::endl;
+    std::cout << std::setw( 10 ) << "executor" << std::setw( 14 ) << interfaceMs / frames << " ms/frame" << std::endl;
+    std::cout << std::setw( 10 ) << "callback" << std::setw( 14 ) << callbackMs / frames << " ms/frame" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    return  ok ? 0 : 1;
+}
+
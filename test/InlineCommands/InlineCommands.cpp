@@ -0,0 +1,75 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         InlineCommands.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for tiny commands run inline.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: InlineCommands [frames] [workers] [dab]
+// Runs strokes of small overlapping blends, with hazard tracking, through the
+// pool, inline, and with the automatic policy, and reports the time per dab.
+// Every few frames the canvas is refilled in the same flush as the stroke, so
+// that the first dabs wait for a command of the pool. All policies must
+// produce the same pixels.
+double
+RunStrokes( const FSchedulePolicy& iPolicy, uint32 iFrames, uint32 iWorkers, int iDab, FBlock& oCanvas ) {
+    FThreadPool pool( iWorkers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock dab( iDab, iDab, fmt );
+    ctx.Fill( dab, FColor::RGBA8( 255, 0, 0, 64 ), dab.Rect() );
+    ctx.Clear( oCanvas, oCanvas.Rect() );
+    ctx.Finish();
+
+    const int range = oCanvas.Width() - iDab;
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < iFrames; ++f ) {
+        if( f % 8 == 0 )
+            ctx.Fill( oCanvas, FColor::RGBA8( 0, 0, 255, 255 ), oCanvas.Rect(), FSchedulePolicy::MultiScanlines );
+        for( int i = 0; i < 64; ++i )
+            ctx.Blend( dab, oCanvas, dab.Rect(), FVec2I( ( f * 37 + i * 5 ) % range, ( f * 23 + i * 3 ) % range ), Blend_Normal, Alpha_Normal, 0.5f, iPolicy );
+        ctx.Finish();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    return  static_cast< double >( std::chrono::duration_cast< std::chrono::nanoseconds >( endTime - startTime ).count() ) / 1000.0 / ( iFrames * 64.0 );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 frames = argc > 1 ? std::stoul( argv[1] ) : 200;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    int size = argc > 3 ? std::stoi( argv[3] ) : 16;
+
+    const char* names[] = { "pool", "inline", "auto" };
+    const FSchedulePolicy policies[] = { FSchedulePolicy::MultiScanlines, FSchedulePolicy::Inline, FSchedulePolicy::Auto };
+    FBlock reference( 256, 256, Format_RGBA8 );
+    bool match = true;
+    double poolUs = 0.0;
+    std::cout << "frames: " << frames << " workers: " << workers << " dab: " << size << "x" << size << std::endl;
+    std::cout << std::setw( 10 ) << "policy" << std::setw( 12 ) << "us/dab" << std::setw( 10 ) << "speedup" << std::setw( 8 ) << "match" << std::endl;
+    for( int p = 0; p < 3; ++p ) {
+        FBlock canvas( 256, 256, Format_RGBA8 );
+        const double us = RunStrokes( policies[p], frames, workers, size, p == 0 ? reference : canvas );
+        const bool same = p == 0 || std::memcmp( reference.Bits(), canvas.Bits(), canvas.BytesTotal() ) == 0;
+        if( p == 0 )
+            poolUs = us;
+        match = match && same;
+        std::cout << std::setw( 10 ) << names[p] << std::setw( 12 ) << std::fixed << std::setprecision( 3 ) << us << std::setw( 10 ) << std::setprecision( 2 ) << poolUs / us << std::setw( 8 ) << ( same ? "yes" : "NO" ) << std::endl;
+    }
+
+    return  match ? 0 : 1;
+}
+
@@ -0,0 +1,169 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         LargeBlock.cpp
+* @author       Clement Berthaud
+* @brief        Test application for FLargeBlock.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: LargeBlock [workers]
+// Resizes and converts large blocks and dense blocks and checks that they
+// give the same pixels, then fills, blends and resizes a 200000x150000
+// poster and reports its memory.
+
+// Largest difference between two blocks of the same size and RGBA format.
+// The color of the pixels that are transparent in both is not compared, the
+// resampling leaves it undefined.
+int
+MaxDifference( const FBlock& iA, const FBlock& iB )
+{
+    const uint8 bpp = iA.BytesPerPixel();
+    const uint8 bpc = bpp / 4;
+    int diff = 0;
+    for( uint64 p = 0; p < iA.BytesTotal(); p += bpp ) {
+        bool transparent = true;
+        for( uint8 i = bpp - bpc; i < bpp; ++i )
+            transparent = transparent && iA.Bits()[p + i] == 0 && iB.Bits()[p + i] == 0;
+        if( transparent )
+            continue;
+
+        for( uint8 i = 0; i < bpp; ++i )
+            diff = FMath::Max( diff, std::abs( int( iA.Bits()[p + i] ) - int( iB.Bits()[p + i] ) ) );
+    }
+    return  diff;
+}
+
+// Read a region of a tiled block in a dense block.
+int
+MaxDifference( FContext& iCtx, const FTiledBlock& iTiled, const FBlock& iDense )
+{
+    FBlock read( iDense.Width(), iDense.Height(), iDense.Format() );
+    iCtx.Copy( iTiled, read, FRectI( 0, 0, iDense.Width(), iDense.Height() ) );
+    iCtx.Finish();
+    return  MaxDifference( read, iDense );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FContext ctx16( queue, Format_RGBA16, PerformanceIntent_Max );
+    TTilePool< Micro_128, Macro_1024 > tiles( fmt );
+    TTilePool< Micro_128, Macro_1024 > tiles16( Format_RGBA16 );
+
+    // A dense source and the same pixels in a large block.
+    FBlock dense( 700, 500, fmt );
+    FBlock dab( 96, 96, fmt );
+    ctx.Clear( dense, dense.Rect() );
+    ctx.Fill( dab, FColor::RGBA8( 0, 128, 255, 160 ), dab.Rect() );
+    ctx.Fill( dense, FColor::RGBA8( 255, 0, 0, 255 ), FRectI( 50, 40, 500, 300 ) );
+    for( int i = 0; i < 12; ++i )
+        ctx.Blend( dab, dense, dab.Rect(), FVec2I( 20 + i * 53, 30 + ( i * 97 ) % 400 ), Blend_Normal, Alpha_Normal, 0.5f );
+    ctx.Finish();
+    FLargeBlock* large = tiles.CreateNewLargeBlock( dense.Width(), dense.Height() );
+    ctx.Copy( dense, *large );
+    ctx.Finish();
+    bool ok = MaxDifference( ctx, *large, dense ) == 0;
+
+    // Upscale into a dense block and into large blocks, from both sources.
+    // Each tile is resized with the scale of the whole rect.
+    const FRectF upRect( 10.5f, 20.25f, 1300.f, 900.f );
+    FBlock up( 1400, 1000, fmt );
+    FBlock upFromLarge( 1400, 1000, fmt );
+    FLargeBlock* largeUp = tiles.CreateNewLargeBlock( 1400, 1000 );
+    FLargeBlock* largeUpFromDense = tiles.CreateNewLargeBlock( 1400, 1000 );
+    ctx.Clear( up, up.Rect() );
+    ctx.Clear( upFromLarge, upFromLarge.Rect() );
+    ctx.Resize( dense, up, dense.Rect(), upRect, Resampling_Bilinear );
+    ctx.Resize( *large, upFromLarge, FRectI::Auto, upRect, Resampling_Bilinear );
+    ctx.Resize( *large, *largeUp, FRectI::Auto, upRect, Resampling_Bilinear );
+    ctx.Resize( dense, *largeUpFromDense, dense.Rect(), upRect, Resampling_Bilinear );
+    ctx.Finish();
+    const int upDiff = FMath::Max( MaxDifference( upFromLarge, up ), FMath::Max( MaxDifference( ctx, *largeUp, up ), MaxDifference( ctx, *largeUpFromDense, up ) ) );
+    ok = ok && upDiff <= 1;
+
+    // Area downscale, from both sources.
+    FBlock down( 175, 125, fmt );
+    FBlock downFromLarge( 175, 125, fmt );
+    FLargeBlock* largeDown = tiles.CreateNewLargeBlock( 175, 125 );
+    ctx.Resize( dense, down, dense.Rect(), FRectF( 0.f, 0.f, 175.f, 125.f ), Resampling_Area );
+    ctx.Resize( *large, downFromLarge, FRectI::Auto, FRectF( 0.f, 0.f, 175.f, 125.f ), Resampling_Area );
+    ctx.Resize( dense, *largeDown, dense.Rect(), FRectF::Auto, Resampling_Area );
+    ctx.Finish();
+    const int downDiff = FMath::Max( MaxDifference( downFromLarge, down ), MaxDifference( ctx, *largeDown, down ) );
+    ok = ok && downDiff <= 2;
+
+    // Conversion into a large block of another format.
+    FBlock dense16( dense.Width(), dense.Height(), Format_RGBA16 );
+    FLargeBlock* large16 = tiles16.CreateNewLargeBlock( dense.Width(), dense.Height() );
+    ctx.ConvertFormat( dense, dense16 );
+    ctx16.ConvertFormat( *large, *large16, FRectI::Auto, FVec2I( 0 ) );
+    ctx.Finish();
+    ok = ok && MaxDifference( ctx16, *large16, dense16 ) == 0;
+
+    tiles.RequestTiledBlockDeletion( largeDown );
+    tiles.RequestTiledBlockDeletion( largeUpFromDense );
+    tiles.RequestTiledBlockDeletion( largeUp );
+    tiles.RequestTiledBlockDeletion( large );
+    tiles16.RequestTiledBlockDeletion( large16 );
+    tiles.PurgeAllNow();
+
+    // A poster far beyond the 65535 pixels of a FBlock. The fill shares a
+    // single tile, and the blends are clipped to the bounds.
+    auto startTime = std::chrono::steady_clock::now();
+    FLargeBlock* poster = tiles.CreateNewLargeBlock( 200000, 150000 );
+    ctx.Fill( *poster, FColor::RGBA8( 255, 255, 255, 255 ) );
+    for( int i = 0; i < 64; ++i )
+        ctx.Blend( dab, *poster, dab.Rect(), FVec2I( 199950 - i * 1000, 149950 - i * 700 ), Blend_Normal, Alpha_Normal, 1.f );
+    ctx.Finish();
+    const double paintMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+
+    // The corner holds the clipped dab, the pixels beyond the bounds are
+    // not read.
+    FBlock corner( 200, 200, fmt );
+    ctx.Clear( corner, corner.Rect() );
+    ctx.Copy( *poster, corner, FRectI( 199900, 149900, 200, 200 ) );
+    ctx.Finish();
+    ok = ok
+        && corner.PixelBits( 10, 10 )[0] == 255
+        && corner.PixelBits( 99, 99 )[0] < 128
+        && corner.PixelBits( 99, 99 )[3] >= 254
+        && corner.PixelBits( 100, 100 )[3] == 0;
+
+    // A thumbnail of a region, downscaled by 16 with a bounded memory.
+    queue.SetMemoryBudget( 64 * 1024 * 1024 );
+    startTime = std::chrono::steady_clock::now();
+    FBlock thumbnail( 512, 512, fmt );
+    ctx.Resize( *poster, thumbnail, FRectI( 100000, 100000, 8192, 8192 ), FRectF( 0.f, 0.f, 512.f, 512.f ), Resampling_Bilinear );
+    ctx.Finish();
+    const double thumbnailMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+    ok = ok
+        && thumbnail.PixelBits( 256, 256 )[0] == 255
+        && thumbnail.PixelBits( 256, 256 )[3] == 255;
+
+    const uint64 denseBytes = poster->Area() * 4;
+    const uint64 largeBytes = tiles.CurrentRAMUsage();
+    ok = ok && largeBytes < 64 * 1024 * 1024;
+
+    std::cout << "workers: " << workers << std::endl;
+    std::cout << "resize max difference: up " << upDiff << ", down " << downDiff << std::endl;
+    std::cout << "poster: " << poster->Width() << "x" << poster->Height() << ", " << poster->NumTiles() << " tiles, " << largeBytes / ( 1024 * 1024 ) << " MB instead of " << denseBytes / ( 1024 * 1024 ) << " MB" << std::endl;
+    std::cout << "paint: " << paintMs << " ms, thumbnail: " << thumbnailMs << " ms" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    return  ok ? 0 : 1;
+}
+
@@ -0,0 +1,123 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         MemoryBudget.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the memory budget of FCommandQueue.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+using namespace ::ULIS;
+
+// Usage: MemoryBudget [items] [workers] [budgetMB]
+// Runs a batch of load, resize and save chains, with each block allocated
+// by the producer right before its chain is pushed, as a batch pipeline
+// does. Reports the peak memory of the blocks alive and the time, without
+// and with a memory budget on the queue. An item holds a RGBA8 source and
+// a destination of half its size, five bytes per source pixel.
+struct FItem {
+    FItem( int iSize, eFormat iFormat )
+        : src( iSize, iSize, iFormat )
+        , dst( iSize / 2, iSize / 2, iFormat )
+    {}
+
+    FBlock src;
+    FBlock dst;
+    FEvent load;
+    FEvent resize;
+    FEvent save;
+};
+
+struct FRun {
+    double ms;
+    uint64 peakBytes;
+    uint64 peakInFlight;
+    uint32 peakItems;
+};
+
+FRun
+RunBatch( FThreadPool& iPool, uint32 iItems, uint64 iBudget, int iSize, const std::string& iInput ) {
+    FCommandQueue queue( iPool );
+    queue.SetMemoryBudget( iBudget );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+
+    FRun run = { 0.0, 0, 0, 0 };
+    std::vector< std::unique_ptr< FItem > > alive;
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 i = 0; i < iItems; ++i ) {
+        alive.emplace_back( new FItem( iSize, fmt ) );
+        FItem& item = *alive.back();
+        const std::string output = "MemoryBudget_" + std::to_string( i % 8 ) + ".png";
+        ctx.XLoadBlockFromDisk( item.src, iInput, FSchedulePolicy::MonoChunk, 0, nullptr, &item.load );
+        ctx.Resize( item.src, item.dst, item.src.Rect(), FRectF( 0, 0, iSize / 2.f, iSize / 2.f ), Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), nullptr, FSchedulePolicy::MultiScanlines, 1, &item.load, &item.resize );
+        ctx.SaveBlockToDisk( item.dst, output, FileFormat_png, 100, FSchedulePolicy::MonoChunk, 1, &item.resize, &item.save );
+        run.peakInFlight = FMath::Max( run.peakInFlight, queue.MemoryInFlight() );
+
+        // Release the items already saved, the others are still in use.
+        for( uint64 j = 0; j < alive.size(); ) {
+            if( alive[j]->save.Status() == EventStatus_Finished )
+                alive.erase( alive.begin() + j );
+            else
+                ++j;
+        }
+        run.peakItems = FMath::Max( run.peakItems, static_cast< uint32 >( alive.size() ) );
+    }
+    ctx.Finish();
+    run.peakBytes = run.peakItems * ( static_cast< uint64 >( iSize ) * iSize * 5 );
+    run.ms = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+    return  run;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 items = argc > 1 ? std::stoul( argv[1] ) : 64;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    uint64 budget = ( argc > 3 ? std::stoull( argv[3] ) : 8 ) * 1024 * 1024;
+    const int size = 512;
+
+    FThreadPool pool( workers );
+    const std::string input = "MemoryBudget_input.png";
+    {
+        FCommandQueue queue( pool );
+        FContext ctx( queue, Format_RGBA8 );
+        FBlock block( size, size, Format_RGBA8 );
+        ctx.Fill( block, FColor::RGBA8( 255, 128, 0, 255 ), block.Rect() );
+        ctx.Finish();
+        ctx.SaveBlockToDisk( block, input, FileFormat_png );
+        ctx.Finish();
+    }
+
+    const FRun unbounded = RunBatch( pool, items, 0, size, input );
+    const FRun bounded = RunBatch( pool, items, budget, size, input );
+
+    // The footprint of a chain is well under the budget, the queue never
+    // holds more, and the producer is held back along with it.
+    const bool ok = unbounded.peakInFlight == 0
+                 && bounded.peakInFlight > 0
+                 && bounded.peakInFlight <= budget
+                 && bounded.peakBytes < unbounded.peakBytes;
+
+    std::cout << "items: " << items << " workers: " << workers << " budget: " << budget / ( 1024 * 1024 ) << " MB"
+              << " available: " << FCommandQueue::AvailableMemoryBudget() / ( 1024 * 1024 ) << " MB" << std::endl;
+    std::cout << std::setw( 10 ) << "budget" << std::setw( 12 ) << "time ms" << std::setw( 14 ) << "peak MB" << std::setw( 14 ) << "in flight MB" << std::setw( 8 ) << "items" << std::endl;
+    std::cout << std::fixed << std::setprecision( 2 );
+    std::cout << std::setw( 10 ) << "none" << std::setw( 12 ) << unbounded.ms << std::setw( 14 ) << unbounded.peakBytes / 1048576.0 << std::setw( 14 ) << unbounded.peakInFlight / 1048576.0 << std::setw( 8 ) << unbounded.peakItems << std::endl;
+    std::cout << std::setw( 10 ) << "bounded" << std::setw( 12 ) << bounded.ms << std::setw( 14 ) << bounded.peakBytes / 1048576.0 << std::setw( 14 ) << bounded.peakInFlight / 1048576.0 << std::setw( 8 ) << bounded.peakItems << std::endl;
+    std::cout << "bounded: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    remove( input.c_str() );
+    for( int i = 0; i < 8; ++i )
+        remove( ( "MemoryBudget_" + std::to_string( i ) + ".png" ).c_str() );
+    return  ok ? 0 : 1;
+}
+
@@ -0,0 +1,107 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         QueuePriority.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the priority classes of FCommandQueue.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace ::ULIS;
+
+// Usage: QueuePriority [strokes] [workers] [exportSize]
+// Measures the latency of brush strokes, a few small Blend commands followed
+// by a Finish, while a background thread keeps resizing a large block through
+// another queue of the same pool. The background export runs either at the
+// same priority as the strokes, or at a lower one.
+struct FScenario {
+    const char* name;
+    bool background;
+    eCommandQueuePriority strokePriority;
+    eCommandQueuePriority exportPriority;
+};
+
+void
+RunScenario( const FScenario& iScenario, uint32 iStrokes, uint32 iWorkers, int iExportSize, std::vector< double >* oLatencies ) {
+    FThreadPool pool( iWorkers );
+    eFormat fmt = Format_RGBA8;
+    FBlock canvas( 1024, 1024, fmt );
+    FBlock dab( 64, 64, fmt );
+    FBlock exportSrc( iExportSize, iExportSize, fmt );
+    FBlock exportDst( iExportSize, iExportSize, fmt );
+
+    // Background export, resizing over and over until the strokes are done.
+    std::atomic_bool stop( false );
+    std::thread exporter( [&]() {
+        if( !iScenario.background )
+            return;
+        FCommandQueue queue( pool, iScenario.exportPriority );
+        FContext ctx( queue, fmt, PerformanceIntent_Max );
+        const float size = static_cast< float >( iExportSize );
+        while( !stop ) {
+            ctx.Resize( exportSrc, exportDst, exportSrc.Rect(), FRectF( 0, 0, size * 0.7f, size * 0.7f ), Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), nullptr, FSchedulePolicy::MultiScanlines );
+            ctx.Finish();
+        }
+    } );
+
+    FCommandQueue queue( pool, iScenario.strokePriority );
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    ctx.Fill( dab, FColor::RGBA8( 255, 0, 0, 64 ), dab.Rect() );
+    ctx.Finish();
+
+    // Let the export get going.
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    for( uint32 i = 0; i < iStrokes; ++i ) {
+        auto startTime = std::chrono::steady_clock::now();
+        for( int j = 0; j < 8; ++j )
+            ctx.Blend( dab, canvas, dab.Rect(), FVec2I( ( i * 37 + j * 16 ) % 960, ( i * 23 + j * 8 ) % 960 ), Blend_Normal, Alpha_Normal, 1.f, FSchedulePolicy::MultiScanlines );
+        ctx.Finish();
+        auto endTime = std::chrono::steady_clock::now();
+        oLatencies->push_back( static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / 1000.0 );
+
+        // Input events come at a limited rate.
+        std::this_thread::sleep_for( std::chrono::milliseconds( 4 ) );
+    }
+
+    stop = true;
+    exporter.join();
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 strokes = argc > 1 ? std::stoul( argv[1] ) : 100;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    int exportSize = argc > 3 ? std::stoi( argv[3] ) : 2048;
+
+    const FScenario scenarios[] = {
+          { "idle",         false,  CommandQueuePriority_High,      CommandQueuePriority_Low    }
+        , { "same",         true,   CommandQueuePriority_Normal,    CommandQueuePriority_Normal }
+        , { "prioritised",  true,   CommandQueuePriority_High,      CommandQueuePriority_Low    }
+    };
+
+    std::cout << "strokes: " << strokes << " workers: " << workers << " export: " << exportSize << "x" << exportSize << std::endl;
+    std::cout << std::setw( 12 ) << "export" << std::setw( 12 ) << "median ms" << std::setw( 12 ) << "p95 ms" << std::setw( 12 ) << "max ms" << std::endl;
+    for( const FScenario& scenario : scenarios ) {
+        std::vector< double > latencies;
+        RunScenario( scenario, strokes, workers, exportSize, &latencies );
+        std::sort( latencies.begin(), latencies.end() );
+        const size_t n = latencies.size();
+        std::cout << std::setw( 12 ) << scenario.name << std::fixed << std::setprecision( 3 )
+                  << std::setw( 12 ) << latencies[ n / 2 ]
+                  << std::setw( 12 ) << latencies[ ( n * 95 ) / 100 ]
+                  << std::setw( 12 ) << latencies[ n - 1 ] << std::endl;
+    }
+
+    return  0;
+}
+
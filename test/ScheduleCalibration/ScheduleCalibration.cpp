@@ -0,0 +1,110 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ScheduleCalibration.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the calibration of ScheduleMode_Auto.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: ScheduleCalibration [repeat] [workers]
+// Runs a few operations on square blocks of growing size with each of the
+// hand picked policies, then with FSchedulePolicy::Auto, and reports the time
+// of the best hand picked policy against the time of Auto.
+enum eOp { Op_Clear, Op_Fill, Op_Copy, Op_Blend, Op_Premultiply, Op_Convolve, Op_Count };
+static const char* sOpNames[] = { "Clear", "Fill", "Copy", "Blend", "Premultiply", "Convolve" };
+
+static const FSchedulePolicy* sPolicies[] = {
+      &FSchedulePolicy::MonoScanlines
+    , &FSchedulePolicy::MultiScanlines
+    , &FSchedulePolicy::MonoChunk
+    , &FSchedulePolicy::CacheEfficient
+    , &FSchedulePolicy::Auto
+};
+static const char* sPolicyNames[] = { "MonoScan", "MultiScan", "MonoChunk", "CacheEff", "Auto" };
+static const int sNumPolicies = 5;
+
+void
+Run( FContext& iCtx, eOp iOp, const FBlock& iSrc, FBlock& iDst, const FKernel& iKernel, const FSchedulePolicy& iPolicy ) {
+    switch( iOp ) {
+        case Op_Clear:          iCtx.Clear( iDst, iDst.Rect(), iPolicy ); break;
+        case Op_Fill:           iCtx.Fill( iDst, FColor::RGBA8( 255, 0, 0, 127 ), iDst.Rect(), iPolicy ); break;
+        case Op_Copy:           iCtx.Copy( iSrc, iDst, iSrc.Rect(), FVec2I( 0 ), iPolicy ); break;
+        case Op_Blend:          iCtx.Blend( iSrc, iDst, iSrc.Rect(), FVec2I( 0 ), Blend_Normal, Alpha_Normal, 1.f, iPolicy ); break;
+        case Op_Premultiply:    iCtx.Premultiply( iDst, iDst.Rect(), iPolicy ); break;
+        case Op_Convolve:       iCtx.Convolve( iSrc, iDst, iKernel, iSrc.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), iPolicy ); break;
+        default: break;
+    }
+}
+
+double
+Measure( eOp iOp, int iSize, uint32 iRepeat, uint32 iWorkers, const FSchedulePolicy& iPolicy ) {
+    FThreadPool pool( iWorkers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock src( iSize, iSize, fmt );
+    FBlock dst( iSize, iSize, fmt );
+    const FKernel& kernel = FKernel::GaussianBlur;
+    ctx.Fill( src, FColor::RGBA8( 0, 0, 255, 64 ), src.Rect() );
+    ctx.Finish();
+
+    // Warm up, then time enough repetitions to get above the timer resolution.
+    Run( ctx, iOp, src, dst, kernel, iPolicy );
+    ctx.Finish();
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 l = 0; l < iRepeat; ++l ) {
+        Run( ctx, iOp, src, dst, kernel, iPolicy );
+        ctx.Finish();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    return  static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / 1000.0 / static_cast< double >( iRepeat );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 repeat = argc > 1 ? std::stoul( argv[1] ) : 10;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    const int sizes[] = { 64, 256, 1024, 4096 };
+
+    std::cout << "workers: " << workers << " L1: " << FCPUInfo::L1CacheSize() << " L2: " << FCPUInfo::L2CacheSize() << std::endl;
+    std::cout << std::setw( 12 ) << "op" << std::setw( 6 ) << "size";
+    for( int p = 0; p < sNumPolicies; ++p )
+        std::cout << std::setw( 11 ) << sPolicyNames[p];
+    std::cout << std::setw( 11 ) << "best" << std::setw( 9 ) << "ratio" << std::endl;
+
+    double worst = 0.0;
+    for( int op = 0; op < Op_Count; ++op ) {
+        for( int size : sizes ) {
+            // Keep the total amount of pixels roughly constant per row.
+            const uint32 rep = FMath::Max( uint32( 1 ), static_cast< uint32 >( repeat * ( 1024.0 * 1024.0 ) / ( double( size ) * size ) ) );
+            double ms[ sNumPolicies ];
+            for( int p = 0; p < sNumPolicies; ++p )
+                ms[p] = Measure( static_cast< eOp >( op ), size, FMath::Min( rep, uint32( 4096 ) ), workers, *sPolicies[p] );
+
+            int best = 0;
+            for( int p = 1; p < sNumPolicies - 1; ++p )
+                if( ms[p] < ms[best] )
+                    best = p;
+            const double ratio = ms[ sNumPolicies - 1 ] / ms[best];
+            worst = FMath::Max( worst, ratio );
+
+            std::cout << std::setw( 12 ) << sOpNames[op] << std::setw( 6 ) << size << std::fixed << std::setprecision( 4 );
+            for( int p = 0; p < sNumPolicies; ++p )
+                std::cout << std::setw( 11 ) << ms[p];
+            std::cout << std::setw( 11 ) << sPolicyNames[best] << std::setw( 9 ) << std::setprecision( 2 ) << ratio << std::endl;
+        }
+    }
+    std::cout << "worst Auto / best ratio: " << std::setprecision( 2 ) << worst << std::endl;
+
+    return  0;
+}
+
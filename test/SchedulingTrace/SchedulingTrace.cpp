@@ -0,0 +1,82 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         SchedulingTrace.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for the cost of FSchedulingTrace.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: SchedulingTrace [frames] [workers] [path]
+// Runs frames of small blends and a larger convolution, with the trace
+// stopped and running in turns, and reports the time of both. The last
+// traced frames are dumped at path, for chrome://tracing or Perfetto.
+double
+RunFrames( FContext& iCtx, FBlock& iDab, FBlock& iCanvas, FBlock& iOut, const FKernel& iKernel, uint32 iFrames ) {
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < iFrames; ++f ) {
+        for( int i = 0; i < 32; ++i )
+            iCtx.Blend( iDab, iCanvas, iDab.Rect(), FVec2I( ( f * 37 + i * 29 ) % 448, ( f * 23 + i * 13 ) % 448 ), Blend_Normal, Alpha_Normal, 0.5f, FSchedulePolicy::MultiScanlines );
+        iCtx.Convolve( iCanvas, iOut, iKernel, iCanvas.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines );
+        iCtx.Finish();
+    }
+    return  std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 frames = argc > 1 ? std::stoul( argv[1] ) : 50;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    std::string path = argc > 3 ? argv[3] : "SchedulingTrace.json";
+
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock dab( 64, 64, fmt );
+    FBlock canvas( 512, 512, fmt );
+    FBlock out( 512, 512, fmt );
+    FKernel box( FVec2I( 3 ), 1.f / 9.f );
+    ctx.Fill( dab, FColor::RGBA8( 255, 0, 0, 128 ), dab.Rect() );
+    ctx.Clear( canvas, canvas.Rect() );
+    ctx.Finish();
+    RunFrames( ctx, dab, canvas, out, box, frames / 4 + 1 );
+
+    // Alternate, so that both see the same machine state.
+    double stoppedMs = 0.0;
+    double runningMs = 0.0;
+    for( int round = 0; round < 4; ++round ) {
+        stoppedMs += RunFrames( ctx, dab, canvas, out, box, frames );
+        FSchedulingTrace::Start();
+        runningMs += RunFrames( ctx, dab, canvas, out, box, frames );
+        FSchedulingTrace::Stop();
+    }
+    const bool dumped = FSchedulingTrace::Dump( path );
+
+    // The dump must hold the jobs of both operations.
+    std::ifstream file( path );
+    std::stringstream json;
+    json << file.rdbuf();
+    const bool complete = json.str().find( "\"name\":\"Blend\",\"cat\":\"job\"" ) != std::string::npos
+                       && json.str().find( "\"name\":\"Convolve\",\"cat\":\"job\"" ) != std::string::npos
+                       && json.str().find( "\"cat\":\"wait\"" ) != std::string::npos;
+
+    std::cout << "frames: " << frames << " workers: " << workers << " available: " << ( FSchedulingTrace::Available() ? "yes" : "no" ) << std::endl;
+    std::cout << std::fixed << std::setprecision( 4 );
+    std::cout << std::setw( 10 ) << "stopped" << std::setw( 14 ) << stoppedMs / ( 4 * frames ) << " ms/frame" << std::endl;
+    std::cout << std::setw( 10 ) << "running" << std::setw( 14 ) << runningMs / ( 4 * frames ) << " ms/frame" << std::endl;
+    std::cout << "dump: " << ( dumped && complete ? path : "NO" ) << std::endl;
+
+    return  !FSchedulingTrace::Available() || ( dumped && complete ) ? 0 : 1;
+}
+
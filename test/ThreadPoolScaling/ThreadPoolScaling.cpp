@@ -0,0 +1,72 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ThreadPoolScaling.cpp
+* @author       Clement Berthaud
+* @brief        Scaling benchmark application for the FThreadPool backends.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: ThreadPoolScaling [size] [repeat] [maxWorkers] [affinity]
+// Runs a MultiScanlines Fill followed by a MultiScanlines Blend on a square
+// block, for each backend and for each worker count from 1 to maxWorkers.
+// affinity is 0 for free workers, 1 for pinned workers, 2 for pinned workers
+// on distinct physical cores.
+double
+RunScenario( eThreadPoolBackend iBackend, eThreadPoolAffinity iAffinity, uint32 iWorkers, int iSize, uint32 iRepeat ) {
+    FThreadPool pool( iWorkers, iBackend, iAffinity );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock src( iSize, iSize, fmt );
+    FBlock dst( iSize, iSize, fmt );
+    ctx.Clear( src, src.Rect(), FSchedulePolicy::MultiScanlines );
+    ctx.Clear( dst, dst.Rect(), FSchedulePolicy::MultiScanlines );
+    ctx.Finish();
+
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 l = 0; l < iRepeat; ++l ) {
+        ctx.Fill( src, FColor::RGBA8( 255, 0, 0, 127 ), src.Rect(), FSchedulePolicy::MultiScanlines );
+        ctx.Finish();
+        ctx.Blend( src, dst, src.Rect(), FVec2I( 0 ), Blend_Normal, Alpha_Normal, 1.f, FSchedulePolicy::MultiScanlines );
+        ctx.Finish();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    return  static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / 1000.0 / static_cast< double >( iRepeat );
+}
+
+int main( int argc, char *argv[] ) {
+    int size = argc > 1 ? std::stoi( argv[1] ) : 4096;
+    uint32 repeat = argc > 2 ? std::stoul( argv[2] ) : 20;
+    uint32 maxWorkers = argc > 3 ? std::stoul( argv[3] ) : FThreadPool::MaxWorkers();
+    eThreadPoolAffinity affinity = static_cast< eThreadPoolAffinity >( argc > 4 ? std::stoul( argv[4] ) : 0 );
+
+    const eThreadPoolBackend backends[] = { ThreadPoolBackend_SharedQueue, ThreadPoolBackend_WorkStealing };
+    const char* names[] = { "SharedQueue", "WorkStealing" };
+
+    std::cout << "size: " << size << "x" << size << " repeat: " << repeat << " affinity: " << static_cast< int >( affinity ) << std::endl;
+    std::cout << "logical cores: " << FCPUInfo::NumLogicalCores() << " physical cores: " << FCPUInfo::NumPhysicalCores() << " NUMA nodes: " << FCPUInfo::NumNUMANodes() << std::endl;
+    for( uint32 i = 0; i < FCPUInfo::NumLogicalCores(); ++i )
+        std::cout << "  cpu " << FCPUInfo::LogicalCoreID( i ) << ": core " << FCPUInfo::PhysicalCore( i ) << " node " << FCPUInfo::NUMANode( i ) << " L2 " << FCPUInfo::CacheGroup( i, 2 ) << " L3 " << FCPUInfo::CacheGroup( i, 3 ) << std::endl;
+    std::cout << std::setw( 14 ) << "backend" << std::setw( 10 ) << "workers" << std::setw( 14 ) << "ms/iter" << std::setw( 10 ) << "speedup" << std::endl;
+    for( int b = 0; b < 2; ++b ) {
+        double reference = 0.0;
+        for( uint32 w = 1; w <= maxWorkers; ++w ) {
+            double ms = RunScenario( backends[b], affinity, w, size, repeat );
+            if( w == 1 )
+                reference = ms;
+            std::cout << std::setw( 14 ) << names[b] << std::setw( 10 ) << w << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << ms << std::setw( 10 ) << std::setprecision( 2 ) << reference / ms << std::endl;
+        }
+    }
+
+    return  0;
+}
@@ -0,0 +1,127 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         ThreadPoolStats.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the runtime statistics of FThreadPool.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+using namespace ::ULIS;
+
+// Usage: ThreadPoolStats [frames] [workers] [hz]
+// Runs frames of small blends and a larger convolution, alone and while
+// another thread samples the pool stats at hz, and reports the time of both
+// along with the last samples. Also checks the counters are consistent.
+double
+RunFrames( FContext& iCtx, FBlock& iDab, FBlock& iCanvas, FBlock& iOut, const FKernel& iKernel, uint32 iFrames ) {
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 f = 0; f < iFrames; ++f ) {
+        for( int i = 0; i < 32; ++i )
+            iCtx.Blend( iDab, iCanvas, iDab.Rect(), FVec2I( ( f * 37 + i * 29 ) % 448, ( f * 23 + i * 13 ) % 448 ), Blend_Normal, Alpha_Normal, 0.5f, FSchedulePolicy::MultiScanlines );
+        iCtx.Convolve( iCanvas, iOut, iKernel, iCanvas.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), FSchedulePolicy::MultiScanlines );
+        iCtx.Finish();
+    }
+    return  std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+}
+
+void
+Print( const FThreadPoolStats& iStats ) {
+    std::cout << "workers " << iStats.numBusyWorkers << "/" << iStats.numWorkers
+              << " commands " << iStats.numQueuedCommands << "/" << iStats.numPendingCommands
+              << " jobs " << iStats.numQueuedJobs
+              << " utilisation " << iStats.utilisation << "%"
+              << " commands/s " << iStats.commandsPerSecond << std::endl;
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 frames = argc > 1 ? std::stoul( argv[1] ) : 50;
+    uint32 workers = argc > 2 ? std::stoul( argv[2] ) : FThreadPool::MaxWorkers();
+    uint32 hz = argc > 3 ? std::stoul( argv[3] ) : 10;
+
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock dab( 64, 64, fmt );
+    FBlock canvas( 512, 512, fmt );
+    FBlock out( 512, 512, fmt );
+    FKernel box( FVec2I( 3 ), 1.f / 9.f );
+    ctx.Fill( dab, FColor::RGBA8( 255, 0, 0, 128 ), dab.Rect() );
+    ctx.Clear( canvas, canvas.Rect() );
+    ctx.Finish();
+    RunFrames( ctx, dab, canvas, out, box, frames / 4 + 1 );
+
+    // Alternate, so that both see the same machine state.
+    std::atomic_bool sampling( false );
+    std::atomic_uint32_t numSamples( 0 );
+    FThreadPoolStats last = pool.Stats();
+    std::thread sampler( [&]() {
+        while( sampling || numSamples == 0 ) {
+            if( sampling ) {
+                last = pool.Stats();
+                ++numSamples;
+            }
+            std::this_thread::sleep_for( std::chrono::microseconds( 1000000 / hz ) );
+        }
+    } );
+    double aloneMs = 0.0;
+    double sampledMs = 0.0;
+    for( int round = 0; round < 4; ++round ) {
+        aloneMs += RunFrames( ctx, dab, canvas, out, box, frames );
+        sampling = true;
+        sampledMs += RunFrames( ctx, dab, canvas, out, box, frames );
+        sampling = false;
+    }
+    ++numSamples;
+    sampler.join();
+
+    // Everything is finished: nothing is queued, histograms hold all jobs
+    // and the latency of all commands. Fused commands count as one, and the
+    // last one may be counted just after Finish() returns, as workers may
+    // still be leaving their last job.
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    const FThreadPoolStats stats = pool.Stats();
+    uint64 numJobs = 0;
+    uint64 numLatencies = 0;
+    for( uint32 b = 0; b < FThreadPoolStats::NumHistogramBuckets; ++b ) {
+        numJobs += stats.jobTimeHistogram[b];
+        numLatencies += stats.schedulingLatencyHistogram[b];
+    }
+    const uint64 numCommands = ( frames / 4 + 1 + 8 * frames ) * 33 + 2;
+    const bool ok = stats.numPendingCommands == 0
+                 && stats.numQueuedCommands == 0
+                 && stats.numQueuedJobs == 0
+                 && stats.numBusyWorkers == 0
+                 && stats.numWorkers == workers
+                 && stats.numCommandsFinished > 0
+                 && stats.numCommandsFinished <= numCommands
+                 && numJobs == stats.numJobsFinished
+                 && numLatencies >= stats.numCommandsFinished;
+
+    std::cout << "frames: " << frames << " workers: " << workers << " samples: " << numSamples << std::endl;
+    std::cout << std::fixed << std::setprecision( 4 );
+    std::cout << std::setw( 10 ) << "alone" << std::setw( 14 ) << aloneMs / ( 4 * frames ) << " ms/frame" << std::endl;
+    std::cout << std::setw( 10 ) << "sampled" << std::setw( 14 ) << sampledMs / ( 4 * frames ) << " ms/frame" << std::endl;
+    std::cout << std::setprecision( 1 );
+    Print( last );
+    std::cout << std::setw( 10 ) << "us" << std::setw( 12 ) << "jobs" << std::setw( 12 ) << "latency" << std::endl;
+    for( uint32 b = 0; b < FThreadPoolStats::NumHistogramBuckets; ++b ) {
+        if( stats.jobTimeHistogram[b] || stats.schedulingLatencyHistogram[b] )
+            std::cout << std::setw( 10 ) << "<" + std::to_string( 1 << b ) << std::setw( 12 ) << stats.jobTimeHistogram[b] << std::setw( 12 ) << stats.schedulingLatencyHistogram[b] << std::endl;
+    }
+    std::cout << "commands: " << stats.numCommandsFinished << " jobs: " << stats.numJobsFinished << std::endl;
+    std::cout << "consistent: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    return  ok ? 0 : 1;
+}
+
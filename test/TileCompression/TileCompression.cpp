@@ -0,0 +1,134 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TileCompression.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the compression of the tiles of the FTilePool.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+using namespace ::ULIS;
+
+// Usage: TileCompression [workers]
+// Compresses the cold tiles of a layer made of flat colors, a gradient and
+// dabs, in the background while it is painted and then all at once, checks
+// that it gives the same pixels as a dense block, and reports the memory
+// saved and the time spent decompressing.
+
+// Largest difference between two blocks of the same size and format.
+int
+MaxDifference( const FBlock& iA, const FBlock& iB )
+{
+    int diff = 0;
+    for( uint64 i = 0; i < iA.BytesTotal(); ++i )
+        diff = FMath::Max( diff, std::abs( int( iA.Bits()[i] ) - int( iB.Bits()[i] ) ) );
+    return  diff;
+}
+
+// Read a region of a tiled block in a dense block.
+int
+MaxDifference( FContext& iCtx, const FTiledBlock& iTiled, const FBlock& iDense )
+{
+    FBlock read( iDense.Width(), iDense.Height(), iDense.Format() );
+    iCtx.Copy( iTiled, read, FRectI( 0, 0, iDense.Width(), iDense.Height() ) );
+    iCtx.Finish();
+    return  MaxDifference( read, iDense );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    TTilePool< Micro_64, Macro_1024 > tiles( fmt );
+    FTiledBlock* tiled = tiles.CreateNewTiledBlock();
+
+    // Mostly transparent, half of it a flat color, with a gradient band.
+    const int size = 2048;
+    FBlock dense( size, size, fmt );
+    ctx.Clear( dense, dense.Rect() );
+    ctx.Fill( dense, FColor::RGBA8( 40, 90, 160, 255 ), FRectI( 0, 0, size / 2, size ) );
+    ctx.Finish();
+    for( int y = 0; y < size / 2; ++y ) {
+        for( int x = size / 2; x < size * 3 / 4; ++x ) {
+            uint8* pixel = dense.PixelBits( x, y );
+            pixel[0] = static_cast< uint8 >( x );
+            pixel[1] = static_cast< uint8 >( y / 4 );
+            pixel[2] = 128;
+            pixel[3] = 255;
+        }
+    }
+    ctx.Copy( dense, *tiled );
+    ctx.Finish();
+    bool ok = MaxDifference( ctx, *tiled, dense ) == 0;
+
+    // Dabs painted while a background pass compresses the tiles as soon as
+    // they are not used.
+    FBlock dab( 96, 96, fmt );
+    ctx.Fill( dab, FColor::RGBA8( 255, 128, 0, 160 ), dab.Rect() );
+    ctx.Finish();
+    std::atomic_bool painting( true );
+    uint64 compressedWhilePainting = 0;
+    std::thread background( [&]() {
+        while( painting.load() )
+            compressedWhilePainting += tiles.CompressColdTiles( 0 );
+    } );
+    for( int i = 0; i < 256; ++i ) {
+        const FVec2I pos( ( i * 331 ) % ( size - 96 ), ( i * 577 ) % ( size - 96 ) );
+        ctx.Blend( dab, *tiled, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+        ctx.Blend( dab, dense, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+        if( i % 16 == 15 )
+            ctx.Finish();
+    }
+    ctx.Finish();
+    painting.store( false );
+    background.join();
+    ok = ok && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    // Nothing is cold right after its use.
+    ok = ok && tiles.CompressColdTiles( 60000 ) == 0;
+
+    // All the tiles at once.
+    const uint64 before = tiles.CurrentRAMUsage();
+    const uint64 compressed = tiles.CompressColdTiles( 0 );
+    const uint64 after = tiles.CurrentRAMUsage();
+    const float ratio = tiles.CompressionRatio();
+    ok = ok && compressed > 0 && after * 4 < before;
+
+    // Read and painted again, the tiles are decompressed on demand.
+    ok = ok && MaxDifference( ctx, *tiled, dense ) == 0 && tiles.NumCompressedTiles() == 0;
+    tiles.CompressColdTiles( 0 );
+    for( int i = 0; i < 16; ++i ) {
+        const FVec2I pos( ( i * 797 ) % ( size - 96 ), ( i * 191 ) % ( size - 96 ) );
+        ctx.Blend( dab, *tiled, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 1.f );
+        ctx.Blend( dab, dense, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 1.f );
+    }
+    ctx.Finish();
+    FVec2I local;
+    const FBlock* corner = tiled->QueryConstBlockAtPixelCoordinates( FVec2I( 10, 10 ), &local );
+    ok = ok
+        && memcmp( corner->PixelBits( local.x, local.y ), dense.PixelBits( 10, 10 ), 4 ) == 0
+        && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    const uint64 decompressions = tiles.NumDecompressions();
+    std::cout << "workers: " << workers << std::endl;
+    std::cout << "compressed while painting: " << compressedWhilePainting << " tiles" << std::endl;
+    std::cout << "compressed: " << compressed << " tiles, " << before / 1024 << " KB -> " << after / 1024 << " KB, ratio: " << ratio << std::endl;
+    std::cout << "decompressions: " << decompressions << " ( " << ( decompressions ? tiles.DecompressionTime() / decompressions : 0 ) << " ns each )" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    tiles.RequestTiledBlockDeletion( tiled );
+    return  ok ? 0 : 1;
+}
+
@@ -0,0 +1,136 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TileSwap.cpp
+* @author       Clement Berthaud
+* @brief        Test application for the swap of the FTilePool.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: TileSwap [workers]
+// Paints, transforms and reads a tiled block four times larger than the
+// resident budget of its pool, checks that it gives the same pixels as a
+// dense block, and reports the traffic with the scratch file.
+
+// Largest difference between two blocks of the same size and format.
+int
+MaxDifference( const FBlock& iA, const FBlock& iB )
+{
+    int diff = 0;
+    for( uint64 i = 0; i < iA.BytesTotal(); ++i )
+        diff = FMath::Max( diff, std::abs( int( iA.Bits()[i] ) - int( iB.Bits()[i] ) ) );
+    return  diff;
+}
+
+// Read a region of a tiled block in a dense block.
+int
+MaxDifference( FContext& iCtx, const FTiledBlock& iTiled, const FBlock& iDense )
+{
+    FBlock read( iDense.Width(), iDense.Height(), iDense.Format() );
+    iCtx.Copy( iTiled, read, FRectI( 0, 0, iDense.Width(), iDense.Height() ) );
+    iCtx.Finish();
+    return  MaxDifference( read, iDense );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+
+    // 1024 tiles of 16KB, for a budget of 256 tiles.
+    const int size = 2048;
+    const uint64 budget = 4 * 1024 * 1024;
+    TTilePool< Micro_64, Macro_1024 > tiles( fmt );
+    bool ok = tiles.EnableSwap( budget );
+    FTiledBlock* tiled = tiles.CreateNewTiledBlock();
+
+    // A gradient, no two tiles are the same.
+    FBlock dense( size, size, fmt );
+    for( int y = 0; y < size; ++y ) {
+        for( int x = 0; x < size; ++x ) {
+            uint8* pixel = dense.PixelBits( x, y );
+            pixel[0] = static_cast< uint8 >( x );
+            pixel[1] = static_cast< uint8 >( y );
+            pixel[2] = static_cast< uint8 >( ( x >> 8 ) * 16 + ( y >> 8 ) );
+            pixel[3] = 255;
+        }
+    }
+    auto startTime = std::chrono::steady_clock::now();
+    ctx.Copy( dense, *tiled );
+    ctx.Finish();
+    const uint64 swappedAfterCopy = tiles.NumSwappedTiles();
+    ok = ok
+        && swappedAfterCopy > 0
+        && tiles.CurrentRAMUsage() <= budget
+        && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    // Blends on tiles that are swapped out page them in first.
+    FBlock dab( 96, 96, fmt );
+    ctx.Fill( dab, FColor::RGBA8( 0, 128, 255, 160 ), dab.Rect() );
+    ctx.Finish();
+    for( int i = 0; i < 64; ++i ) {
+        const FVec2I pos( ( i * 331 ) % ( size - 96 ), ( i * 577 ) % ( size - 96 ) );
+        ctx.Blend( dab, *tiled, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+        ctx.Blend( dab, dense, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+    }
+    ctx.Finish();
+    ok = ok && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    // A transform from a swapped source into a swapped destination.
+    const float half = size / 2.f;
+    FMat3F mat = FMat3F::MakeTranslationMatrix( half, half ) * FMat3F::MakeRotationMatrix( 0.2f ) * FMat3F::MakeTranslationMatrix( -half, -half );
+    FTiledBlock* rotated = tiles.CreateNewTiledBlock();
+    FBlock denseRotated( size, size, fmt );
+    ctx.Clear( denseRotated, denseRotated.Rect() );
+    ctx.Finish();
+    ctx.TransformAffine( dense, denseRotated, dense.Rect(), mat, Resampling_Bilinear );
+    ctx.TransformAffine( *tiled, *rotated, FRectI( 0, 0, size, size ), mat, Resampling_Bilinear );
+    ctx.Finish();
+    const int rotatedDiff = MaxDifference( ctx, *rotated, denseRotated );
+    ok = ok && rotatedDiff <= 2 && tiles.CurrentRAMUsage() <= budget;
+    const double workMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+
+    // A prefetched viewport is paged in ahead of its use.
+    const FRectI viewport( 0, 0, 512, 512 );
+    const uint64 pageInsBefore = tiles.NumPageIns();
+    ctx.Prefetch( *tiled, viewport );
+    ctx.Finish();
+    const uint64 prefetched = tiles.NumPageIns() - pageInsBefore;
+    ctx.Copy( *tiled, dense, viewport, FVec2I( 0 ) );
+    ctx.Finish();
+    ok = ok && prefetched > 0 && tiles.NumPageIns() - pageInsBefore == prefetched;
+
+    // Single pixels are paged in on the calling thread.
+    FVec2I local;
+    const FBlock* corner = tiled->QueryConstBlockAtPixelCoordinates( FVec2I( size - 1, size - 1 ), &local );
+    ok = ok && memcmp( corner->PixelBits( local.x, local.y ), dense.PixelBits( size - 1, size - 1 ), 4 ) == 0;
+
+    // Sanitize leaves the swapped tiles as they are.
+    tiled->SanitizeNow();
+    rotated->SanitizeNow();
+    ok = ok && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    std::cout << "workers: " << workers << " budget: " << budget / 1024 << " KB" << std::endl;
+    std::cout << "resident: " << tiles.NumResidentTiles() << " tiles, " << tiles.CurrentRAMUsage() / 1024 << " KB, swapped: " << tiles.NumSwappedTiles() << " tiles, swap file: " << tiles.SwapFileSize() / ( 1024 * 1024 ) << " MB" << std::endl;
+    std::cout << "evictions: " << tiles.NumEvictions() << " page-ins: " << tiles.NumPageIns() << " ( " << ( tiles.NumPageIns() ? tiles.PageInTime() / tiles.NumPageIns() : 0 ) << " ns each ), prefetched: " << prefetched << std::endl;
+    std::cout << "transform max difference: " << rotatedDiff << ", work: " << workMs << " ms" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    tiles.RequestTiledBlockDeletion( rotated );
+    tiles.RequestTiledBlockDeletion( tiled );
+    return  ok ? 0 : 1;
+}
+
@@ -0,0 +1,164 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TiledBlock.cpp
+* @author       Clement Berthaud
+* @brief        Test application for FTiledBlock and FTilePool.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: TiledBlock [workers]
+// Runs the same fills, blends, clears, copies and transforms on tiled blocks
+// and on dense blocks and checks that they give the same pixels, then paints
+// a few strokes on a mostly empty 16K canvas and reports its memory.
+
+// Largest difference between two blocks of the same size and format.
+int
+MaxDifference( const FBlock& iA, const FBlock& iB )
+{
+    int diff = 0;
+    for( uint64 i = 0; i < iA.BytesTotal(); ++i )
+        diff = FMath::Max( diff, std::abs( int( iA.Bits()[i] ) - int( iB.Bits()[i] ) ) );
+    return  diff;
+}
+
+// Read a region of a tiled block in a dense block.
+int
+MaxDifference( FContext& iCtx, const FTiledBlock& iTiled, const FBlock& iDense, const FVec2I& iOffset = FVec2I( 0 ) )
+{
+    FBlock read( iDense.Width(), iDense.Height(), iDense.Format() );
+    iCtx.Copy( iTiled, read, FRectI::FromPositionAndSize( iOffset, FVec2I( iDense.Width(), iDense.Height() ) ) );
+    iCtx.Finish();
+    return  MaxDifference( read, iDense );
+}
+
+int main( int argc, char *argv[] ) {
+    uint32 workers = argc > 1 ? std::stoul( argv[1] ) : FThreadPool::MaxWorkers();
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    queue.SetHazardTracking( true );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+
+    const int size = 1024;
+    TTilePool< Micro_64, Macro_1024 > tiles( fmt );
+    FTiledBlock* tiled = tiles.CreateNewTiledBlock();
+    FBlock dense( size, size, fmt );
+    FBlock dab( 96, 96, fmt );
+    ctx.Clear( dense, dense.Rect() );
+    ctx.Fill( dab, FColor::RGBA8( 0, 128, 255, 160 ), dab.Rect() );
+    ctx.Finish();
+
+    // Fill, blend and clear.
+    const FRectI fillRect( 100, 90, 500, 300 );
+    const FRectI clearRect( 150, 130, 300, 200 );
+    ctx.Fill( *tiled, FColor::RGBA8( 255, 0, 0, 255 ), fillRect );
+    ctx.Fill( dense, FColor::RGBA8( 255, 0, 0, 255 ), fillRect );
+    for( int i = 0; i < 16; ++i ) {
+        const FVec2I pos( 37 + i * 53, 41 + ( i * 97 ) % 700 );
+        ctx.Blend( dab, *tiled, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+        ctx.Blend( dab, dense, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.5f );
+    }
+    ctx.Clear( *tiled, clearRect );
+    ctx.Clear( dense, clearRect );
+    ctx.Finish();
+    const uint64 numTiles = tiled->NumTiles();
+    bool ok = MaxDifference( ctx, *tiled, dense ) == 0
+           && numTiles > 0
+           && numTiles < ( size / 64 ) * ( size / 64 );
+
+    // Aligned copies share the tiles, the other ones copy pixels.
+    FTiledBlock* aligned = tiles.CreateNewTiledBlock();
+    FTiledBlock* shifted = tiles.CreateNewTiledBlock();
+    const uint64 usageBefore = tiles.CurrentRAMUsage();
+    ctx.Copy( *tiled, *aligned, FRectI( 0, 0, size, size ), FVec2I( 256, -128 ) );
+    ctx.Finish();
+    const uint64 usageShared = tiles.CurrentRAMUsage() - usageBefore;
+    ctx.Copy( *tiled, *shifted, FRectI( 0, 0, size, size ), FVec2I( 13, 7 ) );
+    FBlock denseShifted( size, size, fmt );
+    ctx.Clear( denseShifted, denseShifted.Rect() );
+    ctx.Copy( dense, denseShifted, dense.Rect(), FVec2I( 13, 7 ) );
+    ctx.Finish();
+    ok = ok
+        && aligned->NumTiles() == numTiles
+        && usageShared == 0
+        && MaxDifference( ctx, *aligned, dense, FVec2I( 256, -128 ) ) == 0
+        && MaxDifference( ctx, *shifted, denseShifted ) == 0;
+
+    // Writing a shared tile copies it first, the original is untouched.
+    ctx.Blend( dab, *aligned, dab.Rect(), FVec2I( 256 + 200, -128 + 100 ), Blend_Normal, Alpha_Normal, 1.f );
+    ctx.Finish();
+    ok = ok && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    // Transforms, from tiled and dense sources into tiled and dense
+    // destinations. The resampling may round differently per tile.
+    const float half = size / 2.f;
+    FMat3F mat = FMat3F::MakeTranslationMatrix( half, half ) * FMat3F::MakeRotationMatrix( 0.3f ) * FMat3F::MakeScaleMatrix( 0.8f, 0.8f ) * FMat3F::MakeTranslationMatrix( -half, -half );
+    FTiledBlock* rotated = tiles.CreateNewTiledBlock();
+    FTiledBlock* rotatedFromDense = tiles.CreateNewTiledBlock();
+    FBlock denseRotated( size, size, fmt );
+    FBlock rotatedToDense( size, size, fmt );
+    ctx.Clear( denseRotated, denseRotated.Rect() );
+    ctx.Clear( rotatedToDense, rotatedToDense.Rect() );
+    ctx.Finish();
+    ctx.TransformAffine( dense, denseRotated, dense.Rect(), mat, Resampling_Bilinear );
+    ctx.TransformAffine( *tiled, *rotated, FRectI( 0, 0, size, size ), mat, Resampling_Bilinear );
+    ctx.TransformAffine( dense, *rotatedFromDense, dense.Rect(), mat, Resampling_Bilinear );
+    ctx.TransformAffine( *tiled, rotatedToDense, FRectI( 0, 0, size, size ), mat, Resampling_Bilinear );
+    ctx.Finish();
+    const int rotatedDiff = FMath::Max( MaxDifference( ctx, *rotated, denseRotated ), FMath::Max( MaxDifference( ctx, *rotatedFromDense, denseRotated ), MaxDifference( rotatedToDense, denseRotated ) ) );
+    ok = ok && rotatedDiff <= 2;
+
+    // Sanitize merges the tiles with the same content.
+    const uint64 inUse = tiles.NumDirtyHashedTilesCurrentlyInUse() + tiles.NumCorrectlyHashedTilesCurrentlyInUse();
+    tiled->SanitizeNow();
+    aligned->SanitizeNow();
+    shifted->SanitizeNow();
+    const uint64 inUseSanitized = tiles.NumDirtyHashedTilesCurrentlyInUse() + tiles.NumCorrectlyHashedTilesCurrentlyInUse();
+    ok = ok && inUseSanitized < inUse && MaxDifference( ctx, *tiled, dense ) == 0;
+
+    tiles.RequestTiledBlockDeletion( rotatedFromDense );
+    tiles.RequestTiledBlockDeletion( rotated );
+    tiles.RequestTiledBlockDeletion( shifted );
+    tiles.RequestTiledBlockDeletion( aligned );
+    tiles.RequestTiledBlockDeletion( tiled );
+    ok = ok
+        && tiles.NumRegisteredTiledBlocks() == 0
+        && tiles.NumDirtyHashedTilesCurrentlyInUse() + tiles.NumCorrectlyHashedTilesCurrentlyInUse() == 0;
+
+    // Strokes on a mostly empty 16K canvas.
+    tiles.PurgeAllNow();
+    FTiledBlock* canvas = tiles.CreateNewTiledBlock();
+    auto startTime = std::chrono::steady_clock::now();
+    ctx.Fill( *canvas, FColor::RGBA8( 255, 255, 255, 255 ), FRectI( 0, 0, 4096, 4096 ) );
+    for( int i = 0; i < 2000; ++i ) {
+        const FVec2I pos( 1000 + ( i * 7 ) % 14000, 8000 + int( 2000 * std::sin( i * 0.01f ) ) );
+        ctx.Blend( dab, *canvas, dab.Rect(), pos, Blend_Normal, Alpha_Normal, 0.25f );
+    }
+    ctx.Finish();
+    const double strokeMs = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - startTime ).count() / 1000.0;
+    canvas->SanitizeNow();
+    const uint64 denseBytes = uint64( 16384 ) * 16384 * 4;
+    const uint64 tiledBytes = tiles.CurrentRAMUsage();
+    ok = ok && tiledBytes < denseBytes / 16;
+
+    std::cout << "workers: " << workers << " tiles: " << numTiles << " shared copy: " << usageShared / 1024 << " KB" << std::endl;
+    std::cout << "transform max difference: " << rotatedDiff << std::endl;
+    std::cout << "tiles in use: " << inUse << " sanitized: " << inUseSanitized << std::endl;
+    std::cout << "16K canvas: " << canvas->NumTiles() << " tiles, " << tiledBytes / ( 1024 * 1024 ) << " MB instead of " << denseBytes / ( 1024 * 1024 ) << " MB, strokes: " << strokeMs << " ms" << std::endl;
+    std::cout << "same pixels: " << ( ok ? "yes" : "NO" ) << std::endl;
+
+    return  ok ? 0 : 1;
+}
+
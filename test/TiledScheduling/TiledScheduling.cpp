@@ -0,0 +1,111 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         TiledScheduling.cpp
+* @author       Clement Berthaud
+* @brief        Benchmark application for ScheduleMode_Tiles.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: TiledScheduling [size] [repeat] [workers] [tile]
+// Runs neighbourhood and resampling operations on a square block, on
+// scanlines then on tiles, and checks that both produce the same pixels.
+enum eOp { Op_Convolve3, Op_Convolve9, Op_Rotate, Op_Perspective, Op_Resize, Op_Count };
+static const char* sOpNames[] = { "Convolve3x3", "Convolve9x9", "Rotate30", "Perspective", "Resize0.7" };
+
+void
+Run( FContext& iCtx, eOp iOp, const FBlock& iSrc, FBlock& iDst, const FSchedulePolicy& iPolicy ) {
+    static const FKernel box3( FVec2I( 3 ), 1.f / 9.f );
+    static const FKernel box9( FVec2I( 9 ), 1.f / 81.f );
+    const float half = iSrc.Width() / 2.f;
+    switch( iOp ) {
+        case Op_Convolve3:
+            iCtx.Convolve( iSrc, iDst, box3, iSrc.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), iPolicy );
+            break;
+        case Op_Convolve9:
+            iCtx.Convolve( iSrc, iDst, box9, iSrc.Rect(), FVec2I( 0 ), Resampling_NearestNeighbour, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), iPolicy );
+            break;
+        case Op_Rotate: {
+            FMat3F mat = FMat3F::MakeTranslationMatrix( half, half ) * FMat3F::MakeRotationMatrix( 0.52f ) * FMat3F::MakeTranslationMatrix( -half, -half );
+            iCtx.TransformAffine( iSrc, iDst, iSrc.Rect(), mat, Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), iPolicy );
+            break;
+        }
+        case Op_Perspective: {
+            const float w = static_cast< float >( iSrc.Width() );
+            const FVec2F from[] = { FVec2F( 0, 0 ), FVec2F( w, 0 ), FVec2F( w, w ), FVec2F( 0, w ) };
+            const FVec2F to[] = { FVec2F( w * 0.2f, 0 ), FVec2F( w * 0.8f, w * 0.1f ), FVec2F( w, w ), FVec2F( 0, w * 0.9f ) };
+            FMat3F mat = FMat3F::MakeHomography( from, to );
+            iCtx.TransformPerspective( iSrc, iDst, iSrc.Rect(), mat, Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), iPolicy );
+            break;
+        }
+        case Op_Resize:
+            iCtx.Resize( iSrc, iDst, iSrc.Rect(), FRectF( 0, 0, iSrc.Width() * 0.7f, iSrc.Height() * 0.7f ), Resampling_Bilinear, Border_Transparent, FColor::RGBA8( 0, 0, 0 ), nullptr, iPolicy );
+            break;
+        default: break;
+    }
+}
+
+double
+Measure( FContext& iCtx, eOp iOp, const FBlock& iSrc, FBlock& oDst, uint32 iRepeat, const FSchedulePolicy& iPolicy ) {
+    iCtx.Clear( oDst, oDst.Rect() );
+    iCtx.Finish();
+    auto startTime = std::chrono::steady_clock::now();
+    for( uint32 l = 0; l < iRepeat; ++l ) {
+        Run( iCtx, iOp, iSrc, oDst, iPolicy );
+        iCtx.Finish();
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    return  static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / 1000.0 / static_cast< double >( iRepeat );
+}
+
+int main( int argc, char *argv[] ) {
+    int size = argc > 1 ? std::stoi( argv[1] ) : 2048;
+    uint32 repeat = argc > 2 ? std::stoul( argv[2] ) : 3;
+    uint32 workers = argc > 3 ? std::stoul( argv[3] ) : FThreadPool::MaxWorkers();
+    int64 tile = argc > 4 ? std::stoll( argv[4] ) : FSchedulePolicy::DefaultTileSize;
+
+    FThreadPool pool( workers );
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+
+    // A noisy source, so that every sample matters.
+    FBlock src( size, size, fmt );
+    for( uint64 i = 0; i < src.BytesTotal(); ++i )
+        src.Bits()[i] = static_cast< uint8 >( ( i * 2654435761u ) >> 13 );
+
+    const FSchedulePolicy scanlines[] = { FSchedulePolicy::MonoScanlines, FSchedulePolicy::MultiScanlines };
+    const FSchedulePolicy tiles[] = {
+          FSchedulePolicy( ScheduleTime_Sync, ScheduleRun_Mono, ScheduleMode_Tiles, ScheduleParameter_Length, tile )
+        , FSchedulePolicy( ScheduleTime_Sync, ScheduleRun_Multi, ScheduleMode_Tiles, ScheduleParameter_Length, tile )
+    };
+    const char* runNames[] = { "mono", "multi" };
+
+    bool match = true;
+    std::cout << "size: " << size << "x" << size << " repeat: " << repeat << " workers: " << workers << " tile: " << tile << std::endl;
+    std::cout << std::setw( 12 ) << "op" << std::setw( 7 ) << "run" << std::setw( 14 ) << "scanlines ms" << std::setw( 12 ) << "tiles ms" << std::setw( 10 ) << "speedup" << std::setw( 8 ) << "match" << std::endl;
+    for( int op = 0; op < Op_Count; ++op ) {
+        for( int r = 0; r < 2; ++r ) {
+            FBlock a( size, size, fmt );
+            FBlock b( size, size, fmt );
+            double scanMs = Measure( ctx, static_cast< eOp >( op ), src, a, repeat, scanlines[r] );
+            double tileMs = Measure( ctx, static_cast< eOp >( op ), src, b, repeat, tiles[r] );
+            bool same = std::memcmp( a.Bits(), b.Bits(), a.BytesTotal() ) == 0;
+            match = match && same;
+            std::cout << std::setw( 12 ) << sOpNames[op] << std::setw( 7 ) << runNames[r] << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << scanMs << std::setw( 12 ) << tileMs << std::setw( 10 ) << std::setprecision( 2 ) << scanMs / tileMs << std::setw( 8 ) << ( same ? "yes" : "NO" ) << std::endl;
+        }
+    }
+
+    return  match ? 0 : 1;
+}
+
@@ -0,0 +1,63 @@
+// IDDN FR.001.250001.004.S.X.2019.000.00000
+// ULIS is subject to copyright laws and is the legal and intellectual property of Praxinos,Inc
+/*
+*   ULIS
+*__________________
+* @file         WaitLatency.cpp
+* @author       Clement Berthaud
+* @brief        Wait latency and CPU usage benchmark application for ULIS.
+* @copyright    Copyright 2018-2021 Praxinos, Inc. All Rights Reserved.
+* @license      Please refer to LICENSE.md
+*/
+#include <ULIS>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+using namespace ::ULIS;
+
+// Usage: WaitLatency [size] [repeat]
+// Issues small Fill commands and waits for each of them, with Finish() and
+// with FEvent::Wait(), for several wait spin counts. Reports the wall time
+// per round trip and the process CPU time spent per round trip: spinning
+// lowers the latency of short waits but burns CPU time.
+int main( int argc, char *argv[] ) {
+    int size = argc > 1 ? std::stoi( argv[1] ) : 64;
+    uint32 repeat = argc > 2 ? std::stoul( argv[2] ) : 2000;
+    const uint32 spins[] = { 0, 64, 1024, 16384 };
+
+    FThreadPool pool;
+    FCommandQueue queue( pool );
+    eFormat fmt = Format_RGBA8;
+    FContext ctx( queue, fmt, PerformanceIntent_Max );
+    FBlock block( size, size, fmt );
+
+    std::cout << "size: " << size << "x" << size << " repeat: " << repeat << " workers: " << pool.GetNumWorkers() << std::endl;
+    std::cout << std::setw( 8 ) << "wait" << std::setw( 10 ) << "spin" << std::setw( 14 ) << "wall us/op" << std::setw( 14 ) << "cpu us/op" << std::setw( 10 ) << "cpu/wall" << std::endl;
+    for( int mode = 0; mode < 2; ++mode ) {
+        for( uint32 spin : spins ) {
+            pool.SetWaitSpinCount( spin );
+            auto startTime = std::chrono::steady_clock::now();
+            std::clock_t startCPU = std::clock();
+            for( uint32 l = 0; l < repeat; ++l ) {
+                if( mode == 0 ) {
+                    ctx.Fill( block, FColor::RGBA8( 255, 0, 0 ), block.Rect(), FSchedulePolicy::MultiScanlines );
+                    ctx.Finish();
+                } else {
+                    FEvent event;
+                    ctx.Fill( block, FColor::RGBA8( 255, 0, 0 ), block.Rect(), FSchedulePolicy::MultiScanlines, 0, nullptr, &event );
+                    ctx.Flush();
+                    ctx.Wait( event );
+                }
+            }
+            std::clock_t endCPU = std::clock();
+            auto endTime = std::chrono::steady_clock::now();
+            double wall = static_cast< double >( std::chrono::duration_cast< std::chrono::microseconds >( endTime - startTime ).count() ) / repeat;
+            double cpu = ( static_cast< double >( endCPU - startCPU ) * 1000000.0 / CLOCKS_PER_SEC ) / repeat;
+            std::cout << std::setw( 8 ) << ( mode == 0 ? "Finish" : "Event" ) << std::setw( 10 ) << spin << std::setw( 14 ) << std::fixed << std::setprecision( 2 ) << wall << std::setw( 14 ) << cpu << std::setw( 10 ) << cpu / wall << std::endl;
+        }
+    }
+
+    return  0;
+}
@@ -43,6 +43,10 @@ target_compile_definitions(
     ULIS_DEF_GIT_BRANCH_NAME=${ULIS_GIT_BRANCH_NAME}
 )
 
+if( ${ULIS_BUILD_TRACE} )
+    target_compile_definitions( ULIS PRIVATE ULIS_TRACE_ENABLED )
+endif()
+
 # Include
 target_include_directories(
     ULIS